@@ -1,4 +1,9 @@
 #include "CommandManager.hpp"
+#include "data/config/configBatch.hpp"
+#include "io/Serial/SerialManager.hpp"
+#include "io/camera/snapshot.hpp"
+#include "network/wifihandler/radioProfiles.hpp"
+#include "network/wifihandler/radioSelfTest.hpp"
 #include "tasks/tasks.hpp"
 
 
@@ -35,6 +40,8 @@ void CommandManager::handleCommands(CommandsPayload commandsPayload) {
 }
 
 void CommandManager::handleCommand(JsonVariant command) {
+  TRACE_SCOPE("command");
+  metrics.count(METRIC_COMMANDS);
   auto command_type = this->getCommandType(command);
 
   switch (command_type) {
@@ -125,6 +132,159 @@ void CommandManager::handleCommand(JsonVariant command) {
       
       break;
     }
+    case CommandType::SET_STREAM_CONFIG: {
+      if (!this->hasDataField(command))
+        break;
+
+      auto streamConfig = this->deviceConfig->getStreamConfig();
+      bool serialMetadata = streamConfig.serialMetadata;
+      if (command["data"]["frame_metadata"].is<bool>())
+        serialMetadata = command["data"]["frame_metadata"];
+      bool frameStats = streamConfig.frameStats;
+      if (command["data"]["frame_stats"].is<bool>())
+        frameStats = command["data"]["frame_stats"];
+
+      this->deviceConfig->setStreamConfig(serialMetadata, frameStats, false);
+
+      JsonVariant data = command["data"];
+      this->deviceConfig->setFrameSuppressionConfig(
+          data["suppress_unchanged"] | streamConfig.suppressUnchanged,
+          data["suppress_size_delta"] | streamConfig.suppressSizeDelta,
+          data["suppress_dc_delta"] | streamConfig.suppressDCDelta,
+          data["max_keyframe_interval"] | streamConfig.maxKeyframeInterval,
+          true);
+      break;
+    }
+    case CommandType::SET_PUPIL_CONFIG: {
+      if (!this->hasDataField(command))
+        break;
+
+      // every field is optional, the ones left out keep their current value
+      auto pupilConfig = this->deviceConfig->getPupilConfig();
+      JsonVariant data = command["data"];
+      bool enabled = data["enabled"] | pupilConfig.enabled;
+      uint8_t threshold = data["threshold"] | pupilConfig.threshold;
+      bool ellipseFit = data["ellipse_fit"] | pupilConfig.ellipseFit;
+      PupilTransport transport = pupilConfig.transport;
+      if (data["transport"].is<const char*>())
+        transport = strcmp(data["transport"], "udp") == 0
+                        ? PupilTransport::UDP_OUTPUT
+                        : PupilTransport::SERIAL_OUTPUT;
+      std::string udpHost = data["udp_host"] | pupilConfig.udpHost;
+      uint16_t udpPort = data["udp_port"] | pupilConfig.udpPort;
+      uint16_t keyframeInterval =
+          data["keyframe_interval"] | pupilConfig.keyframeInterval;
+
+      this->deviceConfig->setPupilConfig(enabled, threshold, ellipseFit,
+                                         transport, udpHost, udpPort,
+                                         keyframeInterval, true);
+      break;
+    }
+    case CommandType::SET_RADIO_PROFILE: {
+      if (!this->hasDataField(command) ||
+          !command["data"]["profile"].is<const char*>())
+        break;
+
+      RadioProfile profile;
+      if (!RadioProfiles::fromName(command["data"]["profile"].as<std::string>(),
+                                   &profile)) {
+        log_e("[CommandManager] Unknown radio profile: %s",
+              command["data"]["profile"].as<const char*>());
+        break;
+      }
+      this->deviceConfig->setRadioConfig(profile, true);
+      break;
+    }
+    case CommandType::RUN_RADIO_SELF_TEST: {
+      // the results get printed once the test is done
+      JsonVariant data = command["data"];
+      std::string host = data["host"] | std::string();
+      uint16_t port = data["port"] | 0;
+      uint16_t count = data["count"] | RADIO_SELF_TEST_PING_COUNT;
+      if (!radioSelfTest.start(
+              host, port, count,
+              static_cast<int>(this->deviceConfig->getRadioConfig().profile),
+              true))
+        log_e("[CommandManager] Could not start the radio self-test");
+      break;
+    }
+    case CommandType::GET_TRACE: {
+      // a single line of Chrome trace JSON, save it to a file and load it in
+      // chrome://tracing or Perfetto
+      traceProfiler.exportChromeTrace(Serial);
+      Serial.println();
+      if (command["data"]["clear"] | false)
+        traceProfiler.clear();
+      break;
+    }
+    case CommandType::GET_METRICS: {
+      // Prometheus text, terminated by an empty line
+      metrics.writePrometheus(Serial);
+      Serial.println();
+      break;
+    }
+    case CommandType::GET_LOG: {
+      // formatted here and now, the records are dropped afterwards
+      binaryLog.drain(Serial);
+      break;
+    }
+    case CommandType::SET_LOG_LEVEL: {
+      LogModule_e module;
+      LogLevel_e level;
+      JsonVariant levelField = command["data"]["level"];
+      std::string levelName = levelField.is<int>()
+                                  ? std::to_string(levelField.as<int>())
+                                  : levelField.as<std::string>();
+      if (!BinaryLog::moduleFromName(
+              command["data"]["module"].as<std::string>(), &module) ||
+          !BinaryLog::levelFromName(levelName, &level)) {
+        log_e("[CommandManager] Unknown log module or level");
+        break;
+      }
+      binaryLog.setLevel(module, level);
+      break;
+    }
+    case CommandType::BENCHMARK_LOG: {
+      uint32_t iterations = command["data"]["iterations"] | 1000;
+      binaryLog.benchmark(Serial, max(iterations, (uint32_t)1));
+      break;
+    }
+    case CommandType::GET_SNAPSHOT: {
+      // the next frame of a running stream, or a capture of its own
+      Snapshot_t snapshot;
+      if (!snapshotProvider.take(&snapshot)) {
+        log_e("[CommandManager] Could not take a snapshot");
+        break;
+      }
+      SerialManager::sendSnapshot(snapshot);
+      SnapshotProvider::release(snapshot);
+      break;
+    }
+    case CommandType::SET_CONFIG: {
+      if (!this->hasDataField(command))
+        break;
+
+      // the same batch POST /config applies, all of it or nothing
+      ConfigBatch batch(*this->deviceConfig);
+      if (!batch.stage(command["data"].as<JsonVariantConst>())) {
+        log_e("[CommandManager] Config rejected: %s", batch.getError().c_str());
+        break;
+      }
+      // handleCommands saves the whole config afterwards
+      batch.commit(false);
+      log_i("[CommandManager] Config applied: %s",
+            batch.sectionsToJson().c_str());
+      break;
+    }
+    case CommandType::GET_MEMORY: {
+      // a single line of JSON, the same report /control/builtin/command/memory
+      // sends
+      memoryTelemetry.writeJson(Serial);
+      Serial.println();
+      if (command["data"]["reset"] | false)
+        memoryTelemetry.resetAllocations();
+      break;
+    }
     case CommandType::RESTART_DEVICE: {
       log_i("[CommandManager] Explicit restart requested");
       OpenIrisTasks::ScheduleRestart(2000);
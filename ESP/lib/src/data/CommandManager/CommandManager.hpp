@@ -4,6 +4,9 @@
 #include <ArduinoJson.h>
 #include <unordered_map>
 #include "data/config/project_config.hpp"
+#include "data/utilities/binaryLog.hpp"
+#include "data/utilities/metrics.hpp"
+#include "data/utilities/traceProfiler.hpp"
 
 enum CommandType {
   None,
@@ -13,10 +16,23 @@ enum CommandType {
   SWITCH_MODE,
   WIPE_WIFI_CREDS,
   RESTART_DEVICE,
+  SET_STREAM_CONFIG,
+  SET_PUPIL_CONFIG,
+  SET_RADIO_PROFILE,
+  RUN_RADIO_SELF_TEST,
+  GET_TRACE,
+  GET_METRICS,
+  GET_LOG,
+  SET_LOG_LEVEL,
+  BENCHMARK_LOG,
+  GET_SNAPSHOT,
+  SET_CONFIG,
+  GET_MEMORY,
 };
 
+//! the commands as parsed, the document stays with its owner and its allocator
 struct CommandsPayload {
-  JsonDocument data;
+  JsonDocument& data;
 };
 
 class CommandManager {
@@ -28,6 +44,18 @@ class CommandManager {
       {"switch_mode", CommandType::SWITCH_MODE},
       {"wipe_wifi_creds", CommandType::WIPE_WIFI_CREDS},
       {"restart_device", CommandType::RESTART_DEVICE},
+      {"set_stream_config", CommandType::SET_STREAM_CONFIG},
+      {"set_pupil_config", CommandType::SET_PUPIL_CONFIG},
+      {"set_radio_profile", CommandType::SET_RADIO_PROFILE},
+      {"run_radio_self_test", CommandType::RUN_RADIO_SELF_TEST},
+      {"get_trace", CommandType::GET_TRACE},
+      {"get_metrics", CommandType::GET_METRICS},
+      {"get_log", CommandType::GET_LOG},
+      {"set_log_level", CommandType::SET_LOG_LEVEL},
+      {"benchmark_log", CommandType::BENCHMARK_LOG},
+      {"get_snapshot", CommandType::GET_SNAPSHOT},
+      {"set_config", CommandType::SET_CONFIG},
+      {"get_memory", CommandType::GET_MEMORY},
   };
 
   ProjectConfig* deviceConfig;
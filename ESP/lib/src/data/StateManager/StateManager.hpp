@@ -29,7 +29,10 @@ struct DeviceStates {
     apConfigUpdated,
     wifiTxPowerUpdated,
     cameraConfigUpdated,
-    deviceModeUpdated
+    deviceModeUpdated,
+    streamConfigUpdated,
+    pupilConfigUpdated,
+    radioConfigUpdated
   };
 
   enum WiFiState_e {
@@ -0,0 +1,463 @@
+#include "configBatch.hpp"
+#include <algorithm>
+#include "network/api/otaUpdater.hpp"
+#include "network/wifihandler/radioProfiles.hpp"
+#include "sensor.h"
+
+static const struct {
+  ConfigBatch::Section_e section;
+  const char* key;
+} sectionKeys[] = {
+    {ConfigBatch::SECTION_DEVICE, "device_config"},
+    {ConfigBatch::SECTION_CAMERA, "camera_config"},
+    {ConfigBatch::SECTION_NETWORKS, "wifi_config"},
+    {ConfigBatch::SECTION_MDNS, "mdns_config"},
+    {ConfigBatch::SECTION_AP, "ap_wifi_config"},
+    {ConfigBatch::SECTION_TX_POWER, "wifi_tx_power"},
+    {ConfigBatch::SECTION_DEVICE_MODE, "device_mode"},
+    {ConfigBatch::SECTION_STREAM, "stream_config"},
+    {ConfigBatch::SECTION_PUPIL, "pupil_config"},
+    {ConfigBatch::SECTION_RADIO, "radio_config"},
+};
+
+ConfigBatch::ConfigBatch(ProjectConfig& config)
+    : config(config),
+      device(config.getDeviceConfig()),
+      camera(config.getCameraConfig()),
+      networks(config.getWifiConfigs()),
+      mdns(config.getMDNSConfig()),
+      ap(config.getAPWifiConfig()),
+      txPower(config.getWiFiTxPowerConfig()),
+      deviceMode(config.getDeviceModeConfig()),
+      stream(config.getStreamConfig()),
+      pupil(config.getPupilConfig()),
+      radio(config.getRadioConfig()),
+      sections(0),
+      current("") {}
+
+bool ConfigBatch::stage(JsonVariantConst document) {
+  MEMORY_SCOPE(MEMORY_MODULE_CONFIG);
+  current = "";
+  if (!document.is<JsonObjectConst>())
+    return this->fail(nullptr, "the config has to be a JSON object");
+
+  for (JsonPairConst pair : document.as<JsonObjectConst>()) {
+    const char* key = pair.key().c_str();
+    current = "";
+    Section_e section = static_cast<Section_e>(0);
+    for (const auto& entry : sectionKeys) {
+      if (strcmp(entry.key, key) == 0) {
+        section = entry.section;
+        current = entry.key;
+        break;
+      }
+    }
+    if (!section)
+      return this->fail(key, "is not a config section");
+
+    bool staged;
+    if (section == SECTION_NETWORKS) {
+      if (!pair.value().is<JsonArrayConst>())
+        return this->fail(nullptr, "has to be a list of networks");
+      staged = this->stageNetworks(pair.value().as<JsonArrayConst>());
+    } else {
+      if (!pair.value().is<JsonObjectConst>())
+        return this->fail(nullptr, "has to be an object");
+      JsonObjectConst object = pair.value().as<JsonObjectConst>();
+      switch (section) {
+        case SECTION_DEVICE:
+          staged = this->stageDevice(object);
+          break;
+        case SECTION_CAMERA:
+          staged = this->stageCamera(object);
+          break;
+        case SECTION_MDNS:
+          staged = this->stageMDNS(object);
+          break;
+        case SECTION_AP:
+          staged = this->stageAP(object);
+          break;
+        case SECTION_TX_POWER:
+          staged = this->stageTxPower(object);
+          break;
+        case SECTION_DEVICE_MODE:
+          staged = this->stageDeviceMode(object);
+          break;
+        case SECTION_STREAM:
+          staged = this->stageStream(object);
+          break;
+        case SECTION_PUPIL:
+          staged = this->stagePupil(object);
+          break;
+        default:
+          staged = this->stageRadio(object);
+          break;
+      }
+    }
+    if (!staged)
+      return false;
+    sections |= section;
+  }
+
+  // what set_wifi does, in AUTO_MODE the boot mode depends on it
+  if ((sections & SECTION_NETWORKS) && !(sections & SECTION_DEVICE_MODE)) {
+    deviceMode.hasWiFiCredentials = !networks.empty();
+    if (deviceMode.hasWiFiCredentials !=
+        config.getDeviceModeConfig().hasWiFiCredentials)
+      sections |= SECTION_DEVICE_MODE;
+  }
+  return true;
+}
+
+void ConfigBatch::commit(bool persist) {
+  MEMORY_SCOPE(MEMORY_MODULE_CONFIG);
+  if (!sections)
+    return;
+
+  if (sections & SECTION_DEVICE)
+    config.getDeviceConfig() = device;
+  if (sections & SECTION_CAMERA)
+    config.getCameraConfig() = camera;
+  if (sections & SECTION_NETWORKS)
+    config.getWifiConfigs() = networks;
+  if (sections & SECTION_MDNS)
+    config.getMDNSConfig() = mdns;
+  if (sections & SECTION_AP)
+    config.getAPWifiConfig() = ap;
+  if (sections & SECTION_TX_POWER)
+    config.getWiFiTxPowerConfig() = txPower;
+  if (sections & SECTION_DEVICE_MODE)
+    config.getDeviceModeConfig() = deviceMode;
+  if (sections & SECTION_STREAM)
+    config.getStreamConfig() = stream;
+  if (sections & SECTION_PUPIL)
+    config.getPupilConfig() = pupil;
+  if (sections & SECTION_RADIO)
+    config.getRadioConfig() = radio;
+
+  // on flash before the observers react, one of them may reconnect or restart
+  if (persist) {
+    config.reopen();
+    if (sections & SECTION_DEVICE)
+      config.deviceConfigSave();
+    if (sections & SECTION_CAMERA)
+      config.cameraConfigSave();
+    // the networks and the AP share their keys
+    if (sections & (SECTION_NETWORKS | SECTION_AP))
+      config.wifiConfigSave();
+    if (sections & SECTION_MDNS)
+      config.mdnsConfigSave();
+    if (sections & SECTION_TX_POWER)
+      config.wifiTxPowerConfigSave();
+    if (sections & SECTION_DEVICE_MODE)
+      config.deviceModeConfigSave();
+    if (sections & SECTION_STREAM)
+      config.streamConfigSave();
+    if (sections & SECTION_PUPIL)
+      config.pupilConfigSave();
+    if (sections & SECTION_RADIO)
+      config.radioConfigSave();
+    config.end();
+  }
+
+  log_i("[ConfigBatch]: Applying sections 0x%03x", (unsigned)sections);
+  if (sections & SECTION_DEVICE)
+    config.notifyAll(ConfigState_e::deviceConfigUpdated);
+  if (sections & SECTION_MDNS)
+    config.notifyAll(ConfigState_e::mdnsConfigUpdated);
+  // the radio profile before the networks, a reconnect picks it up then
+  if (sections & SECTION_RADIO)
+    config.notifyAll(ConfigState_e::radioConfigUpdated);
+  if (sections & (SECTION_NETWORKS | SECTION_AP)) {
+    wifiStateManager.setState(WiFiState_e::WiFiState_None);
+    config.notifyAll(ConfigState_e::networksConfigUpdated);
+  }
+  if (sections & SECTION_TX_POWER)
+    config.notifyAll(ConfigState_e::wifiTxPowerUpdated);
+  // the camera reconfigures on the pupil event as well, once is enough
+  if (sections & SECTION_PUPIL)
+    config.notifyAll(ConfigState_e::pupilConfigUpdated);
+  else if (sections & SECTION_CAMERA)
+    config.notifyAll(ConfigState_e::cameraConfigUpdated);
+  if (sections & SECTION_STREAM)
+    config.notifyAll(ConfigState_e::streamConfigUpdated);
+  if (sections & SECTION_DEVICE_MODE)
+    config.notifyAll(ConfigState_e::deviceModeUpdated);
+}
+
+std::string ConfigBatch::sectionsToJson() const {
+  std::string json = "[";
+  for (const auto& entry : sectionKeys) {
+    if (!(sections & entry.section))
+      continue;
+    if (json.size() > 1)
+      json += ", ";
+    json += "\"";
+    json += entry.key;
+    json += "\"";
+  }
+  json += "]";
+  return json;
+}
+
+bool ConfigBatch::stageDevice(JsonObjectConst section) {
+  return this->checkKeys(section, {"OTALogin", "OTAPassword", "OTAPort",
+                                   "OTABandwidthShare"}) &&
+         this->readString(section, "OTALogin", 1, 32, device.OTALogin) &&
+         this->readString(section, "OTAPassword", 0, 64, device.OTAPassword) &&
+         this->readNumber(section, "OTAPort", 1, 65535, device.OTAPort) &&
+         this->readNumber(section, "OTABandwidthShare", 0,
+                          OTA_MAX_BANDWIDTH_SHARE, device.OTABandwidthShare);
+}
+
+bool ConfigBatch::stageCamera(JsonObjectConst section) {
+  return this->checkKeys(section,
+                         {"vflip", "framesize", "href", "quality",
+                          "brightness", "fb_count", "grab_mode"}) &&
+         this->readNumber(section, "vflip", 0, 1, camera.vflip) &&
+         this->readNumber(section, "framesize", 0, FRAMESIZE_INVALID - 1,
+                          camera.framesize) &&
+         this->readNumber(section, "href", 0, 1, camera.href) &&
+         this->readNumber(section, "quality", 0, 63, camera.quality) &&
+         // goes to the sensor as the AGC gain
+         this->readNumber(section, "brightness", 0, 30, camera.brightness) &&
+         // 0 keeps the board default
+         this->readNumber(section, "fb_count", 0, 3, camera.fb_count) &&
+         this->readNumber(section, "grab_mode", 0, 1, camera.grab_mode);
+}
+
+bool ConfigBatch::stageNetworks(JsonArrayConst list) {
+  for (JsonVariantConst entry : list) {
+    if (!entry.is<JsonObjectConst>())
+      return this->fail(nullptr, "has to hold network objects");
+    JsonObjectConst network = entry.as<JsonObjectConst>();
+    if (!this->checkKeys(network, {"name", "ssid", "password", "channel",
+                                   "power", "adhoc"}))
+      return false;
+
+    std::string name;
+    if (network["name"].isNull())
+      return this->fail("name", "is required to match the network");
+    if (!this->readString(network, "name", 1, 32, name))
+      return false;
+
+    auto it = std::find_if(
+        networks.begin(), networks.end(),
+        [&name](const ProjectConfig::WiFiConfig_t& existing) {
+          return existing.name == name;
+        });
+    bool added = it == networks.end();
+    if (added) {
+      if (networks.size() >= CONFIG_MAX_NETWORKS)
+        return this->fail("name", "is a new network, there is no room left");
+      if (network["ssid"].isNull())
+        return this->fail("ssid", "is required for a new network");
+      networks.emplace_back(name, "", "", 0, 0, false);
+      it = networks.end() - 1;
+    }
+
+    if (!this->readString(network, "ssid", 1, 32, it->ssid) ||
+        !this->readString(network, "password", 0, 64, it->password) ||
+        !this->readNumber(network, "channel", 0, 14, it->channel) ||
+        !this->readNumber(network, "power", 0, 84, it->power) ||
+        !this->readBool(network, "adhoc", it->adhoc))
+      return false;
+  }
+  return true;
+}
+
+bool ConfigBatch::stageMDNS(JsonObjectConst section) {
+  return this->checkKeys(section, {"hostname", "service"}) &&
+         this->readString(section, "hostname", 1, 63, mdns.hostname) &&
+         this->readString(section, "service", 1, 63, mdns.service);
+}
+
+bool ConfigBatch::stageAP(JsonObjectConst section) {
+  if (!this->checkKeys(section, {"ssid", "password", "channel", "adhoc"}) ||
+      !this->readString(section, "ssid", 0, 32, ap.ssid) ||
+      !this->readString(section, "password", 0, 64, ap.password) ||
+      !this->readNumber(section, "channel", 1, 13, ap.channel) ||
+      !this->readBool(section, "adhoc", ap.adhoc))
+    return false;
+  // WPA2 wants at least 8 characters, an open AP none
+  if (!ap.password.empty() && ap.password.size() < 8)
+    return this->fail("password", "has to be empty or 8 to 64 characters");
+  return true;
+}
+
+bool ConfigBatch::stageTxPower(JsonObjectConst section) {
+  // esp_wifi_set_max_tx_power takes 8 to 84, in 0.25 dBm
+  return this->checkKeys(section, {"power"}) &&
+         this->readNumber(section, "power", 8, 84, txPower.power);
+}
+
+bool ConfigBatch::stageDeviceMode(JsonObjectConst section) {
+  int mode = static_cast<int>(deviceMode.mode);
+  if (!this->checkKeys(section, {"mode", "hasWiFiCredentials"}) ||
+      !this->readNumber(section, "mode", 0,
+                        static_cast<int>(DeviceMode::AUTO_MODE), mode) ||
+      !this->readBool(section, "hasWiFiCredentials",
+                      deviceMode.hasWiFiCredentials))
+    return false;
+  deviceMode.mode = static_cast<DeviceMode>(mode);
+  return true;
+}
+
+bool ConfigBatch::stageStream(JsonObjectConst section) {
+  return this->checkKeys(section, {"serialMetadata", "frameStats",
+                                   "suppressUnchanged", "suppressSizeDelta",
+                                   "suppressDCDelta", "maxKeyframeInterval"}) &&
+         this->readBool(section, "serialMetadata", stream.serialMetadata) &&
+         this->readBool(section, "frameStats", stream.frameStats) &&
+         this->readBool(section, "suppressUnchanged",
+                        stream.suppressUnchanged) &&
+         this->readNumber(section, "suppressSizeDelta", 0, 100,
+                          stream.suppressSizeDelta) &&
+         this->readNumber(section, "suppressDCDelta", 0, 255,
+                          stream.suppressDCDelta) &&
+         this->readNumber(section, "maxKeyframeInterval", 0, 65535,
+                          stream.maxKeyframeInterval);
+}
+
+bool ConfigBatch::stagePupil(JsonObjectConst section) {
+  if (!this->checkKeys(section,
+                       {"enabled", "threshold", "ellipseFit", "transport",
+                        "udpHost", "udpPort", "keyframeInterval"}) ||
+      !this->readBool(section, "enabled", pupil.enabled) ||
+      !this->readNumber(section, "threshold", 0, 255, pupil.threshold) ||
+      !this->readBool(section, "ellipseFit", pupil.ellipseFit) ||
+      !this->readString(section, "udpHost", 0, 63, pupil.udpHost) ||
+      !this->readNumber(section, "udpPort", 1, 65535, pupil.udpPort) ||
+      !this->readNumber(section, "keyframeInterval", 0, 65535,
+                        pupil.keyframeInterval))
+    return false;
+
+  // the stored config has the number, set_pupil_config takes the name
+  JsonVariantConst transport = section["transport"];
+  if (transport.is<const char*>()) {
+    const char* name = transport.as<const char*>();
+    if (strcmp(name, "serial") == 0)
+      pupil.transport = PupilTransport::SERIAL_OUTPUT;
+    else if (strcmp(name, "udp") == 0)
+      pupil.transport = PupilTransport::UDP_OUTPUT;
+    else
+      return this->fail("transport", "has to be \"serial\" or \"udp\"");
+  } else {
+    int value = static_cast<int>(pupil.transport);
+    if (!this->readNumber(section, "transport", 0,
+                          static_cast<int>(PupilTransport::UDP_OUTPUT), value))
+      return false;
+    pupil.transport = static_cast<PupilTransport>(value);
+  }
+
+  if (pupil.enabled && pupil.transport == PupilTransport::UDP_OUTPUT &&
+      pupil.udpHost.empty())
+    return this->fail("udpHost", "is required for the udp transport");
+  return true;
+}
+
+bool ConfigBatch::stageRadio(JsonObjectConst section) {
+  if (!this->checkKeys(section, {"profile"}))
+    return false;
+  JsonVariantConst profile = section["profile"];
+  if (profile.is<const char*>()) {
+    if (!RadioProfiles::fromName(profile.as<const char*>(), &radio.profile))
+      return this->fail("profile", "is not a radio profile");
+    return true;
+  }
+  int value = static_cast<int>(radio.profile);
+  if (!this->readNumber(section, "profile", 0,
+                        static_cast<int>(RadioProfile::LOW_POWER), value))
+    return false;
+  radio.profile = static_cast<RadioProfile>(value);
+  return true;
+}
+
+bool ConfigBatch::checkKeys(JsonObjectConst section,
+                            std::initializer_list<const char*> keys) {
+  for (JsonPairConst pair : section) {
+    const char* key = pair.key().c_str();
+    bool known = std::any_of(keys.begin(), keys.end(), [key](const char* k) {
+      return strcmp(k, key) == 0;
+    });
+    if (!known)
+      return this->fail(key, "is not a known field");
+  }
+  return true;
+}
+
+template <typename T>
+bool ConfigBatch::readNumber(JsonObjectConst section,
+                             const char* key,
+                             long min,
+                             long max,
+                             T& value) {
+  JsonVariantConst field = section[key];
+  if (field.isNull())
+    return true;
+  if (!field.is<long>())
+    return this->fail(key, "has to be a whole number");
+  long number = field.as<long>();
+  if (number < min || number > max) {
+    char reason[48];
+    snprintf(reason, sizeof(reason), "has to be between %ld and %ld", min,
+             max);
+    return this->fail(key, reason);
+  }
+  value = static_cast<T>(number);
+  return true;
+}
+
+bool ConfigBatch::readBool(JsonObjectConst section,
+                           const char* key,
+                           bool& value) {
+  JsonVariantConst field = section[key];
+  if (field.isNull())
+    return true;
+  // 0 / 1 pass too, the camera flags are stored as numbers
+  if (field.is<bool>()) {
+    value = field.as<bool>();
+  } else if (field.is<long>() &&
+             (field.as<long>() == 0 || field.as<long>() == 1)) {
+    value = field.as<long>() == 1;
+  } else {
+    return this->fail(key, "has to be true or false");
+  }
+  return true;
+}
+
+template <typename String>
+bool ConfigBatch::readString(JsonObjectConst section,
+                             const char* key,
+                             size_t minLength,
+                             size_t maxLength,
+                             String& value) {
+  JsonVariantConst field = section[key];
+  if (field.isNull())
+    return true;
+  if (!field.is<const char*>())
+    return this->fail(key, "has to be a string");
+  size_t length = strlen(field.as<const char*>());
+  if (length < minLength || length > maxLength) {
+    char reason[48];
+    snprintf(reason, sizeof(reason), "has to be %u to %u characters",
+             (unsigned)minLength, (unsigned)maxLength);
+    return this->fail(key, reason);
+  }
+  value = field.as<const char*>();
+  return true;
+}
+
+bool ConfigBatch::fail(const char* key, const char* reason) {
+  error = current;
+  if (key) {
+    if (!error.empty())
+      error += ".";
+    error += key;
+  }
+  if (!error.empty())
+    error += " ";
+  error += reason;
+  sections = 0;
+  return false;
+}
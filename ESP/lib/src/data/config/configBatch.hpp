@@ -0,0 +1,97 @@
+#pragma once
+#ifndef CONFIG_BATCH_HPP
+#define CONFIG_BATCH_HPP
+#include <ArduinoJson.h>
+#include <string>
+#include "data/config/project_config.hpp"
+
+//! largest POST /config body, a full config with three networks is ~1.2 KB
+#define CONFIG_BATCH_MAX_BODY 4096
+
+/**
+ * @brief Applies a whole or partial config in one go, behind POST /config and
+ * the set_config serial command
+ * @details The document has the getStoredConfig layout, so a stored config
+ * can be posted back as it is, plus "wifi_tx_power" and "device_mode".
+ * Every section and every field is optional, the ones left out keep their
+ * value. Networks in "wifi_config" are matched by name, updated or added.
+ *
+ * stage() validates everything into a copy first - with a single bad or
+ * unknown field nothing changes. commit() swaps the staged sections in,
+ * notifies the observers once per affected subsystem and saves only the
+ * changed sections.
+ */
+class ConfigBatch {
+ public:
+  enum Section_e {
+    SECTION_DEVICE = 1 << 0,
+    SECTION_CAMERA = 1 << 1,
+    SECTION_NETWORKS = 1 << 2,
+    SECTION_MDNS = 1 << 3,
+    SECTION_AP = 1 << 4,
+    SECTION_TX_POWER = 1 << 5,
+    SECTION_DEVICE_MODE = 1 << 6,
+    SECTION_STREAM = 1 << 7,
+    SECTION_PUPIL = 1 << 8,
+    SECTION_RADIO = 1 << 9,
+  };
+
+  explicit ConfigBatch(ProjectConfig& config);
+  //! false on the first invalid field, see getError()
+  bool stage(JsonVariantConst document);
+  //! @param persist false if the caller saves the whole config afterwards
+  void commit(bool persist);
+  const std::string& getError() const { return error; }
+  uint32_t getSections() const { return sections; }
+  //! the changed sections as a JSON array of their keys
+  std::string sectionsToJson() const;
+
+ private:
+  bool stageDevice(JsonObjectConst section);
+  bool stageCamera(JsonObjectConst section);
+  bool stageNetworks(JsonArrayConst networks);
+  bool stageMDNS(JsonObjectConst section);
+  bool stageAP(JsonObjectConst section);
+  bool stageTxPower(JsonObjectConst section);
+  bool stageDeviceMode(JsonObjectConst section);
+  bool stageStream(JsonObjectConst section);
+  bool stagePupil(JsonObjectConst section);
+  bool stageRadio(JsonObjectConst section);
+
+  bool checkKeys(JsonObjectConst section,
+                 std::initializer_list<const char*> keys);
+  template <typename T>
+  bool readNumber(JsonObjectConst section,
+                  const char* key,
+                  long min,
+                  long max,
+                  T& value);
+  bool readBool(JsonObjectConst section, const char* key, bool& value);
+  //! into a std::string or an InlineString
+  template <typename String>
+  bool readString(JsonObjectConst section,
+                  const char* key,
+                  size_t minLength,
+                  size_t maxLength,
+                  String& value);
+  bool fail(const char* key, const char* reason);
+
+  ProjectConfig& config;
+  ProjectConfig::DeviceConfig_t device;
+  ProjectConfig::CameraConfig_t camera;
+  std::vector<ProjectConfig::WiFiConfig_t> networks;
+  ProjectConfig::MDNSConfig_t mdns;
+  ProjectConfig::AP_WiFiConfig_t ap;
+  ProjectConfig::WiFiTxPower_t txPower;
+  ProjectConfig::DeviceModeConfig_t deviceMode;
+  ProjectConfig::StreamConfig_t stream;
+  ProjectConfig::PupilConfig_t pupil;
+  ProjectConfig::RadioConfig_t radio;
+
+  uint32_t sections;
+  //! key of the section being staged, for the error messages
+  const char* current;
+  std::string error;
+};
+
+#endif  // CONFIG_BATCH_HPP
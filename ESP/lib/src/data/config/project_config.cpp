@@ -1,6 +1,20 @@
 #include "project_config.hpp"
+#include "esp_camera.h"
 #include "sensor.h"
 
+/**
+ * @brief Zeroes a struct persisted as a blob, padding included
+ * @details The blobs are written byte for byte, whatever sits in the
+ * padding of DeviceConfig_t would end up in the NVS. Aggregate and member
+ * assignments leave the padding alone, so clear before filling them in.
+ */
+template <typename T>
+static void clearBlob(T& value) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "only the blob structs get cleared byte for byte");
+  memset(static_cast<void*>(&value), 0, sizeof(T));
+}
+
 ProjectConfig::ProjectConfig(const std::string& name,
                              const std::string& mdnsName)
     : _name(std::move(name)),
@@ -31,25 +45,25 @@ void ProjectConfig::initConfig() {
   ! Do not initialize the WiFiConfig_t struct here,
   ! as it will create a blank network which breaks the WiFiManager
    */
-  this->config.device = {OTA_LOGIN, OTA_PASSWORD, 3232};
+  clearBlob(this->config.device);
+  this->config.device.OTALogin = OTA_LOGIN;
+  this->config.device.OTAPassword = OTA_PASSWORD;
+  this->config.device.OTAPort = 3232;
+  this->config.device.OTABandwidthShare = 50;
 
   if (_mdnsName.empty()) {
     log_e("MDNS name is null\n Auto-assigning name to 'openiristracker'");
     _mdnsName = "openiristracker";
   }
-  this->config.mdns = {
-      _mdnsName,
-      "openiristracker",
-  };
+  clearBlob(this->config.mdns);
+  this->config.mdns.hostname = _mdnsName;
+  this->config.mdns.service = "openiristracker";
 
   log_i("[Project Config]: MDNS name: %s", _mdnsName.c_str());
 
-  this->config.ap_network = {
-      "",
-      "",
-      1,
-      false,
-  };
+  clearBlob(this->config.ap_network);
+  this->config.ap_network.channel = 1;
+  this->config.ap_network.adhoc = false;
 
   this->config.camera = {
       .vflip = 0,
@@ -57,6 +71,8 @@ void ProjectConfig::initConfig() {
       .framesize = (uint8_t)CAM_RESOLUTION,
       .quality = 7,
       .brightness = 2,
+      .fb_count = 0,
+      .grab_mode = CAMERA_GRAB_LATEST,
   };
   
   // Initialize device mode with default values
@@ -64,69 +80,118 @@ void ProjectConfig::initConfig() {
       .mode = DeviceMode::AUTO_MODE,
       .hasWiFiCredentials = false,
   };
+
+  this->config.stream = {
+      .serialMetadata = false,
+      .frameStats = false,
+      .suppressUnchanged = false,
+      .suppressSizeDelta = 3,
+      .suppressDCDelta = 4,
+      .maxKeyframeInterval = 60,
+  };
+
+  this->config.pupil = {
+      .enabled = false,
+      .threshold = 0,
+      .ellipseFit = true,
+      .transport = PupilTransport::SERIAL_OUTPUT,
+      .udpHost = "",
+      .udpPort = 7070,
+      .keyframeInterval = 300,
+  };
+
+  this->config.radio = {
+      .profile = RadioProfile::BALANCED,
+  };
+
+  this->config.lastNetwork = {
+      .ssid = "",
+      .bssid = {0},
+      .channel = 0,
+  };
 }
 
 void ProjectConfig::save() {
+  MEMORY_SCOPE(MEMORY_MODULE_CONFIG);
   log_d("Saving project config");
+  this->reopen();
   deviceConfigSave();
   mdnsConfigSave();
   cameraConfigSave();
   wifiConfigSave();
   wifiTxPowerConfigSave();
   deviceModeConfigSave();
+  streamConfigSave();
+  pupilConfigSave();
+  radioConfigSave();
+  lastNetworkSave();
   end();  // we call end() here to close the connection to the NVS partition
   // Removed automatic restart to allow explicit control via RESTART_DEVICE command
   // OpenIrisTasks::ScheduleRestart(2000);
 }
 
+/**
+ * @brief Opens the NVS namespace again after a save() closed it, the puts
+ * fail silently otherwise. A no-op while it is still open.
+ */
+void ProjectConfig::reopen() {
+  begin(_name.c_str());
+}
 
 void ProjectConfig::wifiConfigSave() {
   log_d("Saving wifi config");
 
   /* WiFi Config */
-  putInt("networkCount", this->config.networks.size());
-
-  std::string name = "name";
-  std::string ssid = "ssid";
-  std::string password = "pass";
-  std::string channel = "channel";
-  std::string power = "txpower";
-  for (int i = 0; i < this->config.networks.size(); i++) {
-    char buffer[2];
-    std::string iter_str = Helpers::itoa(i, buffer, 10);
-
-    name.append(iter_str);
-    ssid.append(iter_str);
-    password.append(iter_str);
-    channel.append(iter_str);
-    power.append(iter_str);
-
-    putString(name.c_str(), this->config.networks[i].name.c_str());
-    putString(ssid.c_str(), this->config.networks[i].ssid.c_str());
-    putString(password.c_str(), this->config.networks[i].password.c_str());
-    putUInt(channel.c_str(), this->config.networks[i].channel);
-    putUInt(power.c_str(), this->config.networks[i].power);
-  }
+  NetworksBlob_t blob;
+  clearBlob(blob);
+  blob.count = std::min(this->config.networks.size(),
+                        (size_t)CONFIG_MAX_NETWORKS);
+  std::copy_n(this->config.networks.begin(), blob.count, blob.networks);
+  putBlob("networks", &blob,
+          offsetof(NetworksBlob_t, networks) +
+              blob.count * sizeof(WiFiConfig_t));
 
   /* AP Config */
-  putString("apSSID", this->config.ap_network.ssid.c_str());
-  putString("apPass", this->config.ap_network.password.c_str());
-  putUInt("apChannel", this->config.ap_network.channel);
+  putBlob("apNetwork", &this->config.ap_network,
+          sizeof(this->config.ap_network));
 
   log_i("[Project Config]: Wifi configs saved");
 }
 
 void ProjectConfig::deviceConfigSave() {
   /* Device Config */
-  putString("OTAPassword", this->config.device.OTAPassword.c_str());
-  putString("OTALogin", this->config.device.OTALogin.c_str());
-  putInt("OTAPort", this->config.device.OTAPort);
+  putBlob("device", &this->config.device, sizeof(this->config.device));
 }
 
 void ProjectConfig::mdnsConfigSave() {
-  /* Device Config */
-  putString("hostname", this->config.mdns.hostname.c_str());
-  putString("service", this->config.mdns.service.c_str());
+  /* MDNS Config */
+  putBlob("mdns", &this->config.mdns, sizeof(this->config.mdns));
+}
+
+void ProjectConfig::putBlob(const char* key,
+                            const void* value,
+                            size_t length) {
+  putBytes(key, value, length);
+  // one version for all of the blobs, only written when it changes instead
+  // of once for every section of a save
+  if (getUChar("blobVersion") != CONFIG_BLOB_VERSION)
+    putUChar("blobVersion", CONFIG_BLOB_VERSION);
+}
+
+/**
+ * @brief Reads a struct persisted with putBlob
+ * @return the bytes read, 0 if there is no such blob, it is too long or it
+ * was written by a build with another layout
+ */
+size_t ProjectConfig::getBlob(const char* key,
+                              void* value,
+                              size_t maxLength) {
+  if (!isKey(key) || getUChar("blobVersion") != CONFIG_BLOB_VERSION)
+    return 0;
+  size_t length = getBytesLength(key);
+  if (length > maxLength)
+    return 0;
+  return getBytes(key, value, length);
 }
 
 void ProjectConfig::wifiTxPowerConfigSave() {
@@ -143,6 +208,40 @@ void ProjectConfig::deviceModeConfigSave() {
         this->config.deviceMode.hasWiFiCredentials);
 }
 
+void ProjectConfig::streamConfigSave() {
+  /* Stream Config */
+  putBool("serialMeta", this->config.stream.serialMetadata);
+  putBool("frameStats", this->config.stream.frameStats);
+  putBool("suppress", this->config.stream.suppressUnchanged);
+  putUInt("suppressSize", this->config.stream.suppressSizeDelta);
+  putUInt("suppressDC", this->config.stream.suppressDCDelta);
+  putUInt("keyframeMax", this->config.stream.maxKeyframeInterval);
+}
+
+void ProjectConfig::pupilConfigSave() {
+  /* Pupil Tracker Config */
+  putBool("pupilEnabled", this->config.pupil.enabled);
+  putUInt("pupilThresh", this->config.pupil.threshold);
+  putBool("pupilEllipse", this->config.pupil.ellipseFit);
+  putInt("pupilOutput", static_cast<int>(this->config.pupil.transport));
+  putString("pupilHost", this->config.pupil.udpHost.c_str());
+  putUInt("pupilPort", this->config.pupil.udpPort);
+  putUInt("pupilKeyframe", this->config.pupil.keyframeInterval);
+}
+
+void ProjectConfig::radioConfigSave() {
+  /* Radio Config */
+  putInt("radioProfile", static_cast<int>(this->config.radio.profile));
+}
+
+void ProjectConfig::lastNetworkSave() {
+  /* Last Network */
+  putString("lastSSID", this->config.lastNetwork.ssid.c_str());
+  putBytes("lastBSSID", this->config.lastNetwork.bssid,
+           sizeof(this->config.lastNetwork.bssid));
+  putUInt("lastChannel", this->config.lastNetwork.channel);
+}
+
 void ProjectConfig::cameraConfigSave() {
   /* Camera Config */
   putInt("vflip", this->config.camera.vflip);
@@ -150,6 +249,8 @@ void ProjectConfig::cameraConfigSave() {
   putInt("framesize", this->config.camera.framesize);
   putInt("quality", this->config.camera.quality);
   putInt("brightness", this->config.camera.brightness);
+  putInt("fbCount", this->config.camera.fb_count);
+  putInt("grabMode", this->config.camera.grab_mode);
 }
 
 bool ProjectConfig::reset() {
@@ -158,6 +259,7 @@ bool ProjectConfig::reset() {
 }
 
 void ProjectConfig::load() {
+  MEMORY_SCOPE(MEMORY_MODULE_CONFIG);
   log_d("Loading project config");
   if (this->_already_loaded) {
     log_w("Project config already loaded");
@@ -166,21 +268,114 @@ void ProjectConfig::load() {
 
   initConfig();
 
+  // the blobs, or the keys one value each they replace when a config from
+  // an older build hasn't been saved again yet
+
   /* Device Config */
-  this->config.device.OTALogin = getString("OTALogin", "openiris").c_str();
-  this->config.device.OTAPassword =
-      getString("OTAPassword", "12345678").c_str();
-  this->config.device.OTAPort = getInt("OTAPort", 3232);
+  DeviceConfig_t device;
+  clearBlob(device);
+  if (getBlob("device", &device, sizeof(device)) == sizeof(device)) {
+    this->config.device = device;
+  } else {
+    this->config.device.OTALogin = getString("OTALogin", "openiris").c_str();
+    this->config.device.OTAPassword =
+        getString("OTAPassword", "12345678").c_str();
+    this->config.device.OTAPort = getInt("OTAPort", 3232);
+    this->config.device.OTABandwidthShare = getUInt("OTAShare", 50);
+  }
 
   /* MDNS Config */
-  this->config.mdns.hostname = getString("hostname", _mdnsName.c_str()).c_str();
-  this->config.mdns.service = getString("service").c_str();
+  MDNSConfig_t mdns;
+  clearBlob(mdns);
+  if (getBlob("mdns", &mdns, sizeof(mdns)) == sizeof(mdns)) {
+    this->config.mdns = mdns;
+  } else {
+    this->config.mdns.hostname =
+        getString("hostname", _mdnsName.c_str()).c_str();
+    this->config.mdns.service = getString("service").c_str();
+  }
 
   /* Wifi TX Power Config */
   // 11dBm is the default value
   this->config.txpower.power = getUInt("txpower", 52);
 
   /* WiFi Config */
+  NetworksBlob_t blob;
+  clearBlob(blob);
+  size_t length = getBlob("networks", &blob, sizeof(blob));
+  if (length && length == offsetof(NetworksBlob_t, networks) +
+                               blob.count * sizeof(WiFiConfig_t)) {
+    this->config.networks.assign(blob.networks, blob.networks + blob.count);
+  } else {
+    this->loadLegacyNetworks();
+  }
+
+  /* AP Config */
+  AP_WiFiConfig_t ap;
+  clearBlob(ap);
+  if (getBlob("apNetwork", &ap, sizeof(ap)) == sizeof(ap)) {
+    this->config.ap_network = ap;
+  } else {
+    this->config.ap_network.ssid = getString("apSSID").c_str();
+    this->config.ap_network.password = getString("apPass").c_str();
+    this->config.ap_network.channel = getUInt("apChannel");
+  }
+
+  /* Camera Config */
+  this->config.camera.vflip = getInt("vflip", 0);
+  this->config.camera.href = getInt("href", 0);
+  this->config.camera.framesize = getInt("framesize", (uint8_t)CAM_RESOLUTION);
+  this->config.camera.quality = getInt("quality", 7);
+  this->config.camera.brightness = getInt("brightness", 2);
+  this->config.camera.fb_count = getInt("fbCount", 0);
+  this->config.camera.grab_mode = getInt("grabMode", CAMERA_GRAB_LATEST);
+  
+  /* Stream Config */
+  this->config.stream.serialMetadata = getBool("serialMeta", false);
+  this->config.stream.frameStats = getBool("frameStats", false);
+  this->config.stream.suppressUnchanged = getBool("suppress", false);
+  this->config.stream.suppressSizeDelta = getUInt("suppressSize", 3);
+  this->config.stream.suppressDCDelta = getUInt("suppressDC", 4);
+  this->config.stream.maxKeyframeInterval = getUInt("keyframeMax", 60);
+
+  /* Pupil Tracker Config */
+  this->config.pupil.enabled = getBool("pupilEnabled", false);
+  this->config.pupil.threshold = getUInt("pupilThresh", 0);
+  this->config.pupil.ellipseFit = getBool("pupilEllipse", true);
+  this->config.pupil.transport = static_cast<PupilTransport>(
+      getInt("pupilOutput", static_cast<int>(PupilTransport::SERIAL_OUTPUT)));
+  this->config.pupil.udpHost = getString("pupilHost").c_str();
+  this->config.pupil.udpPort = getUInt("pupilPort", 7070);
+  this->config.pupil.keyframeInterval = getUInt("pupilKeyframe", 300);
+
+  /* Radio Config */
+  this->config.radio.profile = static_cast<RadioProfile>(
+      getInt("radioProfile", static_cast<int>(RadioProfile::BALANCED)));
+
+  /* Last Network */
+  this->config.lastNetwork.ssid = getString("lastSSID").c_str();
+  getBytes("lastBSSID", this->config.lastNetwork.bssid,
+           sizeof(this->config.lastNetwork.bssid));
+  this->config.lastNetwork.channel = getUInt("lastChannel", 0);
+
+  int savedMode = getInt(MODE_KEY, static_cast<int>(DeviceMode::AUTO_MODE));
+  this->config.deviceMode.mode = static_cast<DeviceMode>(savedMode);
+  this->config.deviceMode.hasWiFiCredentials = getBool(HAS_WIFI_CREDS_KEY, false);
+  
+  if (this->config.deviceMode.mode == DeviceMode::AUTO_MODE) {
+    this->config.deviceMode.mode = determineMode();
+  }
+  
+  log_i("[ProjectConfig] Loaded device mode: %d, hasWiFiCredentials: %d", 
+        static_cast<int>(this->config.deviceMode.mode), 
+        this->config.deviceMode.hasWiFiCredentials);
+
+  this->_already_loaded = true;
+  this->notifyAll(ConfigState_e::configLoaded);
+}
+
+//! the networks as builds before the blobs stored them, a key per value
+void ProjectConfig::loadLegacyNetworks() {
   int networkCount = getInt("networkCount", 0);
   std::string name = "name";
   std::string ssid = "ssid";
@@ -209,33 +404,6 @@ void ProjectConfig::load() {
         false);  // false because the networks we store in the config are the
                  // ones we want the esp to connect to, rather than host as AP
   }
-
-  /* AP Config */
-  this->config.ap_network.ssid = getString("apSSID").c_str();
-  this->config.ap_network.password = getString("apPass").c_str();
-  this->config.ap_network.channel = getUInt("apChannel");
-
-  /* Camera Config */
-  this->config.camera.vflip = getInt("vflip", 0);
-  this->config.camera.href = getInt("href", 0);
-  this->config.camera.framesize = getInt("framesize", (uint8_t)CAM_RESOLUTION);
-  this->config.camera.quality = getInt("quality", 7);
-  this->config.camera.brightness = getInt("brightness", 2);
-  
-  int savedMode = getInt(MODE_KEY, static_cast<int>(DeviceMode::AUTO_MODE));
-  this->config.deviceMode.mode = static_cast<DeviceMode>(savedMode);
-  this->config.deviceMode.hasWiFiCredentials = getBool(HAS_WIFI_CREDS_KEY, false);
-  
-  if (this->config.deviceMode.mode == DeviceMode::AUTO_MODE) {
-    this->config.deviceMode.mode = determineMode();
-  }
-  
-  log_i("[ProjectConfig] Loaded device mode: %d, hasWiFiCredentials: %d", 
-        static_cast<int>(this->config.deviceMode.mode), 
-        this->config.deviceMode.hasWiFiCredentials);
-
-  this->_already_loaded = true;
-  this->notifyAll(ConfigState_e::configLoaded);
 }
 
 //**********************************************************************************************************************
@@ -248,20 +416,32 @@ void ProjectConfig::setDeviceConfig(const std::string& OTALogin,
                                     int OTAPort,
                                     bool shouldNotify) {
   log_d("Updating device config");
-  this->config.device.OTALogin.assign(OTALogin);
-  this->config.device.OTAPassword.assign(OTAPassword);
+  bool fits = this->config.device.OTALogin.assign(OTALogin);
+  fits &= this->config.device.OTAPassword.assign(OTAPassword);
+  if (!fits)
+    log_w("[Project Config]: OTA login or password too long, it got cut");
   this->config.device.OTAPort = OTAPort;
 
   if (shouldNotify)
     this->notifyAll(ConfigState_e::deviceConfigUpdated);
 }
 
+void ProjectConfig::setOTABandwidthShare(uint8_t share, bool shouldNotify) {
+  log_d("Updating OTA bandwidth share");
+  this->config.device.OTABandwidthShare = share;
+
+  if (shouldNotify)
+    this->notifyAll(ConfigState_e::deviceConfigUpdated);
+}
+
 void ProjectConfig::setMDNSConfig(const std::string& hostname,
                                   const std::string& service,
                                   bool shouldNotify) {
   log_d("Updating MDNS config");
-  this->config.mdns.hostname.assign(hostname);
-  this->config.mdns.service.assign(service);
+  bool fits = this->config.mdns.hostname.assign(hostname);
+  fits &= this->config.mdns.service.assign(service);
+  if (!fits)
+    log_w("[Project Config]: MDNS hostname or service too long, it got cut");
 
   if (shouldNotify)
     this->notifyAll(ConfigState_e::mdnsConfigUpdated);
@@ -285,6 +465,17 @@ void ProjectConfig::setCameraConfig(uint8_t vflip,
     this->notifyAll(ConfigState_e::cameraConfigUpdated);
 }
 
+void ProjectConfig::setCameraBufferConfig(uint8_t fb_count,
+                                          uint8_t grab_mode,
+                                          bool shouldNotify) {
+  log_d("Updating camera frame buffer config");
+  this->config.camera.fb_count = fb_count;
+  this->config.camera.grab_mode = grab_mode;
+
+  if (shouldNotify)
+    this->notifyAll(ConfigState_e::cameraConfigUpdated);
+}
+
 void ProjectConfig::setWifiConfig(const std::string& networkName,
                                   const std::string& ssid,
                                   const std::string& password,
@@ -292,6 +483,14 @@ void ProjectConfig::setWifiConfig(const std::string& networkName,
                                   uint8_t power,
                                   bool adhoc,
                                   bool shouldNotify) {
+  // a cut SSID or password would never connect
+  if (networkName.size() > CONFIG_NAME_LENGTH ||
+      ssid.size() > CONFIG_SSID_LENGTH ||
+      password.size() > CONFIG_PASSWORD_LENGTH) {
+    log_e("[Project Config]: Name, SSID or password too long, not storing it");
+    return;
+  }
+
   // we store the ADHOC flag as false because the networks we store in the
   // config are the ones we want the esp to connect to, rather than host as AP,
   // and here we're just updating them
@@ -379,11 +578,87 @@ void ProjectConfig::setWiFiTxPower(uint8_t power, bool shouldNotify) {
     this->notifyAll(ConfigState_e::wifiTxPowerUpdated);
 }
 
+void ProjectConfig::setStreamConfig(bool serialMetadata,
+                                    bool frameStats,
+                                    bool shouldNotify) {
+  this->config.stream.serialMetadata = serialMetadata;
+  this->config.stream.frameStats = frameStats;
+  log_d("Updating stream config");
+  if (shouldNotify)
+    this->notifyAll(ConfigState_e::streamConfigUpdated);
+}
+
+void ProjectConfig::setFrameSuppressionConfig(bool suppressUnchanged,
+                                              uint8_t suppressSizeDelta,
+                                              uint8_t suppressDCDelta,
+                                              uint16_t maxKeyframeInterval,
+                                              bool shouldNotify) {
+  this->config.stream.suppressUnchanged = suppressUnchanged;
+  this->config.stream.suppressSizeDelta = suppressSizeDelta;
+  this->config.stream.suppressDCDelta = suppressDCDelta;
+  this->config.stream.maxKeyframeInterval = maxKeyframeInterval;
+  log_d("Updating frame suppression config");
+  if (shouldNotify)
+    this->notifyAll(ConfigState_e::streamConfigUpdated);
+}
+
+/**
+ * @brief Remembers where we got connected, nobody observes it
+ * @return true if it differs from the stored one and needs saving
+ */
+bool ProjectConfig::setLastNetwork(const std::string& ssid,
+                                   const uint8_t* bssid,
+                                   uint8_t channel) {
+  LastNetwork_t& lastNetwork = this->config.lastNetwork;
+  if (lastNetwork.ssid == ssid && lastNetwork.channel == channel &&
+      memcmp(lastNetwork.bssid, bssid, sizeof(lastNetwork.bssid)) == 0)
+    return false;
+
+  lastNetwork.ssid = ssid;
+  memcpy(lastNetwork.bssid, bssid, sizeof(lastNetwork.bssid));
+  lastNetwork.channel = channel;
+  log_d("Updating last network");
+  return true;
+}
+
+void ProjectConfig::setPupilConfig(bool enabled,
+                                   uint8_t threshold,
+                                   bool ellipseFit,
+                                   PupilTransport transport,
+                                   const std::string& udpHost,
+                                   uint16_t udpPort,
+                                   uint16_t keyframeInterval,
+                                   bool shouldNotify) {
+  this->config.pupil.enabled = enabled;
+  this->config.pupil.threshold = threshold;
+  this->config.pupil.ellipseFit = ellipseFit;
+  this->config.pupil.transport = transport;
+  this->config.pupil.udpHost.assign(udpHost);
+  this->config.pupil.udpPort = udpPort;
+  this->config.pupil.keyframeInterval = keyframeInterval;
+  log_d("Updating pupil tracker config");
+  if (shouldNotify)
+    this->notifyAll(ConfigState_e::pupilConfigUpdated);
+}
+
+void ProjectConfig::setRadioConfig(RadioProfile profile, bool shouldNotify) {
+  this->config.radio.profile = profile;
+  log_d("Updating radio config");
+  if (shouldNotify)
+    this->notifyAll(ConfigState_e::radioConfigUpdated);
+}
+
 void ProjectConfig::setAPWifiConfig(const std::string& ssid,
                                     const std::string& password,
                                     uint8_t channel,
                                     bool adhoc,
                                     bool shouldNotify) {
+  if (ssid.size() > CONFIG_SSID_LENGTH ||
+      password.size() > CONFIG_PASSWORD_LENGTH) {
+    log_e("[Project Config]: Access point SSID or password too long");
+    return;
+  }
+
   this->config.ap_network.ssid.assign(ssid);
   this->config.ap_network.password.assign(password);
   this->config.ap_network.channel = channel;
@@ -399,61 +674,116 @@ void ProjectConfig::setAPWifiConfig(const std::string& ssid,
   }
 }
 
-std::string ProjectConfig::DeviceConfig_t::toRepresentation() {
-  std::string json = Helpers::format_string(
-      "\"device_config\": {\"OTALogin\": \"%s\", \"OTAPassword\": \"%s\", "
-      "\"OTAPort\": %u}",
-      this->OTALogin.c_str(), this->OTAPassword.c_str(), this->OTAPort);
-  return json;
+//! the representations print straight into the output, an HTTP response
+//! stream gets the config without it ever being held as one string
+
+void ProjectConfig::DeviceConfig_t::writeJson(Print& out) const {
+  out.print("\"device_config\": {\"OTALogin\": ");
+  JsonWriter::writeString(out, this->OTALogin);
+  out.print(", \"OTAPassword\": ");
+  JsonWriter::writeString(out, this->OTAPassword);
+  out.printf(", \"OTAPort\": %u, \"OTABandwidthShare\": %u}", this->OTAPort,
+             this->OTABandwidthShare);
 }
 
-std::string ProjectConfig::MDNSConfig_t::toRepresentation() {
-  std::string json = Helpers::format_string(
-      "\"mdns_config\": {\"hostname\": \"%s\", \"service\": \"%s\"}",
-      this->hostname.c_str(), this->service.c_str());
-  return json;
+void ProjectConfig::MDNSConfig_t::writeJson(Print& out) const {
+  out.print("\"mdns_config\": {\"hostname\": ");
+  JsonWriter::writeString(out, this->hostname);
+  out.print(", \"service\": ");
+  JsonWriter::writeString(out, this->service);
+  out.print("}");
 }
 
-std::string ProjectConfig::CameraConfig_t::toRepresentation() {
-  std::string json = Helpers::format_string(
+void ProjectConfig::CameraConfig_t::writeJson(Print& out) const {
+  out.printf(
       "\"camera_config\": {\"vflip\": %d,\"framesize\": %d,\"href\": "
-      "%d,\"quality\": %d,\"brightness\": %d}",
+      "%d,\"quality\": %d,\"brightness\": %d,\"fb_count\": %d,"
+      "\"grab_mode\": %d}",
       this->vflip, this->framesize, this->href, this->quality,
-      this->brightness);
-  return json;
-}
-
-std::string ProjectConfig::WiFiConfig_t::toRepresentation() {
-  std::string json = Helpers::format_string(
-      "{\"name\": \"%s\", \"ssid\": \"%s\", \"password\": \"%s\", "
-      "\"channel\": "
-      "%u, \"power\": %u,\"adhoc\": %s}",
-      this->name.c_str(), this->ssid.c_str(), this->password.c_str(),
-      this->channel, this->power, this->adhoc ? "true" : "false");
-  return json;
-}
-
-std::string ProjectConfig::AP_WiFiConfig_t::toRepresentation() {
-  std::string json = Helpers::format_string(
-      "\"ap_wifi_config\": {\"ssid\": \"%s\", \"password\": \"%s\", "
-      "\"channel\": %u, \"adhoc\": %s}",
-      this->ssid.c_str(), this->password.c_str(), this->channel,
-      this->adhoc ? "true" : "false");
-  return json;
-}
-
-std::string ProjectConfig::WiFiTxPower_t::toRepresentation() {
-  std::string json =
-      Helpers::format_string("\"wifi_tx_power\": {\"power\": %u}", this->power);
-  return json;
-}
-
-std::string ProjectConfig::DeviceModeConfig_t::toRepresentation() {
-  std::string json = Helpers::format_string(
-      "\"device_mode\": {\"mode\": %d, \"hasWiFiCredentials\": %s}",
-      static_cast<int>(this->mode),
-      this->hasWiFiCredentials ? "true" : "false");
-  return json;
+      this->brightness, this->fb_count, this->grab_mode);
+}
+
+void ProjectConfig::WiFiConfig_t::writeJson(Print& out) const {
+  out.print("{\"name\": ");
+  JsonWriter::writeString(out, this->name);
+  out.print(", \"ssid\": ");
+  JsonWriter::writeString(out, this->ssid);
+  out.print(", \"password\": ");
+  JsonWriter::writeString(out, this->password);
+  out.printf(", \"channel\": %u, \"power\": %u,\"adhoc\": %s}",
+             this->channel, this->power, JsonWriter::boolean(this->adhoc));
+}
+
+void ProjectConfig::AP_WiFiConfig_t::writeJson(Print& out) const {
+  out.print("\"ap_wifi_config\": {\"ssid\": ");
+  JsonWriter::writeString(out, this->ssid);
+  out.print(", \"password\": ");
+  JsonWriter::writeString(out, this->password);
+  out.printf(", \"channel\": %u, \"adhoc\": %s}", this->channel,
+             JsonWriter::boolean(this->adhoc));
+}
+
+void ProjectConfig::WiFiTxPower_t::writeJson(Print& out) const {
+  out.printf("\"wifi_tx_power\": {\"power\": %u}", this->power);
+}
+
+void ProjectConfig::DeviceModeConfig_t::writeJson(Print& out) const {
+  out.printf("\"device_mode\": {\"mode\": %d, \"hasWiFiCredentials\": %s}",
+             static_cast<int>(this->mode),
+             JsonWriter::boolean(this->hasWiFiCredentials));
+}
+
+void ProjectConfig::StreamConfig_t::writeJson(Print& out) const {
+  out.printf(
+      "\"stream_config\": {\"serialMetadata\": %s, \"frameStats\": %s, "
+      "\"suppressUnchanged\": %s, \"suppressSizeDelta\": %u, "
+      "\"suppressDCDelta\": %u, \"maxKeyframeInterval\": %u}",
+      JsonWriter::boolean(this->serialMetadata),
+      JsonWriter::boolean(this->frameStats),
+      JsonWriter::boolean(this->suppressUnchanged), this->suppressSizeDelta,
+      this->suppressDCDelta, this->maxKeyframeInterval);
+}
+
+void ProjectConfig::PupilConfig_t::writeJson(Print& out) const {
+  out.printf(
+      "\"pupil_config\": {\"enabled\": %s, \"threshold\": %u, "
+      "\"ellipseFit\": %s, \"transport\": %d, \"udpHost\": ",
+      JsonWriter::boolean(this->enabled), this->threshold,
+      JsonWriter::boolean(this->ellipseFit),
+      static_cast<int>(this->transport));
+  JsonWriter::writeString(out, this->udpHost);
+  out.printf(", \"udpPort\": %u, \"keyframeInterval\": %u}", this->udpPort,
+             this->keyframeInterval);
+}
+
+void ProjectConfig::RadioConfig_t::writeJson(Print& out) const {
+  out.printf("\"radio_config\": {\"profile\": %d}",
+             static_cast<int>(this->profile));
+}
+
+void ProjectConfig::writeJson(Print& out) {
+  // same sections and order getStoredConfig always answered with
+  out.print("{");
+  this->config.device.writeJson(out);
+  out.print(", ");
+  this->config.camera.writeJson(out);
+  out.print(", \"wifi_config\": [");
+  for (size_t i = 0; i < this->config.networks.size(); i++) {
+    if (i)
+      out.print(",");
+    this->config.networks[i].writeJson(out);
+  }
+  out.print("], ");
+  this->config.mdns.writeJson(out);
+  out.print(", ");
+  this->config.ap_network.writeJson(out);
+  out.print(", ");
+  this->config.stream.writeJson(out);
+  out.print(", ");
+  this->config.pupil.writeJson(out);
+  out.print(", ");
+  this->config.radio.writeJson(out);
+  out.print("}");
 }
 
 //**********************************************************************************************************************
@@ -485,6 +815,22 @@ ProjectConfig::DeviceModeConfig_t& ProjectConfig::getDeviceModeConfig() {
   return this->config.deviceMode;
 }
 
+ProjectConfig::StreamConfig_t& ProjectConfig::getStreamConfig() {
+  return this->config.stream;
+}
+
+ProjectConfig::PupilConfig_t& ProjectConfig::getPupilConfig() {
+  return this->config.pupil;
+}
+
+ProjectConfig::RadioConfig_t& ProjectConfig::getRadioConfig() {
+  return this->config.radio;
+}
+
+ProjectConfig::LastNetwork_t& ProjectConfig::getLastNetwork() {
+  return this->config.lastNetwork;
+}
+
 void ProjectConfig::setDeviceMode(DeviceMode mode, bool shouldNotify) {
   this->config.deviceMode.mode = mode;
   putInt(MODE_KEY, static_cast<int>(mode));
@@ -10,9 +10,24 @@
 #include "data/StateManager/StateManager.hpp"
 #include "data/utilities/Observer.hpp"
 #include "data/utilities/helpers.hpp"
+#include "data/utilities/inlineString.hpp"
+#include "data/utilities/jsonWriter.hpp"
+#include "data/utilities/memoryTelemetry.hpp"
 #include "data/utilities/network_utilities.hpp"
 #include "tasks/tasks.hpp"
 
+//! the longest values the protocols allow - 802.11 SSIDs, WPA passphrases
+//! and DNS labels - longer ones get cut
+#define CONFIG_SSID_LENGTH 32
+#define CONFIG_PASSWORD_LENGTH 64
+#define CONFIG_HOSTNAME_LENGTH 63
+//! network names and the OTA login
+#define CONFIG_NAME_LENGTH 32
+//! stored networks, the hardcoded one comes on top
+#define CONFIG_MAX_NETWORKS 3
+//! bumped whenever a struct persisted as a blob changes its layout
+#define CONFIG_BLOB_VERSION 1
+
 // Enum to represent the device operating mode
 enum class DeviceMode {
   USB_MODE,    // Device operates in USB mode only
@@ -21,6 +36,19 @@ enum class DeviceMode {
   AUTO_MODE    // Device automatically selects mode based on saved credentials
 };
 
+// Enum to represent where the pupil tracker sends its results
+enum class PupilTransport {
+  SERIAL_OUTPUT,  // Results go out over the serial / USB CDC port
+  UDP_OUTPUT      // Results go out as UDP datagrams to a configured host
+};
+
+// Enum to represent the radio profile, see RadioProfiles for the settings
+enum class RadioProfile {
+  LOWEST_LATENCY,  // 11g/n only, HT40, no power save
+  BALANCED,        // 11b/g/n, HT20, no power save
+  LOW_POWER        // 11b/g/n, HT20, modem sleep, capped TX power
+};
+
 class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
  public:
   ProjectConfig(const std::string& name = std::string(),
@@ -28,25 +56,35 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
   virtual ~ProjectConfig();
   void load();
   void save();
+  void reopen();
   void wifiConfigSave();
   void cameraConfigSave();
   void deviceConfigSave();
   void mdnsConfigSave();
   void wifiTxPowerConfigSave();
+  void streamConfigSave();
+  void pupilConfigSave();
+  void radioConfigSave();
+  void lastNetworkSave();
   bool reset();
   void initConfig();
 
+  //! the structs holding strings are trivially copyable, a copy is a memcpy
+  //! and they're persisted as they are in memory
   struct DeviceConfig_t {
-    std::string OTALogin;
-    std::string OTAPassword;
+    InlineString<CONFIG_NAME_LENGTH> OTALogin;
+    InlineString<CONFIG_PASSWORD_LENGTH> OTAPassword;
     int OTAPort;
-    std::string toRepresentation();
+    //! percent of the air time an update download gets from a running
+    //! stream, 0 leaves the stream as it is
+    uint8_t OTABandwidthShare;
+    void writeJson(Print& out) const;
   };
 
   struct MDNSConfig_t {
-    std::string hostname;
-    std::string service;
-    std::string toRepresentation();
+    InlineString<CONFIG_HOSTNAME_LENGTH> hostname;
+    InlineString<CONFIG_HOSTNAME_LENGTH> service;
+    void writeJson(Print& out) const;
   };
 
   struct CameraConfig_t {
@@ -55,11 +93,16 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
     uint8_t framesize;
     uint8_t quality;
     uint8_t brightness;
+    //! 0 picks the board default - 3 with PSRAM, 2 without
+    uint8_t fb_count;
+    //! camera_grab_mode_t - 0 = CAMERA_GRAB_WHEN_EMPTY, 1 = CAMERA_GRAB_LATEST
+    uint8_t grab_mode;
 
-    std::string toRepresentation();
+    void writeJson(Print& out) const;
   };
 
   struct WiFiConfig_t {
+    WiFiConfig_t() : channel(0), power(0), adhoc(false) {}
     //! Constructor for WiFiConfig_t - allows us to use emplace_back
     WiFiConfig_t(const std::string& name,
                  const std::string& ssid,
@@ -67,39 +110,81 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
                  uint8_t channel,
                  uint8_t power,
                  bool adhoc)
-        : name(std::move(name)),
-          ssid(std::move(ssid)),
-          password(std::move(password)),
+        : name(name),
+          ssid(ssid),
+          password(password),
           channel(channel),
-          adhoc(adhoc),
-          power(power) {}
-    std::string name;
-    std::string ssid;
-    std::string password;
+          power(power),
+          adhoc(adhoc) {}
+    InlineString<CONFIG_NAME_LENGTH> name;
+    InlineString<CONFIG_SSID_LENGTH> ssid;
+    InlineString<CONFIG_PASSWORD_LENGTH> password;
     uint8_t channel;
     uint8_t power;
     bool adhoc;
 
-    std::string toRepresentation();
+    void writeJson(Print& out) const;
   };
 
   struct AP_WiFiConfig_t {
-    std::string ssid;
-    std::string password;
+    InlineString<CONFIG_SSID_LENGTH> ssid;
+    InlineString<CONFIG_PASSWORD_LENGTH> password;
     uint8_t channel;
     bool adhoc;
-    std::string toRepresentation();
+    void writeJson(Print& out) const;
   };
 
   struct WiFiTxPower_t {
     uint8_t power;
-    std::string toRepresentation();
+    void writeJson(Print& out) const;
   };
 
   struct DeviceModeConfig_t {
     DeviceMode mode;
     bool hasWiFiCredentials;
-    std::string toRepresentation();
+    void writeJson(Print& out) const;
+  };
+
+  struct StreamConfig_t {
+    //! send a FrameMetadata_t packet ahead of every serial frame
+    bool serialMetadata;
+    //! compute brightness stats from the JPEG DC coefficients of every frame
+    bool frameStats;
+    //! replace near-duplicate frames with a tiny "unchanged" marker
+    bool suppressUnchanged;
+    //! JPEG size change, in percent, above which a frame counts as changed
+    uint8_t suppressSizeDelta;
+    //! brightness change of any sampled DC cell above which a frame counts as
+    //! changed
+    uint8_t suppressDCDelta;
+    //! a full frame is sent at least every that many frames, 0 - never forced
+    uint16_t maxKeyframeInterval;
+    void writeJson(Print& out) const;
+  };
+
+  struct PupilConfig_t {
+    bool enabled;
+    //! 0 picks the threshold from every frame
+    uint8_t threshold;
+    bool ellipseFit;
+    PupilTransport transport;
+    std::string udpHost;
+    uint16_t udpPort;
+    //! results between two full keyframes, 0 disables them
+    uint16_t keyframeInterval;
+    void writeJson(Print& out) const;
+  };
+
+  struct RadioConfig_t {
+    RadioProfile profile;
+    void writeJson(Print& out) const;
+  };
+
+  //! the access point we last got an IP from, tried first on the next boot
+  struct LastNetwork_t {
+    std::string ssid;
+    uint8_t bssid[6];
+    uint8_t channel;
   };
 
   struct TrackerConfig_t {
@@ -110,6 +195,10 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
     MDNSConfig_t mdns;
     WiFiTxPower_t txpower;
     DeviceModeConfig_t deviceMode;
+    StreamConfig_t stream;
+    PupilConfig_t pupil;
+    RadioConfig_t radio;
+    LastNetwork_t lastNetwork;
   };
 
   DeviceConfig_t& getDeviceConfig();
@@ -119,11 +208,18 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
   MDNSConfig_t& getMDNSConfig();
   WiFiTxPower_t& getWiFiTxPowerConfig();
   DeviceModeConfig_t& getDeviceModeConfig();
+  StreamConfig_t& getStreamConfig();
+  PupilConfig_t& getPupilConfig();
+  RadioConfig_t& getRadioConfig();
+  LastNetwork_t& getLastNetwork();
+  //! the stored config as getStoredConfig answers with it
+  void writeJson(Print& out);
 
   void setDeviceConfig(const std::string& OTALogin,
                        const std::string& OTAPassword,
                        int OTAPort,
                        bool shouldNotify);
+  void setOTABandwidthShare(uint8_t share, bool shouldNotify);
   void setMDNSConfig(const std::string& hostname,
                      const std::string& service,
                      bool shouldNotify);
@@ -133,6 +229,9 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
                        uint8_t quality,
                        uint8_t brightness,
                        bool shouldNotify);
+  void setCameraBufferConfig(uint8_t fb_count,
+                             uint8_t grab_mode,
+                             bool shouldNotify);
   void setWifiConfig(const std::string& networkName,
                      const std::string& ssid,
                      const std::string& password,
@@ -146,6 +245,27 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
                        bool adhoc,
                        bool shouldNotify);
   void setWiFiTxPower(uint8_t power, bool shouldNotify);
+  void setStreamConfig(bool serialMetadata,
+                       bool frameStats,
+                       bool shouldNotify);
+  void setFrameSuppressionConfig(bool suppressUnchanged,
+                                 uint8_t suppressSizeDelta,
+                                 uint8_t suppressDCDelta,
+                                 uint16_t maxKeyframeInterval,
+                                 bool shouldNotify);
+  void setPupilConfig(bool enabled,
+                      uint8_t threshold,
+                      bool ellipseFit,
+                      PupilTransport transport,
+                      const std::string& udpHost,
+                      uint16_t udpPort,
+                      uint16_t keyframeInterval,
+                      bool shouldNotify);
+  void setRadioConfig(RadioProfile profile, bool shouldNotify);
+
+  bool setLastNetwork(const std::string& ssid,
+                      const uint8_t* bssid,
+                      uint8_t channel);
 
   void deleteWifiConfig(const std::string& networkName, bool shouldNotify);
   
@@ -158,6 +278,16 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
   void deviceModeConfigSave();
 
  private:
+  //! the stored networks as one blob, only count of them get written
+  struct NetworksBlob_t {
+    uint8_t count;
+    WiFiConfig_t networks[CONFIG_MAX_NETWORKS];
+  };
+
+  void putBlob(const char* key, const void* value, size_t length);
+  size_t getBlob(const char* key, void* value, size_t maxLength);
+  void loadLegacyNetworks();
+
   TrackerConfig_t config;
   std::string _name;
   std::string _mdnsName;
@@ -168,4 +298,13 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
   const char* HAS_WIFI_CREDS_KEY = "has_wifi_creds";
 };
 
+static_assert(std::is_trivially_copyable<ProjectConfig::DeviceConfig_t>::value,
+              "DeviceConfig_t is persisted as a blob");
+static_assert(std::is_trivially_copyable<ProjectConfig::MDNSConfig_t>::value,
+              "MDNSConfig_t is persisted as a blob");
+static_assert(std::is_trivially_copyable<ProjectConfig::WiFiConfig_t>::value,
+              "WiFiConfig_t is persisted as a blob");
+static_assert(std::is_trivially_copyable<ProjectConfig::AP_WiFiConfig_t>::value,
+              "AP_WiFiConfig_t is persisted as a blob");
+
 #endif  // PROJECT_CONFIG_HPP
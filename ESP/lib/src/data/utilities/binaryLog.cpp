@@ -0,0 +1,358 @@
+#include "binaryLog.hpp"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+BinaryLog binaryLog;
+
+#define RECORD_HEADER_SIZE 16
+
+//! indexed by LogModule_e
+static const char* const MODULE_NAMES[LOG_MODULE_COUNT] = {
+    "stream", "serial", "api", "camera", "wifi",
+};
+
+static const char LEVEL_LETTERS[] = {'N', 'E', 'W', 'I', 'D', 'V'};
+//! indexed by LogLevel_e
+static const char* const LEVEL_NAMES[] = {
+    "none", "error", "warn", "info", "debug", "verbose",
+};
+
+BinaryLog::BinaryLog()
+    : lock(portMUX_INITIALIZER_UNLOCKED),
+      head(0),
+      tail(0),
+      used(0),
+      written(0),
+      dropped(0) {
+  for (auto& level : levels)
+    level = LOG_LEVEL_INFO;
+}
+
+void BinaryLog::setLevel(LogModule_e module, LogLevel_e level) {
+  levels[module] = level;
+}
+
+const char* BinaryLog::getModuleName(LogModule_e module) {
+  return module < LOG_MODULE_COUNT ? MODULE_NAMES[module] : "?";
+}
+
+bool BinaryLog::moduleFromName(const std::string& name, LogModule_e* module) {
+  for (size_t i = 0; i < LOG_MODULE_COUNT; i++) {
+    if (name == MODULE_NAMES[i]) {
+      *module = static_cast<LogModule_e>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BinaryLog::levelFromName(const std::string& name, LogLevel_e* level) {
+  for (size_t i = 0; i <= LOG_LEVEL_VERBOSE; i++) {
+    if (name == LEVEL_NAMES[i] || name == std::to_string(i)) {
+      *level = static_cast<LogLevel_e>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t BinaryLog::beginRecord(uint8_t* record,
+                              LogModule_e module,
+                              LogLevel_e level,
+                              const char* format,
+                              size_t argc) {
+  uint64_t timestamp = esp_timer_get_time();
+  uint32_t address = (uint32_t)(uintptr_t)format;
+  record[1] = module;
+  record[2] = level;
+  record[3] = argc;
+  memcpy(record + 4, &timestamp, sizeof(timestamp));
+  memcpy(record + 12, &address, sizeof(address));
+  return RECORD_HEADER_SIZE;
+}
+
+size_t BinaryLog::encodeBytes(uint8_t* record,
+                              size_t len,
+                              char tag,
+                              const void* value,
+                              size_t size) {
+  if (len + 1 + size > BINARY_LOG_MAX_RECORD)
+    return len;
+  record[len] = tag;
+  memcpy(record + len + 1, value, size);
+  return len + 1 + size;
+}
+
+size_t BinaryLog::encodeString(uint8_t* record,
+                               size_t len,
+                               const char* value) {
+  if (!value)
+    value = "(null)";
+  size_t size = strnlen(value, BINARY_LOG_MAX_STRING);
+  if (len + 2 > BINARY_LOG_MAX_RECORD)
+    return len;
+  size = min(size, BINARY_LOG_MAX_RECORD - len - 2);
+  record[len] = 'S';
+  record[len + 1] = size;
+  memcpy(record + len + 2, value, size);
+  return len + 2 + size;
+}
+
+void BinaryLog::push(const uint8_t* record, size_t len) {
+  portENTER_CRITICAL(&lock);
+  // make room by dropping whole records off the tail
+  while (BINARY_LOG_SIZE - used < len) {
+    size_t oldest = buffer[tail];
+    tail = (tail + oldest) % BINARY_LOG_SIZE;
+    used -= oldest;
+    dropped++;
+  }
+  size_t first = min(len, (size_t)BINARY_LOG_SIZE - head);
+  memcpy(buffer + head, record, first);
+  memcpy(buffer, record + first, len - first);
+  head = (head + len) % BINARY_LOG_SIZE;
+  used += len;
+  written += len;
+  portEXIT_CRITICAL(&lock);
+}
+
+size_t BinaryLog::copyRecords(uint8_t* out, uint32_t* end) {
+  portENTER_CRITICAL(&lock);
+  size_t len = used;
+  size_t first = min(len, (size_t)BINARY_LOG_SIZE - tail);
+  memcpy(out, buffer + tail, first);
+  memcpy(out + first, buffer, len - first);
+  *end = written;
+  portEXIT_CRITICAL(&lock);
+  return len;
+}
+
+void BinaryLog::clear() {
+  portENTER_CRITICAL(&lock);
+  head = 0;
+  tail = 0;
+  used = 0;
+  written = 0;
+  dropped = 0;
+  portEXIT_CRITICAL(&lock);
+}
+
+void BinaryLog::drain(Print& out) {
+  std::unique_ptr<uint8_t[]> records(new uint8_t[BINARY_LOG_SIZE]);
+  uint32_t end = 0;
+  uint32_t droppedRecords = dropped;
+  size_t len = this->copyRecords(records.get(), &end);
+
+  char line[256];
+  for (size_t offset = 0; offset < len; offset += records[offset]) {
+    size_t lineLen = formatRecord(records.get() + offset, line, sizeof(line));
+    out.write((const uint8_t*)line, min(lineLen, sizeof(line) - 1));
+    out.write('\n');
+  }
+  if (droppedRecords)
+    out.printf("[binlog] %u records overwritten before this drain\n",
+               droppedRecords);
+
+  // only up to what got copied, records logged meanwhile stay. The tail may
+  // have moved past that in the meantime, both are on record boundaries
+  portENTER_CRITICAL(&lock);
+  uint32_t oldest = written - used;
+  if ((int32_t)(end - oldest) > 0) {
+    size_t consumed = end - oldest;
+    tail = (tail + consumed) % BINARY_LOG_SIZE;
+    used -= consumed;
+  }
+  dropped -= min(droppedRecords, (uint32_t)dropped);
+  portEXIT_CRITICAL(&lock);
+}
+
+void BinaryLog::dumpRaw(Print& out) {
+  std::unique_ptr<uint8_t[]> records(new uint8_t[BINARY_LOG_SIZE]);
+  uint32_t end = 0;
+  size_t len = this->copyRecords(records.get(), &end);
+
+  // "OIBL", version, records overwritten
+  uint32_t droppedRecords = dropped;
+  out.write((const uint8_t*)"OIBL\x01", 5);
+  out.write((const uint8_t*)&droppedRecords, sizeof(droppedRecords));
+
+  for (uint8_t i = 0; i < LOG_MODULE_COUNT; i++) {
+    uint8_t nameLen = strlen(MODULE_NAMES[i]);
+    out.write('M');
+    out.write(i);
+    out.write(nameLen);
+    out.write((const uint8_t*)MODULE_NAMES[i], nameLen);
+  }
+
+  // every format string referenced, once
+  std::vector<uint32_t> formats;
+  for (size_t offset = 0; offset < len; offset += records[offset]) {
+    uint32_t address;
+    memcpy(&address, records.get() + offset + 12, sizeof(address));
+    if (std::find(formats.begin(), formats.end(), address) != formats.end())
+      continue;
+    formats.push_back(address);
+    const char* format = (const char*)(uintptr_t)address;
+    uint16_t formatLen = strlen(format);
+    out.write('F');
+    out.write((const uint8_t*)&address, sizeof(address));
+    out.write((const uint8_t*)&formatLen, sizeof(formatLen));
+    out.write((const uint8_t*)format, formatLen);
+  }
+
+  for (size_t offset = 0; offset < len; offset += records[offset]) {
+    out.write('R');
+    out.write(records.get() + offset, records[offset]);
+  }
+}
+
+/**
+ * @brief printf over the stored arguments, one conversion at a time
+ * @details Length modifiers in the format are ignored, the stored type
+ * decides. Conversions without an argument are printed as they are.
+ */
+size_t BinaryLog::formatRecord(const uint8_t* record, char* out, size_t outLen) {
+  uint64_t timestamp;
+  uint32_t address;
+  memcpy(&timestamp, record + 4, sizeof(timestamp));
+  memcpy(&address, record + 12, sizeof(address));
+  uint8_t level = min(record[2], (uint8_t)LOG_LEVEL_VERBOSE);
+
+  size_t len = 0;
+  auto append = [&](int written) {
+    if (written > 0)
+      len = min(len + written, outLen - 1);
+  };
+  append(snprintf(out, outLen, "[%6u.%03u][%c][%s]: ",
+                  (uint32_t)(timestamp / 1000), (uint32_t)(timestamp % 1000),
+                  LEVEL_LETTERS[level],
+                  getModuleName((LogModule_e)record[1])));
+
+  const uint8_t* arg = record + RECORD_HEADER_SIZE;
+  const uint8_t* end = record + record[0];
+  const char* format = (const char*)(uintptr_t)address;
+  while (*format && len < outLen - 1) {
+    if (*format != '%') {
+      out[len++] = *format++;
+      continue;
+    }
+    if (format[1] == '%') {
+      out[len++] = '%';
+      format += 2;
+      continue;
+    }
+
+    // flags, width and precision are kept, length modifiers dropped
+    char spec[16] = "%";
+    size_t specLen = 1;
+    const char* it = format + 1;
+    while (*it && strchr("-+ #0123456789.", *it) && specLen < 10)
+      spec[specLen++] = *it++;
+    while (*it && strchr("hlLqjzt", *it))
+      it++;
+    char conversion = *it;
+    if (!conversion)
+      break;
+    format = it + 1;
+
+    if (arg >= end) {
+      // no argument left, print the conversion as it was
+      append(snprintf(out + len, outLen - len, "%s%c", spec, conversion));
+      continue;
+    }
+
+    char tag = *arg++;
+    size_t remaining = outLen - len;
+    if (tag == 'S') {
+      uint8_t size = *arg++;
+      char value[BINARY_LOG_MAX_STRING + 1];
+      memcpy(value, arg, size);
+      value[size] = '\0';
+      arg += size;
+      spec[specLen++] = 's';
+      append(snprintf(out + len, remaining, spec, value));
+    } else if (tag == 'D') {
+      double value;
+      memcpy(&value, arg, sizeof(value));
+      arg += sizeof(value);
+      spec[specLen++] = strchr("fFeEgGaA", conversion) ? conversion : 'g';
+      append(snprintf(out + len, remaining, spec, value));
+    } else {
+      bool wide = tag == 'Q';
+      uint64_t value = 0;
+      memcpy(&value, arg, wide ? 8 : 4);
+      arg += wide ? 8 : 4;
+      if (!wide && strchr("di", conversion))
+        value = (uint64_t)(int64_t)(int32_t)value;
+      if (strchr("fFeEgGaA", conversion)) {
+        spec[specLen++] = conversion;
+        append(snprintf(out + len, remaining, spec, (double)(int64_t)value));
+      } else if (conversion == 'c') {
+        spec[specLen++] = 'c';
+        append(snprintf(out + len, remaining, spec, (int)value));
+      } else if (conversion == 's') {
+        // a pointer we can't follow anymore
+        append(snprintf(out + len, remaining, "0x%08x", (uint32_t)value));
+      } else {
+        spec[specLen++] = 'l';
+        spec[specLen++] = 'l';
+        spec[specLen++] = strchr("diouxX", conversion) ? conversion : 'x';
+        append(snprintf(out + len, remaining, spec, value));
+      }
+    }
+  }
+  out[len] = '\0';
+  return len;
+}
+
+void BinaryLog::benchmark(Print& out, uint32_t iterations) {
+  static const char* FORMAT = "Size: %uKB, Time: %ums (%ifps)";
+  LogLevel_e level = levels[LOG_MODULE_STREAM];
+  char line[128];
+
+  // the ring is shared, put back what was in it afterwards - records logged
+  // during the benchmark are lost
+  std::unique_ptr<uint8_t[]> saved(new uint8_t[BINARY_LOG_SIZE]);
+  portENTER_CRITICAL(&lock);
+  size_t savedHead = head, savedTail = tail, savedUsed = used;
+  uint32_t savedWritten = written, savedDropped = dropped;
+  memcpy(saved.get(), buffer, BINARY_LOG_SIZE);
+  portEXIT_CRITICAL(&lock);
+
+  levels[LOG_MODULE_STREAM] = LOG_LEVEL_DEBUG;
+  uint32_t start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < iterations; i++)
+    BLOG_D(LOG_MODULE_STREAM, FORMAT, i & 31, 16, 60);
+  uint32_t enabledCycles = ESP.getCycleCount() - start;
+
+  levels[LOG_MODULE_STREAM] = LOG_LEVEL_INFO;
+  start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < iterations; i++)
+    BLOG_D(LOG_MODULE_STREAM, FORMAT, i & 31, 16, 60);
+  uint32_t disabledCycles = ESP.getCycleCount() - start;
+  levels[LOG_MODULE_STREAM] = level;
+
+  // what log_d does before it even touches the UART
+  start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < iterations; i++)
+    snprintf(line, sizeof(line), "[%6u][D][streamServer.cpp:145] stream(): "
+             "Size: %uKB, Time: %ums (%ifps)\n",
+             (uint32_t)millis(), i & 31, 16, 60);
+  uint32_t formatCycles = ESP.getCycleCount() - start;
+
+  portENTER_CRITICAL(&lock);
+  memcpy(buffer, saved.get(), BINARY_LOG_SIZE);
+  head = savedHead;
+  tail = savedTail;
+  used = savedUsed;
+  written = savedWritten;
+  dropped = savedDropped;
+  portEXIT_CRITICAL(&lock);
+
+  out.printf(
+      "{\"binary_log_cycles\": %u, \"binary_log_disabled_cycles\": %u, "
+      "\"snprintf_cycles\": %u, \"iterations\": %u}\n",
+      enabledCycles / iterations, disabledCycles / iterations,
+      formatCycles / iterations, iterations);
+}
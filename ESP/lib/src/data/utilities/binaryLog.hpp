@@ -0,0 +1,179 @@
+#pragma once
+#ifndef BINARY_LOG_HPP
+#define BINARY_LOG_HPP
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+
+//! bytes of RAM the records share, the oldest get overwritten
+#ifndef BINARY_LOG_SIZE
+#define BINARY_LOG_SIZE 4096
+#endif
+//! a record with its arguments, anything past that gets cut off
+#define BINARY_LOG_MAX_RECORD 96
+//! longest string argument kept, in bytes
+#define BINARY_LOG_MAX_STRING 32
+
+enum LogModule_e {
+  LOG_MODULE_STREAM,
+  LOG_MODULE_SERIAL,
+  LOG_MODULE_API,
+  LOG_MODULE_CAMERA,
+  LOG_MODULE_WIFI,
+  LOG_MODULE_COUNT,
+};
+
+//! same numbering as the Arduino core log levels
+enum LogLevel_e {
+  LOG_LEVEL_NONE,
+  LOG_LEVEL_ERROR,
+  LOG_LEVEL_WARN,
+  LOG_LEVEL_INFO,
+  LOG_LEVEL_DEBUG,
+  LOG_LEVEL_VERBOSE,
+};
+
+/**
+ * @brief Deferred logger for the hot paths, a call only copies the format
+ * string pointer and the raw arguments into a RAM ring
+ * @details Formatting happens when the ring gets drained - over serial with
+ * the get_log command or over HTTP - so nothing shares the UART / CDC with
+ * the frames until someone asks. The raw dump carries the format strings it
+ * references, tools/binlog_decode.py formats it on the host. Every module
+ * has its own level, changeable at runtime with set_log_level.
+ *
+ * Format strings have to be string literals, only the pointer is stored.
+ * String arguments are copied, up to BINARY_LOG_MAX_STRING bytes.
+ *
+ * Record layout, little endian: length u8, module u8, level u8, argument
+ * count u8, timestamp u64 (us since boot), format string pointer u32, then
+ * per argument a type tag ('I' 32 bit int, 'Q' 64 bit int, 'D' double, 'S'
+ * length u8 + bytes) and its value.
+ */
+class BinaryLog {
+ public:
+  BinaryLog();
+
+  bool isEnabled(LogModule_e module, LogLevel_e level) const {
+    return level <= levels[module];
+  }
+  void setLevel(LogModule_e module, LogLevel_e level);
+  LogLevel_e getLevel(LogModule_e module) const { return levels[module]; }
+
+  template <typename... Args>
+  void write(LogModule_e module,
+             LogLevel_e level,
+             const char* format,
+             const Args&... args) {
+    uint8_t record[BINARY_LOG_MAX_RECORD];
+    size_t len = this->beginRecord(record, module, level, format,
+                                   sizeof...(args));
+    (void)std::initializer_list<int>{
+        (len = this->encode(record, len, args), 0)...};
+    record[0] = len;
+    this->push(record, len);
+  }
+
+  //! formats the records as text lines and drops them from the ring
+  void drain(Print& out);
+  //! writes the records as a binary dump for binlog_decode.py, keeps them
+  void dumpRaw(Print& out);
+  void clear();
+  uint32_t getDropped() const { return dropped; }
+
+  static const char* getModuleName(LogModule_e module);
+  static bool moduleFromName(const std::string& name, LogModule_e* module);
+  //! takes the level name ("debug") or number ("4")
+  static bool levelFromName(const std::string& name, LogLevel_e* level);
+  //! formats a single record, returns the length like snprintf
+  static size_t formatRecord(const uint8_t* record, char* out, size_t outLen);
+  //! cost of a call compared to formatting it like log_d does
+  void benchmark(Print& out, uint32_t iterations);
+
+ private:
+  size_t beginRecord(uint8_t* record,
+                     LogModule_e module,
+                     LogLevel_e level,
+                     const char* format,
+                     size_t argc);
+  void push(const uint8_t* record, size_t len);
+  /**
+   * @brief Copies the ring out, oldest first
+   * @param end set to the write position the copy ends at
+   */
+  size_t copyRecords(uint8_t* buffer, uint32_t* end);
+
+  static size_t encodeBytes(uint8_t* record,
+                            size_t len,
+                            char tag,
+                            const void* value,
+                            size_t size);
+  static size_t encodeString(uint8_t* record, size_t len, const char* value);
+
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value ||
+                                     std::is_enum<T>::value,
+                                 size_t>::type
+  encode(uint8_t* record, size_t len, const T& value) {
+    if (sizeof(T) > 4) {
+      uint64_t wide = (uint64_t)value;
+      return encodeBytes(record, len, 'Q', &wide, sizeof(wide));
+    }
+    // sign extended, the format string decides how it gets read
+    uint32_t narrow = std::is_signed<T>::value ? (uint32_t)(int32_t)value
+                                               : (uint32_t)value;
+    return encodeBytes(record, len, 'I', &narrow, sizeof(narrow));
+  }
+  template <typename T>
+  static typename std::enable_if<std::is_floating_point<T>::value,
+                                 size_t>::type
+  encode(uint8_t* record, size_t len, const T& value) {
+    double wide = value;
+    return encodeBytes(record, len, 'D', &wide, sizeof(wide));
+  }
+  static size_t encode(uint8_t* record, size_t len, const char* value) {
+    return encodeString(record, len, value);
+  }
+  static size_t encode(uint8_t* record, size_t len, const std::string& value) {
+    return encodeString(record, len, value.c_str());
+  }
+  static size_t encode(uint8_t* record, size_t len, const String& value) {
+    return encodeString(record, len, value.c_str());
+  }
+  static size_t encode(uint8_t* record, size_t len, const void* value) {
+    uint32_t address = (uint32_t)(uintptr_t)value;
+    return encodeBytes(record, len, 'I', &address, sizeof(address));
+  }
+
+  portMUX_TYPE lock;
+  uint8_t buffer[BINARY_LOG_SIZE];
+  size_t head;
+  size_t tail;
+  size_t used;
+  //! bytes ever pushed, wraps
+  uint32_t written;
+  volatile uint32_t dropped;
+  volatile LogLevel_e levels[LOG_MODULE_COUNT];
+};
+
+extern BinaryLog binaryLog;
+
+//! records only if the module logs at that level, the arguments are not
+//! evaluated otherwise
+#define BLOG(module, level, format, ...)                         \
+  do {                                                           \
+    if (binaryLog.isEnabled(module, level))                      \
+      binaryLog.write(module, level, format, ##__VA_ARGS__);     \
+  } while (0)
+#define BLOG_E(module, format, ...) \
+  BLOG(module, LOG_LEVEL_ERROR, format, ##__VA_ARGS__)
+#define BLOG_W(module, format, ...) \
+  BLOG(module, LOG_LEVEL_WARN, format, ##__VA_ARGS__)
+#define BLOG_I(module, format, ...) \
+  BLOG(module, LOG_LEVEL_INFO, format, ##__VA_ARGS__)
+#define BLOG_D(module, format, ...) \
+  BLOG(module, LOG_LEVEL_DEBUG, format, ##__VA_ARGS__)
+
+#endif  // BINARY_LOG_HPP
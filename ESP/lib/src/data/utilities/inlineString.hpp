@@ -0,0 +1,82 @@
+#pragma once
+#ifndef INLINE_STRING_HPP
+#define INLINE_STRING_HPP
+#include <string.h>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief A string of at most Capacity bytes, stored in place and always NUL
+ * terminated
+ * @details Meant for the config fields the protocols cap anyway - SSIDs at
+ * 32 bytes, WPA passphrases at 64, DNS labels at 63. Copying one is a
+ * memcpy and never touches the heap, so a struct made of them stays
+ * trivially copyable and can be snapshotted or persisted as raw bytes.
+ *
+ * Anything longer gets cut at Capacity bytes, assign() says when it did.
+ */
+template <size_t Capacity>
+class InlineString {
+ public:
+  constexpr InlineString() : buffer() {}
+  InlineString(const char* value) : buffer() { this->assign(value); }
+  InlineString(const std::string& value) : buffer() { this->assign(value); }
+
+  //! @return false if the value was longer than Capacity and got cut
+  bool assign(const char* value, size_t length) {
+    bool fits = length <= Capacity;
+    if (!fits)
+      length = Capacity;
+    memcpy(buffer, value, length);
+    memset(buffer + length, 0, sizeof(buffer) - length);
+    return fits;
+  }
+  bool assign(const char* value) {
+    return this->assign(value ? value : "", value ? strlen(value) : 0);
+  }
+  bool assign(const std::string& value) {
+    return this->assign(value.data(), value.size());
+  }
+
+  InlineString& operator=(const char* value) {
+    this->assign(value);
+    return *this;
+  }
+  InlineString& operator=(const std::string& value) {
+    this->assign(value);
+    return *this;
+  }
+
+  const char* c_str() const { return buffer; }
+  size_t size() const { return strnlen(buffer, Capacity); }
+  size_t length() const { return this->size(); }
+  bool empty() const { return !buffer[0]; }
+  static constexpr size_t capacity() { return Capacity; }
+
+  //! for the APIs taking a std::string, this one allocates
+  operator std::string() const { return std::string(buffer, this->size()); }
+
+  bool operator==(const char* other) const {
+    return strcmp(buffer, other ? other : "") == 0;
+  }
+  bool operator==(const std::string& other) const {
+    return this->size() == other.size() &&
+           memcmp(buffer, other.data(), other.size()) == 0;
+  }
+  template <size_t OtherCapacity>
+  bool operator==(const InlineString<OtherCapacity>& other) const {
+    return strcmp(buffer, other.c_str()) == 0;
+  }
+  template <typename T>
+  bool operator!=(const T& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  char buffer[Capacity + 1];
+};
+
+static_assert(std::is_trivially_copyable<InlineString<32>>::value,
+              "InlineString has to stay a plain block of bytes");
+
+#endif  // INLINE_STRING_HPP
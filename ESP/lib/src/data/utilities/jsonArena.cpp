@@ -0,0 +1,122 @@
+#include "jsonArena.hpp"
+#include <esp_heap_caps.h>
+
+//! no block can grow in place
+#define JSON_ARENA_NO_BLOCK SIZE_MAX
+
+namespace {
+class HeapAllocator : public ArduinoJson::Allocator {
+ public:
+  void* allocate(size_t size) override { return malloc(size); }
+  void deallocate(void* pointer) override { free(pointer); }
+  void* reallocate(void* pointer, size_t new_size) override {
+    return realloc(pointer, new_size);
+  }
+};
+
+HeapAllocator heapAllocator;
+}  // namespace
+
+JsonArena::JsonArena(size_t capacity, ArduinoJson::Allocator* fallback)
+    : fallback(fallback ? fallback : &heapAllocator),
+      buffer(nullptr),
+      capacity(capacity),
+      used(0),
+      last(JSON_ARENA_NO_BLOCK),
+      live(0),
+      overflowed(false) {}
+
+JsonArena::~JsonArena() {
+  heap_caps_free(buffer);
+}
+
+void* JsonArena::allocate(size_t size) {
+  size_t needed = blockSize(size);
+  if (!this->reserve() || needed > capacity - used)
+    return this->overflow(size);
+
+  Header_t* header = reinterpret_cast<Header_t*>(buffer + used);
+  header->size = size;
+  header->offset = used;
+  last = used;
+  used += needed;
+  live++;
+  return header + 1;
+}
+
+void JsonArena::deallocate(void* pointer) {
+  if (!this->owns(pointer)) {
+    fallback->deallocate(pointer);
+    return;
+  }
+
+  Header_t* header = reinterpret_cast<Header_t*>(pointer) - 1;
+  if (header->offset == last) {
+    used = last;
+    last = JSON_ARENA_NO_BLOCK;
+  }
+  // the message is done with, all of the block is free again
+  if (--live == 0) {
+    used = 0;
+    last = JSON_ARENA_NO_BLOCK;
+    overflowed = false;
+  }
+}
+
+void* JsonArena::reallocate(void* pointer, size_t new_size) {
+  if (!pointer)
+    return this->allocate(new_size);
+  if (!this->owns(pointer))
+    return fallback->reallocate(pointer, new_size);
+
+  Header_t* header = reinterpret_cast<Header_t*>(pointer) - 1;
+  if (header->offset == last &&
+      blockSize(new_size) <= capacity - header->offset) {
+    header->size = new_size;
+    used = header->offset + blockSize(new_size);
+    return pointer;
+  }
+  if (new_size <= header->size) {
+    header->size = new_size;
+    return pointer;
+  }
+
+  void* moved = this->allocate(new_size);
+  if (!moved)
+    return nullptr;
+  memcpy(moved, pointer, header->size);
+  this->deallocate(pointer);
+  return moved;
+}
+
+//! the block is taken on first use, PSRAM isn't up for static constructors
+bool JsonArena::reserve() {
+  if (buffer || !capacity)
+    return buffer;
+  uint32_t caps = psramFound() ? MALLOC_CAP_SPIRAM : MALLOC_CAP_8BIT;
+  buffer = (uint8_t*)heap_caps_malloc(capacity, caps);
+  if (!buffer) {
+    log_e("[JsonArena]: Could not allocate %u bytes, using the heap",
+          capacity);
+    capacity = 0;
+  }
+  return buffer;
+}
+
+bool JsonArena::owns(const void* pointer) const {
+  const uint8_t* address = static_cast<const uint8_t*>(pointer);
+  return buffer && address >= buffer && address < buffer + capacity;
+}
+
+void* JsonArena::overflow(size_t size) {
+  if (buffer && !overflowed) {
+    log_w("[JsonArena]: Message doesn't fit in %u bytes, using the heap",
+          capacity);
+    overflowed = true;
+  }
+  return fallback->allocate(size);
+}
+
+size_t JsonArena::blockSize(size_t size) {
+  return sizeof(Header_t) + ((size + 7) & ~(size_t)7);
+}
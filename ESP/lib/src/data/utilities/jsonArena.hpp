@@ -0,0 +1,63 @@
+#pragma once
+#ifndef JSON_ARENA_HPP
+#define JSON_ARENA_HPP
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+//! room for a set_config batch of CONFIG_BATCH_MAX_BODY with some to spare
+#define JSON_ARENA_SIZE (16 * 1024)
+
+/**
+ * @brief An ArduinoJson allocator that hands out one fixed block, in PSRAM
+ * when there is some, and starts over once the last document in it is gone
+ * @details Every message parsed or built on the default allocator leaves
+ * its pools and strings scattered over internal RAM, the same RAM the Wi-Fi
+ * stack and the camera DMA need in one piece. Here allocations are bumped
+ * off the block and freeing does nothing until nothing is left alive, then
+ * the whole block is free again - one message, one reset.
+ *
+ * The last block handed out grows and shrinks in place, which is how
+ * ArduinoJson builds strings and trims its pools. A message that doesn't
+ * fit goes on to the heap for the rest of it, with a warning.
+ *
+ * Not locked, every task needs its own arena.
+ */
+class JsonArena : public ArduinoJson::Allocator {
+ public:
+  /**
+   * @param fallback where messages that don't fit go, the heap if null
+   */
+  explicit JsonArena(size_t capacity = JSON_ARENA_SIZE,
+                     ArduinoJson::Allocator* fallback = nullptr);
+  ~JsonArena();
+
+  void* allocate(size_t size) override;
+  void deallocate(void* pointer) override;
+  void* reallocate(void* pointer, size_t new_size) override;
+
+  //! blocks handed out of the arena and not freed yet
+  size_t getLive() const { return live; }
+
+ private:
+  //! in front of every block, 8 bytes so the block stays 8 byte aligned
+  struct Header_t {
+    uint32_t size;
+    uint32_t offset;
+  };
+
+  bool reserve();
+  bool owns(const void* pointer) const;
+  void* overflow(size_t size);
+  static size_t blockSize(size_t size);
+
+  ArduinoJson::Allocator* fallback;
+  uint8_t* buffer;
+  size_t capacity;
+  size_t used;
+  //! offset of the block that may still grow in place
+  size_t last;
+  size_t live;
+  bool overflowed;
+};
+
+#endif  // JSON_ARENA_HPP
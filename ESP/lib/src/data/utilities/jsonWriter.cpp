@@ -0,0 +1,36 @@
+#include "jsonWriter.hpp"
+
+void JsonWriter::writeString(Print& out, const char* value) {
+  out.write('"');
+  // the plain runs in between the escapes go out in one write
+  const char* run = value;
+  for (const char* c = value; *c; c++) {
+    uint8_t ch = (uint8_t)*c;
+    if (ch >= 0x20 && ch != '"' && ch != '\\')
+      continue;
+    out.write((const uint8_t*)run, c - run);
+    run = c + 1;
+    switch (ch) {
+      case '"':
+        out.print("\\\"");
+        break;
+      case '\\':
+        out.print("\\\\");
+        break;
+      case '\n':
+        out.print("\\n");
+        break;
+      case '\r':
+        out.print("\\r");
+        break;
+      case '\t':
+        out.print("\\t");
+        break;
+      default:
+        out.printf("\\u%04x", ch);
+        break;
+    }
+  }
+  out.write((const uint8_t*)run, strlen(run));
+  out.write('"');
+}
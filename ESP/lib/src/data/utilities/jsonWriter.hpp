@@ -0,0 +1,50 @@
+#pragma once
+#ifndef JSON_WRITER_HPP
+#define JSON_WRITER_HPP
+#include <Arduino.h>
+#include <string>
+
+/**
+ * @brief Small helpers for printing JSON straight into a Print - an
+ * AsyncResponseStream, the serial port - without building it as a string first
+ */
+namespace JsonWriter {
+//! writes the value quoted, escaping quotes, backslashes and control
+//! characters
+void writeString(Print& out, const char* value);
+inline void writeString(Print& out, const std::string& value) {
+  writeString(out, value.c_str());
+}
+
+inline const char* boolean(bool value) {
+  return value ? "true" : "false";
+}
+
+//! a Print appending to a std::string, for the callers still wanting one
+class StringPrint : public Print {
+ public:
+  explicit StringPrint(std::string& out) : out(out) {}
+  size_t write(uint8_t c) override {
+    out.push_back((char)c);
+    return 1;
+  }
+  size_t write(const uint8_t* buffer, size_t size) override {
+    out.append((const char*)buffer, size);
+    return size;
+  }
+
+ private:
+  std::string& out;
+};
+
+//! anything with a writeJson(Print&) as a string
+template <typename T>
+std::string toString(const T& value) {
+  std::string json;
+  StringPrint out(json);
+  value.writeJson(out);
+  return json;
+}
+}  // namespace JsonWriter
+
+#endif  // JSON_WRITER_HPP
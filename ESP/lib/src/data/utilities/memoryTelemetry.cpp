@@ -0,0 +1,121 @@
+#include "memoryTelemetry.hpp"
+#include <esp_heap_caps.h>
+#include <new>
+
+MemoryTelemetry memoryTelemetry;
+
+thread_local MemoryModule_e MemoryTelemetry::currentModule =
+    MEMORY_MODULE_OTHER;
+
+void MemoryTelemetry::writeJson(Print& out) {
+  out.print("{");
+  writeHeap(out, "internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  out.print(", ");
+  writeHeap(out, "psram", MALLOC_CAP_SPIRAM);
+  out.print(", \"tasks\": ");
+  writeTasks(out);
+
+  out.printf(", \"allocations\": {\"tracking\": %s",
+             MEMORY_ALLOC_TRACKING ? "true" : "false");
+  for (int i = 0; i < MEMORY_MODULE_COUNT; i++) {
+    uint32_t count = __atomic_load_n(&allocations[i].count, __ATOMIC_RELAXED);
+    uint32_t bytes = __atomic_load_n(&allocations[i].bytes, __ATOMIC_RELAXED);
+    out.printf(", \"%s\": {\"count\": %u, \"bytes\": %u}",
+               moduleName(static_cast<MemoryModule_e>(i)), count, bytes);
+  }
+  out.print("}}");
+}
+
+void MemoryTelemetry::countAllocation(size_t size) {
+  // the static constructors allocate before any task has its thread-local
+  // storage set up
+  MemoryModule_e module = xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED
+                              ? MEMORY_MODULE_OTHER
+                              : currentModule;
+  __atomic_add_fetch(&allocations[module].count, 1, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&allocations[module].bytes, (uint32_t)size,
+                     __ATOMIC_RELAXED);
+}
+
+void MemoryTelemetry::resetAllocations() {
+  for (auto& counter : allocations) {
+    __atomic_store_n(&counter.count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&counter.bytes, 0, __ATOMIC_RELAXED);
+  }
+}
+
+const char* MemoryTelemetry::moduleName(MemoryModule_e module) {
+  switch (module) {
+    case MEMORY_MODULE_STREAM:
+      return "stream";
+    case MEMORY_MODULE_SERIAL:
+      return "serial";
+    case MEMORY_MODULE_API:
+      return "api";
+    case MEMORY_MODULE_CONFIG:
+      return "config";
+    default:
+      return "other";
+  }
+}
+
+void MemoryTelemetry::writeHeap(Print& out, const char* name, uint32_t caps) {
+  size_t total = heap_caps_get_total_size(caps);
+  size_t free = heap_caps_get_free_size(caps);
+  size_t largest = heap_caps_get_largest_free_block(caps);
+  out.printf(
+      "\"%s\": {\"total\": %u, \"free\": %u, \"min_free\": %u, "
+      "\"largest_block\": %u, \"fragmentation\": %u}",
+      name, total, free, heap_caps_get_minimum_free_size(caps), largest,
+      free ? (unsigned)(100 - largest * 100 / free) : 0u);
+}
+
+//! the high-water mark is the least stack a task ever had left, in bytes
+void MemoryTelemetry::writeTasks(Print& out) {
+#if configUSE_TRACE_FACILITY
+  // the list is copied under the scheduler lock, no allocation on the way
+  TaskStatus_t tasks[MEMORY_TELEMETRY_MAX_TASKS];
+  UBaseType_t count =
+      uxTaskGetSystemState(tasks, MEMORY_TELEMETRY_MAX_TASKS, nullptr);
+  if (!count && uxTaskGetNumberOfTasks() > MEMORY_TELEMETRY_MAX_TASKS)
+    log_w("[MemoryTelemetry]: More than %d tasks, not listing them",
+          MEMORY_TELEMETRY_MAX_TASKS);
+  out.print("[");
+  for (UBaseType_t i = 0; i < count; i++) {
+    out.printf(
+        "%s{\"name\": \"%s\", \"priority\": %u, \"stack_free_min\": %u}",
+        i ? ", " : "", tasks[i].pcTaskName,
+        (unsigned)tasks[i].uxCurrentPriority,
+        (unsigned)tasks[i].usStackHighWaterMark);
+  }
+  out.print("]");
+#else
+  out.print("[]");
+#endif
+}
+
+#if MEMORY_ALLOC_TRACKING
+// the replaceable allocation functions, deallocation stays with free()
+void* operator new(size_t size) {
+  void* pointer = malloc(size);
+  if (!pointer)
+    std::__throw_bad_alloc();
+  memoryTelemetry.countAllocation(size);
+  return pointer;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  void* pointer = malloc(size);
+  if (pointer)
+    memoryTelemetry.countAllocation(size);
+  return pointer;
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+  return operator new(size, tag);
+}
+#endif  // MEMORY_ALLOC_TRACKING
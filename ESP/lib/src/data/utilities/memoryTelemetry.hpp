@@ -0,0 +1,90 @@
+#pragma once
+#ifndef MEMORY_TELEMETRY_HPP
+#define MEMORY_TELEMETRY_HPP
+#include <Arduino.h>
+
+#ifndef MEMORY_ALLOC_TRACKING
+#define MEMORY_ALLOC_TRACKING 0
+#endif
+
+//! tasks reported at most, the rest are counted but left out
+#define MEMORY_TELEMETRY_MAX_TASKS 24
+
+//! what operator new calls get attributed to, see MEMORY_SCOPE
+enum MemoryModule_e {
+  MEMORY_MODULE_OTHER,
+  MEMORY_MODULE_STREAM,
+  MEMORY_MODULE_SERIAL,
+  MEMORY_MODULE_API,
+  MEMORY_MODULE_CONFIG,
+  MEMORY_MODULE_COUNT,
+};
+
+/**
+ * @brief Where the memory is: internal RAM and PSRAM with their largest free
+ * blocks and low-water marks, and how close every task came to its stack end
+ * @details Fragmentation is how much of the free memory is not in the
+ * largest block - a 100 KB heap that can't hand out 10 KB in one piece is as
+ * good as full for a frame buffer.
+ *
+ * Built with MEMORY_ALLOC_TRACKING=1, operator new counts every allocation
+ * and its size against the module set by the innermost MEMORY_SCOPE on the
+ * calling task. That catches what the stream, serial, API and config code
+ * allocate per frame or per request. It costs a thread-local read and two
+ * atomic adds per allocation, and only sees C++ allocations - malloc from
+ * the camera driver or lwIP goes uncounted.
+ */
+class MemoryTelemetry {
+ public:
+  struct Allocations_t {
+    uint32_t count;
+    uint32_t bytes;
+  };
+
+  //! constant-initialized, operator new may count before any constructor ran
+  constexpr MemoryTelemetry() : allocations() {}
+  //! the whole report as JSON
+  void writeJson(Print& out);
+  //! starts the allocation counts over
+  void resetAllocations();
+
+  void countAllocation(size_t size);
+
+  static const char* moduleName(MemoryModule_e module);
+
+  static thread_local MemoryModule_e currentModule;
+
+ private:
+  static void writeHeap(Print& out, const char* name, uint32_t caps);
+  static void writeTasks(Print& out);
+
+  Allocations_t allocations[MEMORY_MODULE_COUNT];
+};
+
+extern MemoryTelemetry memoryTelemetry;
+
+//! attributes the allocations of the enclosing scope, nests
+class MemoryScope {
+ public:
+  explicit MemoryScope(MemoryModule_e module)
+      : previous(MemoryTelemetry::currentModule) {
+    MemoryTelemetry::currentModule = module;
+  }
+  ~MemoryScope() { MemoryTelemetry::currentModule = previous; }
+
+ private:
+  MemoryModule_e previous;
+};
+
+#if MEMORY_ALLOC_TRACKING
+#define MEMORY_CONCAT_INNER(a, b) a##b
+#define MEMORY_CONCAT(a, b) MEMORY_CONCAT_INNER(a, b)
+#define MEMORY_SCOPE(module) \
+  MemoryScope MEMORY_CONCAT(_memory_scope_, __LINE__)(module)
+#else
+#define MEMORY_SCOPE(module) \
+  do {                       \
+  } while (0)
+#endif  // MEMORY_ALLOC_TRACKING
+
+#endif  // MEMORY_TELEMETRY_HPP
@@ -0,0 +1,251 @@
+#include "metrics.hpp"
+#include <WiFi.h>
+#include "network/wifihandler/linkQuality.hpp"
+
+Metrics metrics;
+
+//! indexed by FrameTransport_e
+static const char* const TRANSPORT_LABELS[TRANSPORT_COUNT] = {
+    "serial",
+    "mjpeg",
+    "pupil",
+};
+
+//! indexed by MetricCounter_e
+static const struct {
+  const char* name;
+  const char* help;
+} COUNTERS[METRIC_COUNTER_COUNT] = {
+    {"openiris_camera_capture_errors_total", "Failed frame captures"},
+    {"openiris_camera_init_failures_total", "Failed camera initializations"},
+    {"openiris_wifi_disconnects_total", "Station disconnects"},
+    {"openiris_wifi_reconnects_total", "Reconnect attempts"},
+    {"openiris_wifi_roams_total", "Roams to a stronger access point"},
+    {"openiris_api_requests_total", "Requests handled by the API server"},
+    {"openiris_commands_total", "Commands handled by the command manager"},
+};
+
+// capture-to-send, in microseconds
+static const uint32_t LATENCY_BOUNDS[] = {
+    5000,   10000,  20000,  33000,  50000,
+    75000,  100000, 200000, 500000, 1000000,
+};
+// in bytes
+static const uint32_t SIZE_BOUNDS[] = {
+    2048, 4096, 8192, 16384, 32768, 65536, 131072, 262144,
+};
+// esp_camera_fb_get(), in microseconds - mostly waiting for the next frame
+static const uint32_t CAPTURE_BOUNDS[] = {
+    1000, 5000, 10000, 20000, 33000, 50000, 100000, 250000,
+};
+// Wi-Fi connect to IP, in milliseconds - a fast connect is well under a
+// second, a scan through every stored network takes tens
+static const uint32_t CONNECT_BOUNDS[] = {
+    250, 500, 1000, 2000, 3000, 5000, 10000, 20000, 30000,
+};
+
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+
+static_assert(ARRAY_SIZE(LATENCY_BOUNDS) < METRICS_HISTOGRAM_MAX_BUCKETS &&
+                  ARRAY_SIZE(SIZE_BOUNDS) < METRICS_HISTOGRAM_MAX_BUCKETS &&
+                  ARRAY_SIZE(CAPTURE_BOUNDS) < METRICS_HISTOGRAM_MAX_BUCKETS &&
+                  ARRAY_SIZE(CONNECT_BOUNDS) < METRICS_HISTOGRAM_MAX_BUCKETS,
+              "too many histogram buckets");
+
+//! frames further apart than that count as a stopped stream for the fps
+#define METRICS_FPS_TIMEOUT_US 2000000
+
+MetricsHistogram::MetricsHistogram(const uint32_t* bounds,
+                                   size_t boundCount,
+                                   float unit)
+    : bounds(bounds),
+      boundCount(min(boundCount, (size_t)METRICS_HISTOGRAM_MAX_BUCKETS - 1)),
+      unit(unit) {}
+
+void MetricsHistogram::observe(uint32_t value) {
+  size_t bucket = 0;
+  while (bucket < boundCount && value > bounds[bucket])
+    bucket++;
+  buckets[bucket].add();
+  sum.add(value);
+}
+
+void MetricsHistogram::write(Print& out,
+                             const char* name,
+                             const char* labels) const {
+  const char* separator = labels[0] ? "," : "";
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < boundCount; i++) {
+    cumulative += buckets[i].load();
+    out.printf("%s_bucket{%s%sle=\"%g\"} %llu\n", name, labels, separator,
+               bounds[i] / unit, cumulative);
+  }
+  cumulative += buckets[boundCount].load();
+  out.printf("%s_bucket{%s%sle=\"+Inf\"} %llu\n", name, labels, separator,
+             cumulative);
+  const char* open = labels[0] ? "{" : "";
+  const char* close = labels[0] ? "}" : "";
+  out.printf("%s_sum%s%s%s %g\n", name, open, labels, close,
+             sum.load() / unit);
+  out.printf("%s_count%s%s%s %llu\n", name, open, labels, close, cumulative);
+}
+
+Metrics::Metrics()
+    : frameLatency{
+          {LATENCY_BOUNDS, ARRAY_SIZE(LATENCY_BOUNDS), 1000000.0f},
+          {LATENCY_BOUNDS, ARRAY_SIZE(LATENCY_BOUNDS), 1000000.0f},
+          {LATENCY_BOUNDS, ARRAY_SIZE(LATENCY_BOUNDS), 1000000.0f},
+      },
+      frameSize(SIZE_BOUNDS, ARRAY_SIZE(SIZE_BOUNDS), 1.0f),
+      captureDuration(CAPTURE_BOUNDS, ARRAY_SIZE(CAPTURE_BOUNDS), 1000000.0f),
+      connectDuration(CONNECT_BOUNDS, ARRAY_SIZE(CONNECT_BOUNDS), 1000.0f),
+      lastFrame_us(),
+      frameInterval_us() {}
+
+void Metrics::count(MetricCounter_e counter, uint32_t value) {
+  counters[counter].add(value);
+}
+
+void Metrics::frameSent(FrameTransport_e transport,
+                        size_t bytes,
+                        const struct timeval& captured) {
+  int64_t now_us = esp_timer_get_time();
+  int64_t captured_us =
+      (int64_t)captured.tv_sec * 1000000LL + (int64_t)captured.tv_usec;
+
+  framesSent[transport].add();
+  frameBytes[transport].add(bytes);
+  frameLatency[transport].observe(
+      (uint32_t)constrain(now_us - captured_us, 0LL, (int64_t)UINT32_MAX));
+  if (transport != TRANSPORT_PUPIL)
+    frameSize.observe(bytes);
+
+  // two tasks on one transport (two MJPEG clients) may race here, which only
+  // costs an fps sample
+  uint32_t interval = (uint32_t)now_us - lastFrame_us[transport];
+  lastFrame_us[transport] = (uint32_t)now_us;
+  if (interval > METRICS_FPS_TIMEOUT_US)
+    return;
+  uint32_t average = frameInterval_us[transport];
+  frameInterval_us[transport] =
+      average ? average - (average >> 3) + (interval >> 3) : interval;
+}
+
+void Metrics::frameDropped(FrameTransport_e transport) {
+  framesDropped[transport].add();
+}
+
+void Metrics::observeCapture(int64_t duration_us) {
+  captureDuration.observe(
+      (uint32_t)constrain(duration_us, 0LL, (int64_t)UINT32_MAX));
+}
+
+void Metrics::observeConnect(uint32_t duration_ms) {
+  connectDuration.observe(duration_ms);
+}
+
+float Metrics::getFps(FrameTransport_e transport) const {
+  uint32_t interval = frameInterval_us[transport];
+  bool stale = (uint32_t)esp_timer_get_time() - lastFrame_us[transport] >
+               METRICS_FPS_TIMEOUT_US;
+  return interval && !stale ? 1000000.0f / interval : 0.0f;
+}
+
+void Metrics::writePrometheus(Print& out) {
+  for (size_t i = 0; i < METRIC_COUNTER_COUNT; i++) {
+    out.printf("# HELP %s %s\n# TYPE %s counter\n%s %llu\n",
+               COUNTERS[i].name, COUNTERS[i].help, COUNTERS[i].name,
+               COUNTERS[i].name, counters[i].load());
+  }
+
+  out.print("# HELP openiris_frames_sent_total Frames sent per transport\n"
+            "# TYPE openiris_frames_sent_total counter\n");
+  for (size_t i = 0; i < TRANSPORT_COUNT; i++)
+    out.printf("openiris_frames_sent_total{transport=\"%s\"} %llu\n",
+               TRANSPORT_LABELS[i], framesSent[i].load());
+  out.print("# HELP openiris_frames_dropped_total Captured frames never sent\n"
+            "# TYPE openiris_frames_dropped_total counter\n");
+  for (size_t i = 0; i < TRANSPORT_COUNT; i++)
+    out.printf("openiris_frames_dropped_total{transport=\"%s\"} %llu\n",
+               TRANSPORT_LABELS[i], framesDropped[i].load());
+  out.print("# HELP openiris_frame_bytes_total Bytes written per transport\n"
+            "# TYPE openiris_frame_bytes_total counter\n");
+  for (size_t i = 0; i < TRANSPORT_COUNT; i++)
+    out.printf("openiris_frame_bytes_total{transport=\"%s\"} %llu\n",
+               TRANSPORT_LABELS[i], frameBytes[i].load());
+
+  out.print("# HELP openiris_fps Frames per second over the last few frames\n"
+            "# TYPE openiris_fps gauge\n");
+  for (size_t i = 0; i < TRANSPORT_COUNT; i++)
+    out.printf("openiris_fps{transport=\"%s\"} %.2f\n", TRANSPORT_LABELS[i],
+               this->getFps((FrameTransport_e)i));
+
+  out.print("# HELP openiris_frame_latency_seconds Capture to send latency\n"
+            "# TYPE openiris_frame_latency_seconds histogram\n");
+  for (size_t i = 0; i < TRANSPORT_COUNT; i++) {
+    char labels[32];
+    snprintf(labels, sizeof(labels), "transport=\"%s\"", TRANSPORT_LABELS[i]);
+    frameLatency[i].write(out, "openiris_frame_latency_seconds", labels);
+  }
+  out.print("# HELP openiris_frame_size_bytes Size of the frames sent\n"
+            "# TYPE openiris_frame_size_bytes histogram\n");
+  frameSize.write(out, "openiris_frame_size_bytes", "");
+  out.print(
+      "# HELP openiris_camera_capture_seconds Time spent getting a frame\n"
+      "# TYPE openiris_camera_capture_seconds histogram\n");
+  captureDuration.write(out, "openiris_camera_capture_seconds", "");
+
+  out.printf(
+      "# HELP openiris_heap_free_bytes Free heap\n"
+      "# TYPE openiris_heap_free_bytes gauge\n"
+      "openiris_heap_free_bytes{region=\"internal\"} %u\n"
+      "openiris_heap_free_bytes{region=\"psram\"} %u\n",
+      ESP.getFreeHeap(), ESP.getFreePsram());
+  out.printf(
+      "# HELP openiris_heap_min_free_bytes Lowest free heap since boot\n"
+      "# TYPE openiris_heap_min_free_bytes gauge\n"
+      "openiris_heap_min_free_bytes{region=\"internal\"} %u\n"
+      "openiris_heap_min_free_bytes{region=\"psram\"} %u\n",
+      ESP.getMinFreeHeap(), ESP.getMinFreePsram());
+  out.printf(
+      "# HELP openiris_psram_size_bytes Total PSRAM, 0 without\n"
+      "# TYPE openiris_psram_size_bytes gauge\n"
+      "openiris_psram_size_bytes %u\n",
+      ESP.getPsramSize());
+
+  LinkQuality::LinkStats_t link = linkQuality.getStats();
+  out.printf(
+      "# HELP openiris_wifi_connected Whether the station is connected\n"
+      "# TYPE openiris_wifi_connected gauge\n"
+      "openiris_wifi_connected %d\n",
+      link.connected ? 1 : 0);
+  out.printf(
+      "# HELP openiris_wifi_rssi_dbm Smoothed signal strength\n"
+      "# TYPE openiris_wifi_rssi_dbm gauge\n"
+      "openiris_wifi_rssi_dbm %d\n",
+      linkQuality.getRSSI());
+  out.printf(
+      "# HELP openiris_tcp_retransmits_total TCP retransmissions\n"
+      "# TYPE openiris_tcp_retransmits_total counter\n"
+      "openiris_tcp_retransmits_total %u\n",
+      link.tcp_retransmits);
+  out.print(
+      "# HELP openiris_wifi_connect_seconds Connect or reconnect to getting "
+      "an IP\n"
+      "# TYPE openiris_wifi_connect_seconds histogram\n");
+  connectDuration.write(out, "openiris_wifi_connect_seconds", "");
+
+  out.printf(
+      "# HELP openiris_uptime_seconds Time since boot\n"
+      "# TYPE openiris_uptime_seconds gauge\n"
+      "openiris_uptime_seconds %.3f\n",
+      esp_timer_get_time() / 1000000.0);
+  out.print(
+      "# HELP openiris_first_frame_seconds Boot to first frame, 0 if none "
+      "yet\n"
+      "# TYPE openiris_first_frame_seconds gauge\n");
+  for (size_t i = 0; i < TRANSPORT_COUNT; i++)
+    out.printf("openiris_first_frame_seconds{transport=\"%s\"} %.3f\n",
+               TRANSPORT_LABELS[i],
+               bootSequence.getFirstFrameTime((FrameTransport_e)i) / 1000.0f);
+}
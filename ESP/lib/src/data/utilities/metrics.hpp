@@ -0,0 +1,133 @@
+#pragma once
+#ifndef METRICS_HPP
+#define METRICS_HPP
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+#include "tasks/bootSequence.hpp"
+
+//! upper bounds plus the +Inf bucket
+#define METRICS_HISTOGRAM_MAX_BUCKETS 12
+
+enum MetricCounter_e {
+  METRIC_CAMERA_CAPTURE_ERRORS,
+  METRIC_CAMERA_INIT_FAILURES,
+  METRIC_WIFI_DISCONNECTS,
+  METRIC_WIFI_RECONNECTS,
+  METRIC_WIFI_ROAMS,
+  METRIC_API_REQUESTS,
+  METRIC_COMMANDS,
+  METRIC_COUNTER_COUNT,
+};
+
+/**
+ * @brief A 64 bit counter out of two 32 bit atomics, the ESP32 has no
+ * lock-free 64 bit atomics
+ * @details The carry into the high word lands right after the low word
+ * wrapped, a reader in between sees the value 2^32 lower once
+ */
+class MetricsCounter {
+ public:
+  MetricsCounter() : low(0), high(0) {}
+  void add(uint32_t value) {
+    uint32_t previous = __atomic_fetch_add(&low, value, __ATOMIC_RELAXED);
+    if (previous + value < previous)
+      __atomic_fetch_add(&high, 1, __ATOMIC_RELAXED);
+  }
+  uint64_t load() const {
+    uint32_t hi, lo;
+    do {
+      hi = __atomic_load_n(&high, __ATOMIC_RELAXED);
+      lo = __atomic_load_n(&low, __ATOMIC_RELAXED);
+    } while (hi != __atomic_load_n(&high, __ATOMIC_RELAXED));
+    return ((uint64_t)hi << 32) | lo;
+  }
+
+ private:
+  uint32_t low;
+  uint32_t high;
+};
+
+/**
+ * @brief Counts into the slot of the core it runs on, so the two cores never
+ * contend on the same word
+ */
+class PerCoreCounter {
+ public:
+  void add(uint32_t value = 1) { cores[xPortGetCoreID()].add(value); }
+  uint64_t load() const {
+    uint64_t total = 0;
+    for (const auto& core : cores)
+      total += core.load();
+    return total;
+  }
+
+ private:
+  MetricsCounter cores[portNUM_PROCESSORS];
+};
+
+/**
+ * @brief Fixed bucket histogram, observing is a bucket search and two atomic
+ * adds
+ * @details Values are recorded as integers (microseconds, bytes) and divided
+ * by the unit on export, so the buckets come out in Prometheus base units
+ */
+class MetricsHistogram {
+ public:
+  MetricsHistogram(const uint32_t* bounds, size_t boundCount, float unit);
+  void observe(uint32_t value);
+  void write(Print& out, const char* name, const char* labels) const;
+
+ private:
+  const uint32_t* bounds;
+  size_t boundCount;
+  float unit;
+  //! not cumulative, the last one is +Inf
+  PerCoreCounter buckets[METRICS_HISTOGRAM_MAX_BUCKETS];
+  PerCoreCounter sum;
+};
+
+/**
+ * @brief Counters, histograms and gauges describing the running tracker, in
+ * the Prometheus text format
+ * @details Updating never locks or allocates, the transports call it for
+ * every frame. The gauges (heap, PSRAM, RSSI, fps) are read when exported.
+ * Scrape GET /metrics on the API server or send the get_metrics command over
+ * serial.
+ */
+class Metrics {
+ public:
+  Metrics();
+  void count(MetricCounter_e counter, uint32_t value = 1);
+  //! a frame (or a pupil result) went out, bytes as written to the transport
+  void frameSent(FrameTransport_e transport,
+                 size_t bytes,
+                 const struct timeval& captured);
+  //! a captured frame never made it out, e.g. the encoding failed
+  void frameDropped(FrameTransport_e transport);
+  void observeCapture(int64_t duration_us);
+  //! a connect or reconnect, from starting it to getting an IP
+  void observeConnect(uint32_t duration_ms);
+  //! over the last few frames, 0 once the transport stopped sending
+  float getFps(FrameTransport_e transport) const;
+  //! the Prometheus text exposition, printed as it is read
+  void writePrometheus(Print& out);
+
+ private:
+  PerCoreCounter counters[METRIC_COUNTER_COUNT];
+  PerCoreCounter framesSent[TRANSPORT_COUNT];
+  PerCoreCounter framesDropped[TRANSPORT_COUNT];
+  PerCoreCounter frameBytes[TRANSPORT_COUNT];
+  MetricsHistogram frameLatency[TRANSPORT_COUNT];
+  MetricsHistogram frameSize;
+  MetricsHistogram captureDuration;
+  MetricsHistogram connectDuration;
+  //! low 32 bits of esp_timer_get_time(), the differences survive the wrap
+  uint32_t lastFrame_us[TRANSPORT_COUNT];
+  //! moving average of the time between frames, 0 until the second frame
+  uint32_t frameInterval_us[TRANSPORT_COUNT];
+};
+
+extern Metrics metrics;
+
+#endif  // METRICS_HPP
@@ -26,19 +26,6 @@ bool Network_Utilities::loopWifiScan()
     return (networks > 0);
 }
 
-// Take measurements of the Wi-Fi strength and return the average result.
-int Network_Utilities::getStrength(int points) // TODO: add to JSON doc
-{
-    int32_t rssi = 0, averageRSSI = 0;
-    for (int i = 0; i < points; i++)
-    {
-        rssi += WiFi.RSSI();
-        my_delay(0.02L);
-    }
-    averageRSSI = rssi / points;
-    return averageRSSI;
-}
-
 void Network_Utilities::my_delay(volatile long delay_time)
 {
     delay_time = delay_time * 1e6L;
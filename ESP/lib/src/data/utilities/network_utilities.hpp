@@ -11,6 +11,5 @@ namespace Network_Utilities {
   void my_delay(volatile long delay_time);
   void checkWiFiState();
   std::string generateDeviceID();
-  int getStrength(int points);
 }  // namespace Network_Utilities
 #endif  // !UTILITIES_hpp
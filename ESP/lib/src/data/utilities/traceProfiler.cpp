@@ -0,0 +1,136 @@
+#include "traceProfiler.hpp"
+
+TraceProfiler traceProfiler;
+
+TraceProfiler::TraceProfiler()
+    : lock(portMUX_INITIALIZER_UNLOCKED), events(nullptr), head(0), count(0) {
+#if TRACE_PROFILER_ENABLED
+  // allocated here so the ring costs nothing when profiling is compiled out
+  events = (TraceEvent_t*)calloc(TRACE_PROFILER_CAPACITY, sizeof(TraceEvent_t));
+#endif
+}
+
+void TraceProfiler::record(const char* name, int64_t start_us, int64_t end_us) {
+  this->push({
+      .name = name,
+      .start_us = (uint32_t)start_us,
+      .duration_us = (uint32_t)(end_us - start_us),
+      .core = (uint8_t)xPortGetCoreID(),
+  });
+}
+
+void TraceProfiler::instant(const char* name) {
+  this->push({
+      .name = name,
+      .start_us = (uint32_t)esp_timer_get_time(),
+      .duration_us = UINT32_MAX,
+      .core = (uint8_t)xPortGetCoreID(),
+  });
+}
+
+void TraceProfiler::push(const TraceEvent_t& event) {
+  if (!events)
+    return;
+
+  portENTER_CRITICAL(&lock);
+  events[head] = event;
+  head = (head + 1) % TRACE_PROFILER_CAPACITY;
+  if (count < TRACE_PROFILER_CAPACITY)
+    count++;
+  portEXIT_CRITICAL(&lock);
+}
+
+void TraceProfiler::clear() {
+  portENTER_CRITICAL(&lock);
+  head = 0;
+  count = 0;
+  portEXIT_CRITICAL(&lock);
+}
+
+std::vector<TraceProfiler::TraceEvent_t> TraceProfiler::snapshot() {
+  std::vector<TraceEvent_t> copy;
+  if (!events)
+    return copy;
+
+  // reserved up front, no allocating while holding the lock
+  copy.reserve(TRACE_PROFILER_CAPACITY);
+  portENTER_CRITICAL(&lock);
+  size_t oldest =
+      (head + TRACE_PROFILER_CAPACITY - count) % TRACE_PROFILER_CAPACITY;
+  for (size_t i = 0; i < count; i++)
+    copy.push_back(events[(oldest + i) % TRACE_PROFILER_CAPACITY]);
+  portEXIT_CRITICAL(&lock);
+  return copy;
+}
+
+void TraceProfiler::exportChromeTrace(Print& out) {
+  TraceExporter exporter;
+  uint8_t buffer[256];
+  size_t len;
+  while ((len = exporter.read(buffer, sizeof(buffer))) > 0)
+    out.write(buffer, len);
+}
+
+TraceExporter::TraceExporter()
+    : events(traceProfiler.snapshot()),
+      nextEvent(0),
+      started(false),
+      finished(false),
+      pendingOffset(0) {}
+
+size_t TraceExporter::read(uint8_t* buffer, size_t maxLen) {
+  size_t written = 0;
+  while (written < maxLen) {
+    if (pendingOffset >= pending.size() && !this->nextPart())
+      break;
+    size_t len = min(maxLen - written, pending.size() - pendingOffset);
+    memcpy(buffer + written, pending.data() + pendingOffset, len);
+    pendingOffset += len;
+    written += len;
+  }
+  return written;
+}
+
+/**
+ * @brief Formats the header, a single event or the footer into pending
+ * @return false once everything was handed out
+ */
+bool TraceExporter::nextPart() {
+  pendingOffset = 0;
+  if (!started) {
+    started = true;
+    pending =
+        "{\"displayTimeUnit\": \"ms\", \"traceEvents\": ["
+        "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+        "\"tid\": 0, \"args\": {\"name\": \"core 0\"}}, "
+        "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+        "\"tid\": 1, \"args\": {\"name\": \"core 1\"}}";
+    return true;
+  }
+
+  if (nextEvent < events.size()) {
+    const TraceProfiler::TraceEvent_t& event = events[nextEvent++];
+    char line[128];
+    if (event.duration_us == UINT32_MAX)
+      snprintf(line, sizeof(line),
+               ", {\"name\": \"%s\", \"ph\": \"i\", \"s\": \"t\", "
+               "\"ts\": %u, \"pid\": 1, \"tid\": %u}",
+               event.name, event.start_us, event.core);
+    else
+      snprintf(line, sizeof(line),
+               ", {\"name\": \"%s\", \"ph\": \"X\", \"ts\": %u, "
+               "\"dur\": %u, \"pid\": 1, \"tid\": %u}",
+               event.name, event.start_us, event.duration_us, event.core);
+    pending = line;
+    return true;
+  }
+
+  if (!finished) {
+    finished = true;
+    pending = "]}";
+    return true;
+  }
+
+  pending.clear();
+  return false;
+}
@@ -0,0 +1,105 @@
+#pragma once
+#ifndef TRACE_PROFILER_HPP
+#define TRACE_PROFILER_HPP
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <string>
+#include <vector>
+
+#ifndef TRACE_PROFILER_ENABLED
+#define TRACE_PROFILER_ENABLED 0
+#endif
+
+//! events kept, the oldest get overwritten - 16 bytes each
+#define TRACE_PROFILER_CAPACITY 512
+
+/**
+ * @brief Records where boot and frame time goes, as begin/duration events in
+ * a fixed RAM ring, exported in the Chrome trace format
+ * @details Scopes are marked with TRACE_SCOPE("name") and single points in
+ * time with TRACE_INSTANT("name"), both compile to nothing unless built with
+ * TRACE_PROFILER_ENABLED=1. Names have to be string literals, only the
+ * pointer gets stored. Events carry the core they ran on as the thread, open
+ * the export in chrome://tracing or https://ui.perfetto.dev.
+ */
+class TraceProfiler {
+ public:
+  struct TraceEvent_t {
+    const char* name;
+    //! low 32 bits of esp_timer_get_time(), wraps after ~71 minutes
+    uint32_t start_us;
+    //! UINT32_MAX for an instant event
+    uint32_t duration_us;
+    uint8_t core;
+  };
+
+  TraceProfiler();
+  void record(const char* name, int64_t start_us, int64_t end_us);
+  void instant(const char* name);
+  void clear();
+  //! copy of the ring, oldest first
+  std::vector<TraceEvent_t> snapshot();
+  //! writes the ring as Chrome trace JSON
+  void exportChromeTrace(Print& out);
+
+ private:
+  void push(const TraceEvent_t& event);
+
+  portMUX_TYPE lock;
+  TraceEvent_t* events;
+  size_t head;
+  size_t count;
+};
+
+extern TraceProfiler traceProfiler;
+
+/**
+ * @brief Formats a snapshot of the ring as Chrome trace JSON piece by piece,
+ * so it can feed a chunked HTTP response without the whole document in RAM
+ */
+class TraceExporter {
+ public:
+  TraceExporter();
+  //! fills the buffer with the next part of the JSON, 0 once done
+  size_t read(uint8_t* buffer, size_t maxLen);
+
+ private:
+  bool nextPart();
+
+  std::vector<TraceProfiler::TraceEvent_t> events;
+  size_t nextEvent;
+  bool started;
+  bool finished;
+  std::string pending;
+  size_t pendingOffset;
+};
+
+/**
+ * @brief Records the time between its construction and destruction
+ */
+class TraceScope {
+ public:
+  explicit TraceScope(const char* name)
+      : name(name), start_us(esp_timer_get_time()) {}
+  ~TraceScope() { traceProfiler.record(name, start_us, esp_timer_get_time()); }
+
+ private:
+  const char* name;
+  int64_t start_us;
+};
+
+#if TRACE_PROFILER_ENABLED
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(_trace_scope_, __LINE__)(name)
+#define TRACE_INSTANT(name) traceProfiler.instant(name)
+#else
+#define TRACE_SCOPE(name) \
+  do {                    \
+  } while (0)
+#define TRACE_INSTANT(name) \
+  do {                      \
+  } while (0)
+#endif  // TRACE_PROFILER_ENABLED
+
+#endif  // TRACE_PROFILER_HPP
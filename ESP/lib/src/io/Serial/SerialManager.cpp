@@ -1,21 +1,33 @@
 #include "SerialManager.hpp"
 
+static StaticSemaphore_t serialMutexBuffer;
+static SemaphoreHandle_t serialMutex =
+    xSemaphoreCreateRecursiveMutexStatic(&serialMutexBuffer);
+
+SerialLock::SerialLock() {
+  xSemaphoreTakeRecursive(serialMutex, portMAX_DELAY);
+}
+
+SerialLock::~SerialLock() {
+  xSemaphoreGiveRecursive(serialMutex);
+}
+
 SerialManager::SerialManager(CommandManager* commandManager)
     : commandManager(commandManager) {}  
 
 void SerialManager::sendQuery(QueryAction action, 
                              QueryStatus status,
                              std::string additional_info) {
-  JsonDocument doc;
+  JsonDocument doc(&jsonArena);
   doc["action"] = queryActionMap.at(action);
   doc["status"] = static_cast<int>(status);
   if (!additional_info.empty()) {
     doc["info"] = additional_info;
   }
   
-  String output;
-  serializeJson(doc, output);
-  Serial.println(output);
+  SerialLock serialLock;
+  serializeJson(doc, Serial);
+  Serial.println();
 }
 
 void SerialManager::checkUSBMode() {
@@ -28,6 +40,11 @@ void SerialManager::checkUSBMode() {
 }
 
 void SerialManager::send_frame() {
+  // the camera is being reinitialized, commands keep working meanwhile
+  CameraPass pass;
+  if (!pass)
+    return;
+
   if (!last_frame)
     last_frame = esp_timer_get_time();
 
@@ -36,28 +53,63 @@ void SerialManager::send_frame() {
   size_t len = 0;
   uint8_t* buf = NULL;
 
-  auto fb = esp_camera_fb_get();
+  FrameMetadata_t metadata;
+  FrameStats_t stats = {};
+  camera_fb_t* fb;
+  {
+    TRACE_SCOPE("capture");
+    int64_t capture_start = esp_timer_get_time();
+    fb = esp_camera_fb_get();
+    metrics.observeCapture(esp_timer_get_time() - capture_start);
+  }
+  // a single failed capture shouldn't stop the stream for good
+  err = fb ? ESP_OK : ESP_FAIL;
   if (fb) {
     len = fb->len;
     buf = fb->buf;
-  } else
-    err = ESP_FAIL;
+    metadata = FrameMetadata::fromFrame(fb);
+    if (frameStatsProvider.process(fb, &stats))
+      FrameMetadata::attachStats(metadata, stats);
+    snapshotProvider.offer(fb, &metadata);
+  }
 
   // if we failed to capture the frame, we bail, but we still want to listen to
   // commands
   if (err != ESP_OK) {
     log_e("Camera capture failed with response: %s", esp_err_to_name(err));
+    metrics.count(METRIC_CAMERA_CAPTURE_ERRORS);
     return;
   }
 
-  Serial.write(ETVR_HEADER, 2);
-  Serial.write(ETVR_HEADER_FRAME, 2);
-  len_bytes[0] = len & 0xFF;
-  len_bytes[1] = (len >> CHAR_BIT) & 0xFF;
-  Serial.write(len_bytes, 2);
-  Serial.write((const char*)buf, len);
+  size_t sent_len = 0;
+  {
+    TRACE_SCOPE("serial_send");
+    SerialLock serialLock;
+    if (this->commandManager->getDeviceConfig()
+            ->getStreamConfig()
+            .serialMetadata)
+      this->send_metadata(metadata);
+
+    if (changeDetector.isUnchanged(fb, metadata.sequence, &stats)) {
+      this->send_unchanged(metadata.sequence);
+      sent_len = 6 + SERIAL_UNCHANGED_SIZE;
+      frameSuppression.countSuppressed(len, sent_len);
+    } else {
+      Serial.write(ETVR_HEADER, 2);
+      Serial.write(ETVR_HEADER_FRAME, 2);
+      len_bytes[0] = len & 0xFF;
+      len_bytes[1] = (len >> CHAR_BIT) & 0xFF;
+      Serial.write(len_bytes, 2);
+      Serial.write((const char*)buf, len);
+      sent_len = 6 + len;
+      frameSuppression.countSent(sent_len);
+      bootSequence.recordFirstFrame(TRANSPORT_SERIAL);
+    }
+  }
 
   if (fb) {
+    frameLatencyTracker.record(fb->timestamp);
+    metrics.frameSent(TRANSPORT_SERIAL, sent_len, fb->timestamp);
     esp_camera_fb_return(fb);
     fb = NULL;
     buf = NULL;
@@ -69,8 +121,57 @@ void SerialManager::send_frame() {
   long request_end = millis();
   long latency = request_end - last_request_time;
   last_request_time = request_end;
-  log_d("Size: %uKB, Time: %ums (%ifps)\n", len / 1024, latency,
-        1000 / latency);
+  BLOG_D(LOG_MODULE_SERIAL, "Size: %uKB, Time: %ums (%ifps)", len / 1024,
+         latency, latency ? 1000 / latency : 0);
+}
+
+/**
+ * @brief Sends the metadata of the frame that follows as its own packet, so
+ * clients that don't know about it can skip it by its header
+ */
+void SerialManager::send_metadata(FrameMetadata_t& metadata) {
+  uint8_t packet[2 + FRAME_METADATA_SIZE];
+
+  FrameMetadata::markSent(metadata);
+  size_t len = FrameMetadata::pack(metadata, packet + 2);
+  packet[0] = len & 0xFF;
+  packet[1] = (len >> CHAR_BIT) & 0xFF;
+
+  Serial.write(ETVR_HEADER, 2);
+  Serial.write(ETVR_HEADER_METADATA, 2);
+  Serial.write(packet, len + 2);
+}
+
+/**
+ * @brief Stands in for a frame that is a near-duplicate of the last one sent,
+ * carries the sequence of the skipped frame and of the frame to show instead
+ */
+void SerialManager::send_unchanged(uint32_t sequence) {
+  uint8_t packet[2 + SERIAL_UNCHANGED_SIZE];
+  uint32_t reference = changeDetector.getReferenceSequence();
+  packet[0] = SERIAL_UNCHANGED_SIZE;
+  packet[1] = 0;
+  for (int i = 0; i < 4; i++) {
+    packet[2 + i] = (sequence >> (i * 8)) & 0xFF;
+    packet[6 + i] = (reference >> (i * 8)) & 0xFF;
+  }
+
+  Serial.write(ETVR_HEADER, 2);
+  Serial.write(ETVR_HEADER_UNCHANGED, 2);
+  Serial.write(packet, sizeof(packet));
+}
+
+void SerialManager::sendSnapshot(Snapshot_t& snapshot) {
+  uint8_t len_bytes[4];
+  for (int i = 0; i < 4; i++)
+    len_bytes[i] = (snapshot.len >> (i * 8)) & 0xFF;
+
+  SerialLock serialLock;
+  send_metadata(snapshot.metadata);
+  Serial.write(ETVR_HEADER, 2);
+  Serial.write(ETVR_HEADER_SNAPSHOT, 2);
+  Serial.write(len_bytes, 4);
+  Serial.write(snapshot.jpeg, snapshot.len);
 }
 
 void SerialManager::init() {
@@ -86,21 +187,27 @@ void SerialManager::init() {
 }
 
 void SerialManager::run() {
+  MEMORY_SCOPE(MEMORY_MODULE_SERIAL);
   // Process any available commands first to ensure mode changes are detected immediately
   if (Serial.available()) {
-    JsonDocument doc;
+    JsonDocument doc(&jsonArena);
     DeserializationError deserializationError = deserializeJson(doc, Serial);
 
     if (deserializationError) {
       log_e("Command deserialization failed: %s", deserializationError.c_str());
     } else {
       CommandsPayload commands = {doc};
+      // the responses go out in one piece
+      SerialLock serialLock;
       this->commandManager->handleCommands(commands);
     }
   }
   
   DeviceMode currentMode = this->commandManager->getDeviceConfig()->getDeviceModeConfig().mode;
-  if (currentMode == DeviceMode::USB_MODE) {
+  // the pupil tracker owns the camera and sends its results on its own, and
+  // the camera might still be initializing on boot
+  if (currentMode == DeviceMode::USB_MODE && bootSequence.isReady(BOOT_CAMERA) &&
+      !this->commandManager->getDeviceConfig()->getPupilConfig().enabled) {
     this->send_frame();
   }
 }
@@ -6,11 +6,29 @@
 #include <ArduinoJson.h>
 #include <USBCDC.h>
 #include <esp_camera.h>
+#include <freertos/semphr.h>
 #include "data/CommandManager/CommandManager.hpp"
 #include "data/config/project_config.hpp"
+#include "data/utilities/binaryLog.hpp"
+#include "data/utilities/jsonArena.hpp"
+#include "data/utilities/metrics.hpp"
+#include "data/utilities/traceProfiler.hpp"
+#include "io/camera/cameraGate.hpp"
+#include "io/camera/frameMetadata.hpp"
+#include "io/camera/frameSuppression.hpp"
+#include "io/camera/latencyTracker.hpp"
+#include "io/camera/snapshot.hpp"
+#include "tasks/bootSequence.hpp"
 
 const char* const ETVR_HEADER = "\xff\xa0";
 const char* const ETVR_HEADER_FRAME = "\xff\xa1";
+const char* const ETVR_HEADER_METADATA = "\xff\xa2";
+const char* const ETVR_HEADER_UNCHANGED = "\xff\xa3";
+const char* const ETVR_HEADER_PUPIL = "\xff\xa4";
+const char* const ETVR_HEADER_SNAPSHOT = "\xff\xa5";
+
+//! u32 sequence of the skipped frame, u32 sequence of the last sent frame
+#define SERIAL_UNCHANGED_SIZE 8
 
 enum QueryAction {
   READY_TO_RECEIVE,
@@ -30,6 +48,19 @@ const std::unordered_map<QueryAction, std::string> queryActionMap = {
     {QueryAction::CONNECT_TO_WIFI, "connect_to_wifi"},
 };
 
+/**
+ * @brief Holds the serial port for a whole packet or command response, the
+ * pupil tracker writes its packets from its own task next to the loop
+ * @note Recursive, command handlers send packets of their own
+ */
+class SerialLock {
+ public:
+  SerialLock();
+  ~SerialLock();
+  SerialLock(const SerialLock&) = delete;
+  SerialLock& operator=(const SerialLock&) = delete;
+};
+
 class SerialManager {
  private:
   esp_err_t err = ESP_OK;
@@ -37,8 +68,13 @@ class SerialManager {
 
   int64_t last_frame = 0;
   long last_request_time = 0;
+  FrameChangeDetector changeDetector;
+  //! commands and queries, all on the loop task
+  JsonArena jsonArena;
 
   void send_frame();
+  static void send_metadata(FrameMetadata_t& metadata);
+  void send_unchanged(uint32_t sequence);
 
  public:
   SerialManager(CommandManager* commandManager);
@@ -48,6 +84,11 @@ class SerialManager {
   void init();
   void run();
   void checkUSBMode();
+  /**
+   * @brief The metadata packet, then the JPEG with a 4 byte length - unlike
+   * a frame packet it may be a full resolution still
+   */
+  static void sendSnapshot(Snapshot_t& snapshot);
 };
 
 #endif
\ No newline at end of file
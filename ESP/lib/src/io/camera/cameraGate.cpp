@@ -0,0 +1,60 @@
+#include "cameraGate.hpp"
+
+CameraGate cameraGate;
+
+//! closed until the camera initialized the first time
+CameraGate::CameraGate()
+    : lock(portMUX_INITIALIZER_UNLOCKED), state(CLOSED), inside(0) {}
+
+bool CameraGate::enter() {
+  portENTER_CRITICAL(&lock);
+  bool entered = state == OPEN;
+  if (entered)
+    inside++;
+  portEXIT_CRITICAL(&lock);
+  return entered;
+}
+
+void CameraGate::leave() {
+  portENTER_CRITICAL(&lock);
+  if (inside)
+    inside--;
+  portEXIT_CRITICAL(&lock);
+}
+
+bool CameraGate::close(TickType_t timeout) {
+  portENTER_CRITICAL(&lock);
+  state = CLOSED;
+  portEXIT_CRITICAL(&lock);
+
+  TickType_t start = xTaskGetTickCount();
+  while (inside) {
+    if (xTaskGetTickCount() - start >= timeout) {
+      log_e("[Camera]: %u frame consumers did not let go of the camera",
+            inside);
+      this->open();
+      return false;
+    }
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  return true;
+}
+
+void CameraGate::open() {
+  portENTER_CRITICAL(&lock);
+  state = OPEN;
+  portEXIT_CRITICAL(&lock);
+}
+
+void CameraGate::fail() {
+  portENTER_CRITICAL(&lock);
+  state = FAILED;
+  portEXIT_CRITICAL(&lock);
+}
+
+CameraPass::CameraPass() : entered(cameraGate.enter()) {}
+
+CameraPass::~CameraPass() {
+  if (entered)
+    cameraGate.leave();
+}
@@ -0,0 +1,69 @@
+#pragma once
+#ifndef CAMERA_GATE_HPP
+#define CAMERA_GATE_HPP
+#include <Arduino.h>
+
+//! how long a reinit waits for the consumers to hand their frames back
+#define CAMERA_DRAIN_TIMEOUT_MS 2000
+//! how often a consumer looks again while the camera is reinitializing
+#define CAMERA_GATE_RETRY_MS 50
+
+/**
+ * @brief Keeps the frame consumers out of the driver while the camera gets
+ * reinitialized
+ * @details Everything taking frames - the MJPEG stream, the serial transport,
+ * snapshots and the pupil tracker - enters the gate before
+ * esp_camera_fb_get() and leaves it once the buffer went back. A reinit
+ * closes the gate, waits for everyone inside to leave and only then deinits
+ * the driver, so nobody is left holding a buffer that got freed.
+ *
+ * Stays closed and marked failed if the camera didn't come back up.
+ */
+class CameraGate {
+ public:
+  CameraGate();
+  //! @return false if the camera is not there, don't touch the driver then
+  bool enter();
+  void leave();
+  /**
+   * @brief Lets nobody in anymore and waits for the ones inside to leave
+   * @return false if someone is still inside after the timeout, the gate is
+   * open again then
+   */
+  bool close(TickType_t timeout);
+  void open();
+  //! closed for good, until the next reinit
+  void fail();
+  bool isOpen() const { return state == OPEN; }
+  bool hasFailed() const { return state == FAILED; }
+
+ private:
+  enum State_e {
+    CLOSED,
+    OPEN,
+    FAILED,
+  };
+
+  portMUX_TYPE lock;
+  volatile State_e state;
+  volatile uint8_t inside;
+};
+
+/**
+ * @brief One consumer inside the gate for as long as it's in scope
+ */
+class CameraPass {
+ public:
+  CameraPass();
+  ~CameraPass();
+  CameraPass(const CameraPass&) = delete;
+  CameraPass& operator=(const CameraPass&) = delete;
+  explicit operator bool() const { return entered; }
+
+ private:
+  bool entered;
+};
+
+extern CameraGate cameraGate;
+
+#endif  // CAMERA_GATE_HPP
@@ -1,7 +1,11 @@
 #include "cameraHandler.hpp"
+#include "io/camera/cameraGate.hpp"
+#include "io/camera/frameStats.hpp"
+#include "io/camera/frameSuppression.hpp"
+#include "io/camera/latencyTracker.hpp"
 
 CameraHandler::CameraHandler(ProjectConfig& configManager)
-    : configManager(configManager) {}
+    : camera_sensor(nullptr), configManager(configManager) {}
 
 void CameraHandler::setupCameraPinout() {
   // Workaround for espM5SStack not having a defined camera
@@ -41,7 +45,6 @@ void CameraHandler::setupCameraPinout() {
 
   config.ledc_channel = LEDC_CHANNEL_0;
   config.ledc_timer = LEDC_TIMER_0;
-  config.grab_mode = CAMERA_GRAB_LATEST;
   config.pin_d0 = Y2_GPIO_NUM;
   config.pin_d1 = Y3_GPIO_NUM;
   config.pin_d2 = Y4_GPIO_NUM;
@@ -62,22 +65,56 @@ void CameraHandler::setupCameraPinout() {
 }
 
 void CameraHandler::setupBasicResolution() {
-  config.pixel_format = PIXFORMAT_JPEG;
+  // the pupil tracker works on raw grayscale frames instead of JPEGs
+  bool grayscale = configManager.getPupilConfig().enabled;
+  config.pixel_format = grayscale ? PIXFORMAT_GRAYSCALE : PIXFORMAT_JPEG;
   config.frame_size = CAM_RESOLUTION;
 
+  ProjectConfig::CameraConfig_t cameraConfig = configManager.getCameraConfig();
+  config.grab_mode = cameraConfig.grab_mode == CAMERA_GRAB_WHEN_EMPTY
+                         ? CAMERA_GRAB_WHEN_EMPTY
+                         : CAMERA_GRAB_LATEST;
+
   if (!psramFound()) {
     log_e("[Camera]: Did not find psram, setting lower image quality");
     config.fb_location = CAMERA_FB_IN_DRAM;
     config.jpeg_quality = 9;
-    config.fb_count = 2;
+    // DRAM can't really fit more than two 240x240 buffers next to wifi
+    config.fb_count =
+        cameraConfig.fb_count ? min(cameraConfig.fb_count, (uint8_t)2) : 2;
+    // raw frames are much bigger than JPEGs, only one of them fits
+    if (grayscale) {
+      config.fb_count = 1;
+      config.grab_mode = CAMERA_GRAB_WHEN_EMPTY;
+    }
+    log_d("[Camera]: Using %d frame buffers, grab mode: %d", config.fb_count,
+          config.grab_mode);
     return;
   }
 
   log_d("[Camera]: Found psram, setting the higher image quality");
   config.jpeg_quality = 7;  // 0-63 lower number = higher quality, more latency
                             // and less fps   7 for most fps, 5 for best quality
-  config.fb_count = 3;
+  config.fb_count =
+      cameraConfig.fb_count ? min(cameraConfig.fb_count, (uint8_t)3) : 3;
   log_d("[Camera]: Setting fb_location to CAMERA_FB_IN_PSRAM");
+  log_d("[Camera]: Using %d frame buffers, grab mode: %d", config.fb_count,
+        config.grab_mode);
+}
+
+/**
+ * @brief Checks whether the stored frame buffer settings or pixel format
+ * differ from the ones the driver is currently running with, those can only be
+ * applied by reinitializing the camera
+ */
+bool CameraHandler::hasDriverConfigChanged() {
+  camera_config_t applied = config;
+  this->setupBasicResolution();
+  bool changed = applied.fb_count != config.fb_count ||
+                 applied.grab_mode != config.grab_mode ||
+                 applied.pixel_format != config.pixel_format;
+  config = applied;
+  return changed;
 }
 
 void CameraHandler::setupCameraSensor() {
@@ -164,6 +201,7 @@ bool CameraHandler::setupCamera() {
         "fix the "
         "camera and reboot the device.\r\n");
     ledStateManager.setState(LEDStates_e::_Camera_Error);
+    metrics.count(METRIC_CAMERA_INIT_FAILURES);
     return false;
   }
 
@@ -250,38 +288,138 @@ int CameraHandler::setVieWindow(int offsetX,
   return 0;
 }
 
-//! either hardware(1) or software(0)
-void CameraHandler::resetCamera(bool type) {
+/**
+ * @brief Reinitializes the driver, either by power cycling the module(1) or in
+ * software(0)
+ * @details Blocks until the frame consumers handed their buffers back, run
+ * it on the deferred worker only. If the camera doesn't come back the gate
+ * stays shut and the consumers stay away from the driver.
+ * @return true if the camera is up again
+ */
+bool CameraHandler::resetCamera(bool type) {
+  if (!cameraGate.close(pdMS_TO_TICKS(CAMERA_DRAIN_TIMEOUT_MS))) {
+    log_e("[Camera]: Frames are still in use, not reinitializing the camera");
+    return false;
+  }
+
+  esp_camera_deinit();
+  camera_sensor = nullptr;
   if (type) {
     // power cycle the camera module (handy if camera stops responding)
     digitalWrite(PWDN_GPIO_NUM, HIGH);  // turn power off to camera module
-    Network_Utilities::my_delay(0.3);   // a for loop with a delay of 300ms
+    vTaskDelay(pdMS_TO_TICKS(300));
     digitalWrite(PWDN_GPIO_NUM, LOW);
-    Network_Utilities::my_delay(0.3);
-    setupCamera();
+    vTaskDelay(pdMS_TO_TICKS(300));
   } else {
     // reset via software (handy if you wish to change resolution or image type
     // etc. - see test procedure)
-    esp_camera_deinit();
     Network_Utilities::my_delay(0.05);
-    setupCamera();
   }
+
+  if (!this->setupCamera()) {
+    camera_sensor = nullptr;
+    cameraGate.fail();
+    return false;
+  }
+  this->loadConfigData();
+  this->applyStreamConfig();
+  frameLatencyTracker.reset();
+  cameraGate.open();
+  return true;
+}
+
+/**
+ * @brief Brings the camera up on its own task, so it overlaps with Wi-Fi
+ * connecting and the rest of setup
+ */
+void CameraHandler::initTask(void* pvParameters) {
+  static_cast<CameraHandler*>(pvParameters)->initialize();
+  vTaskDelete(nullptr);
+}
+
+void CameraHandler::initialize() {
+  TRACE_SCOPE("camera_init");
+  bool initialized = this->setupCamera();
+  if (initialized) {
+    this->loadConfigData();
+    this->applyStreamConfig();
+    cameraGate.open();
+  } else {
+    camera_sensor = nullptr;
+    cameraGate.fail();
+  }
+  bootSequence.markDone(BOOT_CAMERA, initialized);
+}
+
+/**
+ * @brief Config changes arriving while the camera is still initializing wait
+ * for it, it picks the stored config up anyway but the sensor isn't there yet
+ */
+bool CameraHandler::waitUntilReady() {
+  if (bootSequence.waitFor(BOOT_CAMERA, pdMS_TO_TICKS(CAMERA_INIT_WAIT_MS)))
+    return true;
+  log_w("[Camera]: Camera is not ready, ignoring the config change");
+  return false;
+}
+
+void CameraHandler::applyCameraConfig() {
+  if (!this->waitUntilReady())
+    return;
+  // a camera that failed a reinit before gets another chance
+  if (!camera_sensor || this->hasDriverConfigChanged()) {
+    log_i("[Camera]: Driver config changed, reinitializing camera");
+    this->resetCamera(0);
+    return;
+  }
+  this->loadConfigData();
+  frameLatencyTracker.reset();
 }
 
 void CameraHandler::update(ConfigState_e event) {
   switch (event) {
     case ConfigState_e::configLoaded:
-      this->setupCamera();
-      this->loadConfigData();
+      // same core setup ran the init on before, the driver installs its
+      // interrupts there
+      if (xTaskCreatePinnedToCore(&CameraHandler::initTask, "CameraInit",
+                                  6144, this, 1, nullptr, 1) != pdPASS) {
+        log_e("[Camera]: Could not start the init task, initializing inline");
+        this->initialize();
+      }
       break;
     case ConfigState_e::cameraConfigUpdated:
-      this->loadConfigData();
+    case ConfigState_e::pupilConfigUpdated:
+      // may reinitialize the driver, which waits for the frame consumers and
+      // must not happen on the notifier's task
+      if (!OpenIrisTasks::Defer([this] { this->applyCameraConfig(); }))
+        log_e("[Camera]: Could not schedule applying the camera config");
+      break;
+    case ConfigState_e::streamConfigUpdated:
+      if (!this->waitUntilReady())
+        break;
+      this->applyStreamConfig();
       break;
     default:
       break;
   }
 }
 
+/**
+ * @brief The frame suppression compares the DC brightness grid of the frames,
+ * so it needs the frame stats even if they were not asked for
+ */
+void CameraHandler::applyStreamConfig() {
+  auto streamConfig = configManager.getStreamConfig();
+  frameStatsProvider.setEnabled(streamConfig.frameStats ||
+                                streamConfig.suppressUnchanged);
+  frameSuppression.configure({
+      .enabled =
+          streamConfig.suppressUnchanged && frameStatsProvider.isEnabled(),
+      .sizeDelta = streamConfig.suppressSizeDelta,
+      .dcDelta = streamConfig.suppressDCDelta,
+      .maxKeyframeInterval = streamConfig.maxKeyframeInterval,
+  });
+}
+
 std::string CameraHandler::getName() {
   return "CameraHandler";
 }
@@ -4,11 +4,17 @@
 #include "data/StateManager/StateManager.hpp"
 #include "data/config/project_config.hpp"
 #include "data/utilities/Observer.hpp"
+#include "data/utilities/metrics.hpp"
 #include "data/utilities/network_utilities.hpp"
+#include "data/utilities/traceProfiler.hpp"
+#include "tasks/tasks.hpp"
+#include "tasks/bootSequence.hpp"
 
 #define DEFAULT_XCLK_FREQ_HZ 16500000
 #define USB_DEFAULT_XCLK_FREQ_HZ 24000000
 #define OV5640_XCLK_FREQ_HZ DEFAULT_XCLK_FREQ_HZ
+//! how long a config change waits for the camera to finish initializing
+#define CAMERA_INIT_WAIT_MS 5000
 
 class CameraHandler : public IObserver<ConfigState_e> {
  private:
@@ -24,12 +30,20 @@ class CameraHandler : public IObserver<ConfigState_e> {
   int setVieWindow(int offsetX, int offsetY, int outputX, int outputY);
   void update(ConfigState_e event);
   std::string getName();
-  void resetCamera(bool type = 0);
+  bool resetCamera(bool type = 0);
+  uint8_t getFrameBufferCount() const { return config.fb_count; }
+  camera_grab_mode_t getGrabMode() const { return config.grab_mode; }
 
  private:
+  static void initTask(void* pvParameters);
+  void initialize();
+  bool waitUntilReady();
+  void applyCameraConfig();
   void loadConfigData();
   bool setupCamera();
   void setupCameraPinout();
   void setupBasicResolution();
   void setupCameraSensor();
+  bool hasDriverConfigChanged();
+  void applyStreamConfig();
 };
@@ -0,0 +1,129 @@
+#include "frameMetadata.hpp"
+#include <stdarg.h>
+#include <algorithm>
+#include <atomic>
+
+//! counts every frame taken from the driver, shared by all transports so a
+//! gap means the frame went somewhere else or was never dequeued
+static std::atomic<uint32_t> frameSequence(0);
+
+/**
+ * @brief Builds the metadata record of a freshly dequeued frame
+ * @note Call it right after esp_camera_fb_get() so dequeued_us is accurate
+ */
+FrameMetadata_t FrameMetadata::fromFrame(const camera_fb_t* fb) {
+  FrameMetadata_t metadata = {
+      .sequence = frameSequence.fetch_add(1, std::memory_order_relaxed),
+      .captured_us = (int64_t)fb->timestamp.tv_sec * 1000000LL +
+                     (int64_t)fb->timestamp.tv_usec,
+      .dequeued_us = esp_timer_get_time(),
+      .sent_us = 0,
+      .aec_value = 0,
+      .agc_gain = 0,
+      .quality = 0,
+      .flags = 0,
+      .mean_brightness = 0,
+      .histogram = {},
+  };
+
+  sensor_t* sensor = esp_camera_sensor_get();
+  if (sensor) {
+    metadata.aec_value = sensor->status.aec_value;
+    metadata.agc_gain = sensor->status.agc_gain;
+    metadata.quality = sensor->status.quality;
+  }
+  return metadata;
+}
+
+void FrameMetadata::attachStats(FrameMetadata_t& metadata,
+                                const FrameStats_t& stats) {
+  uint32_t blocks = stats.thumbnailWidth * stats.thumbnailHeight;
+  if (!stats.valid || !blocks)
+    return;
+
+  metadata.flags |= FRAME_METADATA_HAS_STATS;
+  metadata.mean_brightness = stats.mean;
+  for (int i = 0; i < FRAME_STATS_HISTOGRAM_BINS; i++)
+    metadata.histogram[i] = (stats.histogram[i] * 255 + blocks / 2) / blocks;
+}
+
+void FrameMetadata::markSent(FrameMetadata_t& metadata) {
+  metadata.sent_us = esp_timer_get_time();
+}
+
+static uint8_t* putLE(uint8_t* buffer, uint64_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; i++)
+    *buffer++ = (value >> (i * 8)) & 0xFF;
+  return buffer;
+}
+
+/**
+ * @brief Packs the record into FRAME_METADATA_SIZE little endian bytes
+ * @details Layout: u32 sequence, i64 captured_us, i64 dequeued_us,
+ * i64 sent_us, u16 aec_value, u8 agc_gain, u8 quality, u8 flags,
+ * u8 mean_brightness, u8[16] histogram
+ * @return the number of bytes written
+ */
+size_t FrameMetadata::pack(const FrameMetadata_t& metadata, uint8_t* buffer) {
+  uint8_t* it = buffer;
+  it = putLE(it, metadata.sequence, 4);
+  it = putLE(it, metadata.captured_us, 8);
+  it = putLE(it, metadata.dequeued_us, 8);
+  it = putLE(it, metadata.sent_us, 8);
+  it = putLE(it, metadata.aec_value, 2);
+  it = putLE(it, metadata.agc_gain, 1);
+  it = putLE(it, metadata.quality, 1);
+  it = putLE(it, metadata.flags, 1);
+  it = putLE(it, metadata.mean_brightness, 1);
+  memcpy(it, metadata.histogram, FRAME_STATS_HISTOGRAM_BINS);
+  it += FRAME_STATS_HISTOGRAM_BINS;
+  return it - buffer;
+}
+
+static void appendHeader(char* buffer,
+                         size_t size,
+                         size_t& len,
+                         const char* format,
+                         ...) {
+  if (len >= size)
+    return;
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buffer + len, size - len, format, args);
+  va_end(args);
+  if (written > 0)
+    len = std::min(len + written, size - 1);
+}
+
+/**
+ * @brief Renders the record as multipart part headers, each line ends with
+ * CRLF so the caller only has to terminate the header block
+ * @return the length of the headers, truncated to fit the buffer
+ */
+size_t FrameMetadata::formatHeaders(const FrameMetadata_t& metadata,
+                                    char* buffer,
+                                    size_t size) {
+  size_t len = 0;
+  appendHeader(buffer, size, len,
+               "X-Frame-Sequence: %u\r\n"
+               "X-Capture-Timestamp: %lld\r\n"
+               "X-Dequeue-Timestamp: %lld\r\n"
+               "X-Send-Timestamp: %lld\r\n"
+               "X-AEC-Value: %u\r\n"
+               "X-AGC-Gain: %u\r\n"
+               "X-JPEG-Quality: %u\r\n",
+               (unsigned)metadata.sequence, metadata.captured_us,
+               metadata.dequeued_us, metadata.sent_us,
+               (unsigned)metadata.aec_value, (unsigned)metadata.agc_gain,
+               (unsigned)metadata.quality);
+  if (!(metadata.flags & FRAME_METADATA_HAS_STATS))
+    return len;
+
+  appendHeader(buffer, size, len, "X-Frame-Mean: %u\r\nX-Frame-Histogram: ",
+               (unsigned)metadata.mean_brightness);
+  for (int i = 0; i < FRAME_STATS_HISTOGRAM_BINS; i++)
+    appendHeader(buffer, size, len, i ? ",%u" : "%u",
+                 (unsigned)metadata.histogram[i]);
+  appendHeader(buffer, size, len, "\r\n");
+  return len;
+}
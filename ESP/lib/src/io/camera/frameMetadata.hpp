@@ -0,0 +1,45 @@
+#pragma once
+#ifndef FRAME_METADATA_HPP
+#define FRAME_METADATA_HPP
+#include <Arduino.h>
+#include <esp_camera.h>
+#include <esp_timer.h>
+#include "io/camera/frameStats.hpp"
+
+//! size of the packed, little endian record sent over binary transports
+#define FRAME_METADATA_SIZE 50
+#define FRAME_METADATA_HAS_STATS 0x01
+
+/**
+ * @brief Per-frame information shared by every transport
+ * @details All timestamps are esp_timer_get_time() microseconds since boot.
+ * AEC and AGC are the values currently programmed into the sensor, the
+ * automatic exposure and gain loops are disabled so they are the ones the
+ * frame was captured with. The brightness fields are only filled in when
+ * the frame stats are enabled, see FRAME_METADATA_HAS_STATS.
+ */
+struct FrameMetadata_t {
+  uint32_t sequence;
+  int64_t captured_us;
+  int64_t dequeued_us;
+  int64_t sent_us;
+  uint16_t aec_value;
+  uint8_t agc_gain;
+  uint8_t quality;
+  uint8_t flags;
+  uint8_t mean_brightness;
+  //! share of the frame in each brightness bin, 255 = the whole frame
+  uint8_t histogram[FRAME_STATS_HISTOGRAM_BINS];
+};
+
+namespace FrameMetadata {
+  FrameMetadata_t fromFrame(const camera_fb_t* fb);
+  void attachStats(FrameMetadata_t& metadata, const FrameStats_t& stats);
+  void markSent(FrameMetadata_t& metadata);
+  size_t pack(const FrameMetadata_t& metadata, uint8_t* buffer);
+  size_t formatHeaders(const FrameMetadata_t& metadata,
+                       char* buffer,
+                       size_t size);
+}  // namespace FrameMetadata
+
+#endif  // FRAME_METADATA_HPP
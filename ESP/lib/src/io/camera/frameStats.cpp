@@ -0,0 +1,169 @@
+#include "frameStats.hpp"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <new>
+#include "data/utilities/jsonWriter.hpp"
+
+FrameStatsProvider frameStatsProvider;
+
+FrameStatsProvider::FrameStatsProvider()
+    : enabled(false),
+      decoderMutex(nullptr),
+      lock(portMUX_INITIALIZER_UNLOCKED),
+      decoder(nullptr),
+      thumbnail(nullptr),
+      latest() {}
+
+void FrameStatsProvider::setEnabled(bool enabled) {
+  if (enabled && !this->allocate()) {
+    log_e("[FrameStats]: Could not allocate the decoder, stats disabled");
+    return;
+  }
+  this->enabled = enabled;
+  if (!enabled) {
+    portENTER_CRITICAL(&lock);
+    latest.valid = false;
+    portEXIT_CRITICAL(&lock);
+  }
+}
+
+/**
+ * @brief The decoder carries ~16KB of tables and buffers, we only pay for it
+ * once the stats get enabled, and keep it out of internal RAM when possible
+ */
+bool FrameStatsProvider::allocate() {
+  if (decoder)
+    return true;
+
+  if (!decoderMutex)
+    decoderMutex = xSemaphoreCreateMutex();
+  if (!decoderMutex)
+    return false;
+
+  uint32_t caps = psramFound() ? MALLOC_CAP_SPIRAM : MALLOC_CAP_8BIT;
+  void* memory = heap_caps_malloc(sizeof(JpegDCDecoder), caps);
+  thumbnail = (uint8_t*)heap_caps_malloc(JPEG_DC_MAX_BLOCKS, caps);
+  if (!memory || !thumbnail) {
+    heap_caps_free(memory);
+    heap_caps_free(thumbnail);
+    thumbnail = nullptr;
+    return false;
+  }
+  decoder = new (memory) JpegDCDecoder();
+  return true;
+}
+
+/**
+ * @brief Runs the partial decode on a JPEG frame and publishes the result
+ * @details Transports running on other tasks may call this concurrently, if
+ * the decoder is busy the frame is simply skipped
+ * @return true when stats were computed for this frame
+ */
+bool FrameStatsProvider::process(const camera_fb_t* fb, FrameStats_t* stats) {
+  if (!enabled || !fb || fb->format != PIXFORMAT_JPEG)
+    return false;
+  if (xSemaphoreTake(decoderMutex, 0) != pdTRUE)
+    return false;
+
+  int64_t start = esp_timer_get_time();
+  JpegDCDecoder::Result_e result = decoder->decode(fb->buf, fb->len);
+  if (result != JpegDCDecoder::DECODE_OK) {
+    xSemaphoreGive(decoderMutex);
+    log_d("[FrameStats]: Partial decode failed: %d", result);
+    return false;
+  }
+
+  FrameStats_t computed = {};
+  computed.valid = true;
+  computed.thumbnailWidth = decoder->getThumbnailWidth();
+  computed.thumbnailHeight = decoder->getThumbnailHeight();
+  computed.captured_us =
+      (int64_t)fb->timestamp.tv_sec * 1000000LL + fb->timestamp.tv_usec;
+
+  const uint8_t* pixels = decoder->getThumbnail();
+  uint16_t width = computed.thumbnailWidth;
+  uint16_t height = computed.thumbnailHeight;
+  size_t count = width * height;
+  uint32_t sum = 0;
+  uint32_t cellSums[FRAME_STATS_GRID_CELLS] = {0};
+  uint16_t cellCounts[FRAME_STATS_GRID_CELLS] = {0};
+  for (uint16_t y = 0; y < height; y++) {
+    const uint8_t* row = pixels + y * width;
+    size_t cellRow = (y * FRAME_STATS_GRID_SIZE / height) * FRAME_STATS_GRID_SIZE;
+    for (uint16_t x = 0; x < width; x++) {
+      size_t cell = cellRow + x * FRAME_STATS_GRID_SIZE / width;
+      sum += row[x];
+      cellSums[cell] += row[x];
+      cellCounts[cell]++;
+      computed.histogram[row[x] >> 4]++;
+    }
+  }
+  computed.mean = count ? sum / count : 0;
+  for (int i = 0; i < FRAME_STATS_GRID_CELLS; i++)
+    computed.grid[i] = cellCounts[i] ? cellSums[i] / cellCounts[i] : 0;
+  computed.decode_us = esp_timer_get_time() - start;
+
+  memcpy(thumbnail, pixels, count);
+  portENTER_CRITICAL(&lock);
+  latest = computed;
+  portEXIT_CRITICAL(&lock);
+  xSemaphoreGive(decoderMutex);
+
+  if (stats)
+    *stats = computed;
+  return true;
+}
+
+bool FrameStatsProvider::getLatest(FrameStats_t& stats) {
+  portENTER_CRITICAL(&lock);
+  stats = latest;
+  portEXIT_CRITICAL(&lock);
+  return stats.valid;
+}
+
+/**
+ * @brief Copies the thumbnail of the latest processed frame
+ * @return the number of pixels copied, 0 if there is none or it doesn't fit
+ */
+size_t FrameStatsProvider::copyThumbnail(uint8_t* buffer,
+                                         size_t size,
+                                         uint16_t* width,
+                                         uint16_t* height) {
+  // the thumbnail is written while holding the decoder, wait for it to finish
+  if (!decoderMutex ||
+      xSemaphoreTake(decoderMutex, pdMS_TO_TICKS(50)) != pdTRUE)
+    return 0;
+
+  size_t count = 0;
+  FrameStats_t stats;
+  if (this->getLatest(stats)) {
+    count = stats.thumbnailWidth * stats.thumbnailHeight;
+    if (count <= size) {
+      memcpy(buffer, thumbnail, count);
+      *width = stats.thumbnailWidth;
+      *height = stats.thumbnailHeight;
+    } else {
+      count = 0;
+    }
+  }
+  xSemaphoreGive(decoderMutex);
+  return count;
+}
+
+void FrameStatsProvider::writeJson(Print& out) {
+  FrameStats_t stats;
+  if (!this->getLatest(stats)) {
+    out.printf("\"frame_stats\": {\"enabled\": %s}",
+               JsonWriter::boolean(enabled));
+    return;
+  }
+
+  out.printf(
+      "\"frame_stats\": {\"enabled\": true, \"mean\": %u, \"width\": %u, "
+      "\"height\": %u, \"histogram\": [",
+      stats.mean, stats.thumbnailWidth, stats.thumbnailHeight);
+  for (int i = 0; i < FRAME_STATS_HISTOGRAM_BINS; i++)
+    out.printf(i ? ",%u" : "%u", stats.histogram[i]);
+  out.printf("], \"decode_us\": %u, \"captured_us\": %lld}",
+             (unsigned)stats.decode_us, stats.captured_us);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#ifndef FRAME_STATS_HPP
+#define FRAME_STATS_HPP
+#include <Arduino.h>
+#include <esp_camera.h>
+#include <string>
+#include "io/camera/jpegDCDecoder.hpp"
+
+#define FRAME_STATS_HISTOGRAM_BINS 16
+//! the thumbnail is also averaged down to a fixed grid, so frames of any
+//! resolution can be compared cheaply
+#define FRAME_STATS_GRID_SIZE 12
+#define FRAME_STATS_GRID_CELLS (FRAME_STATS_GRID_SIZE * FRAME_STATS_GRID_SIZE)
+
+/**
+ * @brief Brightness statistics of a frame, computed from the 1/8 scale
+ * thumbnail the DC coefficients give us
+ */
+struct FrameStats_t {
+  bool valid;
+  uint8_t mean;
+  uint16_t thumbnailWidth;
+  uint16_t thumbnailHeight;
+  //! number of 8x8 blocks falling into each of the 16 brightness bins
+  uint16_t histogram[FRAME_STATS_HISTOGRAM_BINS];
+  //! mean brightness of each cell of the grid, row by row
+  uint8_t grid[FRAME_STATS_GRID_CELLS];
+  uint32_t decode_us;
+  int64_t captured_us;
+};
+
+/**
+ * @brief Computes and publishes the stats of the frames going through the
+ * transports, so control loops (exposure, blink detection) can read the
+ * latest ones without touching the camera
+ */
+class FrameStatsProvider {
+ public:
+  FrameStatsProvider();
+  void setEnabled(bool enabled);
+  bool isEnabled() const { return enabled; }
+  bool process(const camera_fb_t* fb, FrameStats_t* stats = nullptr);
+  bool getLatest(FrameStats_t& stats);
+  size_t copyThumbnail(uint8_t* buffer,
+                       size_t size,
+                       uint16_t* width,
+                       uint16_t* height);
+  void writeJson(Print& out);
+
+ private:
+  bool allocate();
+
+  volatile bool enabled;
+  SemaphoreHandle_t decoderMutex;
+  portMUX_TYPE lock;
+  JpegDCDecoder* decoder;
+  uint8_t* thumbnail;
+  FrameStats_t latest;
+};
+
+extern FrameStatsProvider frameStatsProvider;
+
+#endif  // FRAME_STATS_HPP
@@ -0,0 +1,137 @@
+#include "frameSuppression.hpp"
+#include "data/utilities/jsonWriter.hpp"
+
+FrameSuppression frameSuppression;
+
+FrameSuppression::FrameSuppression()
+    : lock(portMUX_INITIALIZER_UNLOCKED),
+      enabled(false),
+      settings(),
+      counters() {}
+
+void FrameSuppression::configure(const Settings_t& settings) {
+  portENTER_CRITICAL(&lock);
+  this->settings = settings;
+  portEXIT_CRITICAL(&lock);
+  this->enabled = settings.enabled;
+}
+
+FrameSuppression::Settings_t FrameSuppression::getSettings() {
+  portENTER_CRITICAL(&lock);
+  Settings_t current = settings;
+  portEXIT_CRITICAL(&lock);
+  return current;
+}
+
+void FrameSuppression::countSent(size_t bytes) {
+  portENTER_CRITICAL(&lock);
+  counters.frames_sent++;
+  counters.bytes_sent += bytes;
+  portEXIT_CRITICAL(&lock);
+}
+
+void FrameSuppression::countSuppressed(size_t frameBytes, size_t markerBytes) {
+  portENTER_CRITICAL(&lock);
+  counters.frames_suppressed++;
+  counters.bytes_sent += markerBytes;
+  if (frameBytes > markerBytes)
+    counters.bytes_saved += frameBytes - markerBytes;
+  portEXIT_CRITICAL(&lock);
+}
+
+void FrameSuppression::countForcedKeyframe() {
+  portENTER_CRITICAL(&lock);
+  counters.keyframes_forced++;
+  portEXIT_CRITICAL(&lock);
+}
+
+FrameSuppression::Counters_t FrameSuppression::getCounters() {
+  portENTER_CRITICAL(&lock);
+  Counters_t current = counters;
+  portEXIT_CRITICAL(&lock);
+  return current;
+}
+
+void FrameSuppression::resetCounters() {
+  portENTER_CRITICAL(&lock);
+  counters = {};
+  portEXIT_CRITICAL(&lock);
+}
+
+void FrameSuppression::writeJson(Print& out) {
+  Settings_t current = this->getSettings();
+  Counters_t stats = this->getCounters();
+  uint64_t total = stats.bytes_sent + stats.bytes_saved;
+  out.printf(
+      "\"frame_suppression\": {\"enabled\": %s, \"size_delta\": %u, "
+      "\"dc_delta\": %u, \"max_keyframe_interval\": %u, \"frames_sent\": %u, "
+      "\"frames_suppressed\": %u, \"keyframes_forced\": %u, "
+      "\"bytes_sent\": %llu, \"bytes_saved\": %llu, \"saved_percent\": %.1f}",
+      JsonWriter::boolean(current.enabled), current.sizeDelta, current.dcDelta,
+      current.maxKeyframeInterval, stats.frames_sent, stats.frames_suppressed,
+      stats.keyframes_forced, stats.bytes_sent, stats.bytes_saved,
+      total ? stats.bytes_saved * 100.0 / total : 0.0);
+}
+
+FrameChangeDetector::FrameChangeDetector()
+    : hasReference(false),
+      referenceLength(0),
+      referenceSequence(0),
+      sinceKeyframe(0),
+      referenceGrid() {}
+
+void FrameChangeDetector::reset() {
+  hasReference = false;
+  sinceKeyframe = 0;
+}
+
+void FrameChangeDetector::setReference(const camera_fb_t* fb,
+                                       uint32_t sequence,
+                                       const FrameStats_t* stats) {
+  hasReference = stats && stats->valid;
+  referenceLength = fb->len;
+  referenceSequence = sequence;
+  sinceKeyframe = 0;
+  if (hasReference)
+    memcpy(referenceGrid, stats->grid, sizeof(referenceGrid));
+}
+
+/**
+ * @return true if the transport should send an "unchanged" marker instead of
+ * the frame, false if the frame has to go out (it then becomes the reference)
+ */
+bool FrameChangeDetector::isUnchanged(const camera_fb_t* fb,
+                                      uint32_t sequence,
+                                      const FrameStats_t* stats) {
+  if (!frameSuppression.isEnabled()) {
+    hasReference = false;
+    return false;
+  }
+
+  if (!hasReference || !stats || !stats->valid) {
+    this->setReference(fb, sequence, stats);
+    return false;
+  }
+
+  FrameSuppression::Settings_t settings = frameSuppression.getSettings();
+  if (settings.maxKeyframeInterval &&
+      sinceKeyframe + 1 >= settings.maxKeyframeInterval) {
+    frameSuppression.countForcedKeyframe();
+    this->setReference(fb, sequence, stats);
+    return false;
+  }
+
+  size_t sizeDelta = fb->len > referenceLength ? fb->len - referenceLength
+                                               : referenceLength - fb->len;
+  bool changed = sizeDelta * 100 > referenceLength * settings.sizeDelta;
+  for (int i = 0; !changed && i < FRAME_STATS_GRID_CELLS; i++)
+    changed = abs((int)stats->grid[i] - (int)referenceGrid[i]) >
+              settings.dcDelta;
+
+  if (changed) {
+    this->setReference(fb, sequence, stats);
+    return false;
+  }
+  sinceKeyframe++;
+  return true;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#ifndef FRAME_SUPPRESSION_HPP
+#define FRAME_SUPPRESSION_HPP
+#include <Arduino.h>
+#include <esp_camera.h>
+#include <string>
+#include "io/camera/frameStats.hpp"
+
+/**
+ * @brief Shared settings and bandwidth counters of the static-scene frame
+ * suppression, the per-transport state lives in FrameChangeDetector
+ */
+class FrameSuppression {
+ public:
+  struct Settings_t {
+    bool enabled;
+    //! JPEG size change, in percent of the reference frame
+    uint8_t sizeDelta;
+    //! largest allowed brightness change of a single grid cell
+    uint8_t dcDelta;
+    //! 0 - only send a full frame when something changed
+    uint16_t maxKeyframeInterval;
+  };
+
+  struct Counters_t {
+    uint32_t frames_sent;
+    uint32_t frames_suppressed;
+    uint32_t keyframes_forced;
+    uint64_t bytes_sent;
+    //! JPEG bytes not sent, minus the size of the markers sent instead
+    uint64_t bytes_saved;
+  };
+
+  FrameSuppression();
+  void configure(const Settings_t& settings);
+  Settings_t getSettings();
+  bool isEnabled() const { return enabled; }
+
+  void countSent(size_t bytes);
+  void countSuppressed(size_t frameBytes, size_t markerBytes);
+  void countForcedKeyframe();
+  Counters_t getCounters();
+  void resetCounters();
+  void writeJson(Print& out);
+
+ private:
+  portMUX_TYPE lock;
+  volatile bool enabled;
+  Settings_t settings;
+  Counters_t counters;
+};
+
+/**
+ * @brief Tells whether a frame is a near-duplicate of the last one a
+ * transport actually sent
+ * @details A frame counts as changed when its JPEG size moved by more than
+ * sizeDelta percent, or when any cell of the DC brightness grid moved by more
+ * than dcDelta. Frames are always compared to the last sent one, so a slow
+ * drift eventually gets through too. Frames without stats (the decoder was
+ * busy with another transport) are always sent.
+ */
+class FrameChangeDetector {
+ public:
+  FrameChangeDetector();
+  bool isUnchanged(const camera_fb_t* fb,
+                   uint32_t sequence,
+                   const FrameStats_t* stats);
+  uint32_t getReferenceSequence() const { return referenceSequence; }
+  void reset();
+
+ private:
+  void setReference(const camera_fb_t* fb,
+                    uint32_t sequence,
+                    const FrameStats_t* stats);
+
+  bool hasReference;
+  size_t referenceLength;
+  uint32_t referenceSequence;
+  uint16_t sinceKeyframe;
+  uint8_t referenceGrid[FRAME_STATS_GRID_CELLS];
+};
+
+extern FrameSuppression frameSuppression;
+
+#endif  // FRAME_SUPPRESSION_HPP
@@ -0,0 +1,410 @@
+#include "jpegDCDecoder.hpp"
+#include <string.h>
+
+JpegDCDecoder::JpegDCDecoder()
+    : componentCount(0),
+      maxH(1),
+      maxV(1),
+      restartInterval(0),
+      cursor(nullptr),
+      end(nullptr),
+      bitBuffer(0),
+      bitCount(0),
+      markerHit(false),
+      thumbnailWidth(0),
+      thumbnailHeight(0),
+      imageWidth(0),
+      imageHeight(0) {}
+
+static inline uint16_t readU16(const uint8_t* data) {
+  return (data[0] << 8) | data[1];
+}
+
+JpegDCDecoder::Result_e JpegDCDecoder::decode(const uint8_t* data,
+                                              size_t len) {
+  if (len < 4 || data[0] != 0xFF || data[1] != 0xD8)
+    return DECODE_NOT_JPEG;
+
+  for (int i = 0; i < 4; i++) {
+    dcTables[i].defined = false;
+    acTables[i].defined = false;
+    quantDC[i] = 1;
+  }
+  componentCount = 0;
+  restartInterval = 0;
+  thumbnailWidth = 0;
+  thumbnailHeight = 0;
+
+  size_t pos = 2;
+  while (pos + 4 <= len) {
+    if (data[pos] != 0xFF)
+      return DECODE_CORRUPT;
+    uint8_t marker = data[pos + 1];
+    // fill bytes in front of a marker are allowed
+    if (marker == 0xFF) {
+      pos++;
+      continue;
+    }
+    pos += 2;
+
+    // markers without a payload
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7))
+      continue;
+    if (marker == 0xD9)
+      break;
+
+    uint16_t segmentLen = readU16(data + pos);
+    if (segmentLen < 2 || pos + segmentLen > len)
+      return DECODE_CORRUPT;
+    const uint8_t* segment = data + pos + 2;
+    size_t payloadLen = segmentLen - 2;
+
+    switch (marker) {
+      case 0xDB:
+        if (!parseQuantizationTables(segment, payloadLen))
+          return DECODE_CORRUPT;
+        break;
+      case 0xC4:
+        if (!parseHuffmanTables(segment, payloadLen))
+          return DECODE_CORRUPT;
+        break;
+      case 0xDD:
+        if (payloadLen < 2)
+          return DECODE_CORRUPT;
+        restartInterval = readU16(segment);
+        break;
+      case 0xC0:
+      case 0xC1: {
+        Result_e result = parseFrame(segment, payloadLen);
+        if (result != DECODE_OK)
+          return result;
+        break;
+      }
+      case 0xDA:
+        // the entropy coded data runs until the end of the image, the scan
+        // decoder takes care of it from here on
+        return decodeScan(segment, len - (segment - data));
+      default:
+        // progressive, lossless and arithmetic coded frames
+        if ((marker >= 0xC2 && marker <= 0xCB && marker != 0xC4 &&
+             marker != 0xC8) ||
+            (marker >= 0xCD && marker <= 0xCF))
+          return DECODE_UNSUPPORTED;
+        // APPn, COM and friends
+        break;
+    }
+    pos += segmentLen;
+  }
+  return DECODE_CORRUPT;
+}
+
+bool JpegDCDecoder::parseQuantizationTables(const uint8_t* segment,
+                                            size_t len) {
+  size_t pos = 0;
+  while (pos < len) {
+    uint8_t precision = segment[pos] >> 4;
+    uint8_t id = segment[pos] & 0x0F;
+    size_t tableLen = precision ? 128 : 64;
+    if (id > 3 || pos + 1 + tableLen > len)
+      return false;
+    // we only ever need the DC quantizer, it's the first entry in zigzag order
+    quantDC[id] = precision ? readU16(segment + pos + 1) : segment[pos + 1];
+    pos += 1 + tableLen;
+  }
+  return true;
+}
+
+bool JpegDCDecoder::parseHuffmanTables(const uint8_t* segment, size_t len) {
+  size_t pos = 0;
+  while (pos + 17 <= len) {
+    uint8_t tableClass = segment[pos] >> 4;
+    uint8_t id = segment[pos] & 0x0F;
+    if (tableClass > 1 || id > 3)
+      return false;
+    HuffmanTable_t& table = tableClass ? acTables[id] : dcTables[id];
+
+    const uint8_t* counts = segment + pos + 1;
+    size_t total = 0;
+    for (int i = 0; i < 16; i++)
+      total += counts[i];
+    if (total > 256 || pos + 17 + total > len)
+      return false;
+    memcpy(table.values, segment + pos + 17, total);
+    memset(table.lookup, 0, sizeof(table.lookup));
+
+    // canonical Huffman code assignment, see JPEG spec annex C
+    int32_t code = 0;
+    int index = 0;
+    for (int length = 1; length <= 16; length++) {
+      table.valueOffset[length] = index - code;
+      for (int i = 0; i < counts[length - 1]; i++, index++, code++) {
+        if (length <= JPEG_DC_LOOKAHEAD_BITS) {
+          int shift = JPEG_DC_LOOKAHEAD_BITS - length;
+          for (int fill = 0; fill < (1 << shift); fill++)
+            table.lookup[(code << shift) | fill] =
+                (length << 8) | table.values[index];
+        }
+      }
+      table.maxCode[length] = counts[length - 1] ? code - 1 : -1;
+      code <<= 1;
+    }
+    table.maxCode[17] = 0x7FFFFFFF;
+    table.defined = true;
+    pos += 17 + total;
+  }
+  return pos == len;
+}
+
+JpegDCDecoder::Result_e JpegDCDecoder::parseFrame(const uint8_t* segment,
+                                                  size_t len) {
+  if (len < 6 || segment[0] != 8)
+    return DECODE_UNSUPPORTED;
+
+  imageHeight = readU16(segment + 1);
+  imageWidth = readU16(segment + 3);
+  componentCount = segment[5];
+  if (!imageWidth || !imageHeight || !componentCount || componentCount > 4 ||
+      len < 6 + componentCount * 3u)
+    return DECODE_CORRUPT;
+
+  maxH = 1;
+  maxV = 1;
+  for (int i = 0; i < componentCount; i++) {
+    const uint8_t* spec = segment + 6 + i * 3;
+    components[i].id = spec[0];
+    components[i].h = spec[1] >> 4;
+    components[i].v = spec[1] & 0x0F;
+    components[i].quantTable = spec[2] & 0x03;
+    if (!components[i].h || !components[i].v || components[i].h > 4 ||
+        components[i].v > 4)
+      return DECODE_CORRUPT;
+    if (components[i].h > maxH)
+      maxH = components[i].h;
+    if (components[i].v > maxV)
+      maxV = components[i].v;
+  }
+
+  // the thumbnail covers the luma plane, which is always the first component
+  uint32_t lumaWidth = (imageWidth * components[0].h + maxH - 1) / maxH;
+  uint32_t lumaHeight = (imageHeight * components[0].v + maxV - 1) / maxV;
+  thumbnailWidth = (lumaWidth + 7) / 8;
+  thumbnailHeight = (lumaHeight + 7) / 8;
+  if ((uint32_t)thumbnailWidth * thumbnailHeight > JPEG_DC_MAX_BLOCKS)
+    return DECODE_TOO_LARGE;
+  return DECODE_OK;
+}
+
+void JpegDCDecoder::resetBitReader() {
+  bitBuffer = 0;
+  bitCount = 0;
+  markerHit = false;
+}
+
+/**
+ * @brief Tops the bit buffer up to at least 25 bits, undoing the 0xFF00 byte
+ * stuffing. Once a marker is reached we feed zeros, the MCU count tells us
+ * when to stop.
+ */
+void JpegDCDecoder::fillBits() {
+  while (bitCount <= 24) {
+    uint32_t byte = 0;
+    if (!markerHit && cursor < end) {
+      byte = *cursor;
+      if (byte == 0xFF) {
+        uint8_t next = cursor + 1 < end ? cursor[1] : 0xD9;
+        if (next == 0x00) {
+          cursor += 2;
+        } else {
+          markerHit = true;
+          byte = 0;
+        }
+      } else {
+        cursor++;
+      }
+    }
+    bitBuffer |= byte << (24 - bitCount);
+    bitCount += 8;
+  }
+}
+
+int JpegDCDecoder::decodeSymbol(const HuffmanTable_t& table) {
+  fillBits();
+  uint16_t entry = table.lookup[bitBuffer >> (32 - JPEG_DC_LOOKAHEAD_BITS)];
+  if (entry) {
+    int length = entry >> 8;
+    bitBuffer <<= length;
+    bitCount -= length;
+    return entry & 0xFF;
+  }
+
+  // slow path for codes longer than the lookahead
+  int length = JPEG_DC_LOOKAHEAD_BITS + 1;
+  int32_t code = bitBuffer >> (32 - length);
+  while (length <= 16 && code > table.maxCode[length]) {
+    length++;
+    code = bitBuffer >> (32 - length);
+  }
+  if (length > 16)
+    return -1;
+  bitBuffer <<= length;
+  bitCount -= length;
+  return table.values[(code + table.valueOffset[length]) & 0xFF];
+}
+
+int32_t JpegDCDecoder::receiveExtend(int size) {
+  if (!size)
+    return 0;
+  fillBits();
+  int32_t value = bitBuffer >> (32 - size);
+  bitBuffer <<= size;
+  bitCount -= size;
+  if (value < (1 << (size - 1)))
+    value -= (1 << size) - 1;
+  return value;
+}
+
+/**
+ * @brief Skips to the data after an RSTn marker and resets the DC predictors
+ */
+bool JpegDCDecoder::handleRestart() {
+  while (cursor + 1 < end && !(cursor[0] == 0xFF && cursor[1] >= 0xD0 &&
+                               cursor[1] <= 0xD7))
+    cursor++;
+  if (cursor + 1 >= end)
+    return false;
+  cursor += 2;
+  resetBitReader();
+  for (int i = 0; i < componentCount; i++)
+    components[i].predictor = 0;
+  return true;
+}
+
+bool JpegDCDecoder::decodeBlock(Component_t& component, int16_t* dc) {
+  int size = decodeSymbol(dcTables[component.dcTable]);
+  if (size < 0 || size > 11)
+    return false;
+  component.predictor += receiveExtend(size);
+  if (dc)
+    *dc = component.predictor;
+
+  // walk over the AC coefficients without keeping them
+  const HuffmanTable_t& ac = acTables[component.acTable];
+  for (int k = 1; k < 64;) {
+    int symbol = decodeSymbol(ac);
+    if (symbol < 0)
+      return false;
+    int run = symbol >> 4;
+    int size = symbol & 0x0F;
+    if (!size) {
+      if (run != 15)
+        break;  // end of block
+      k += 16;
+      continue;
+    }
+    k += run + 1;
+    fillBits();
+    bitBuffer <<= size;
+    bitCount -= size;
+  }
+  return true;
+}
+
+void JpegDCDecoder::storeBlock(int16_t dc, uint16_t x, uint16_t y) {
+  if (x >= thumbnailWidth || y >= thumbnailHeight)
+    return;
+  // the DC coefficient is 8 times the mean of the level shifted block
+  int32_t value = ((int32_t)dc * quantDC[components[0].quantTable]) / 8 + 128;
+  if (value < 0)
+    value = 0;
+  else if (value > 255)
+    value = 255;
+  thumbnail[y * thumbnailWidth + x] = value;
+}
+
+JpegDCDecoder::Result_e JpegDCDecoder::decodeScan(const uint8_t* segment,
+                                                  size_t len) {
+  if (!componentCount || !thumbnailWidth)
+    return DECODE_CORRUPT;
+  if (len < 1)
+    return DECODE_CORRUPT;
+
+  uint8_t scanCount = segment[0];
+  size_t headerLen = 1 + scanCount * 2 + 3;
+  if (!scanCount || scanCount > componentCount || len < headerLen)
+    return DECODE_CORRUPT;
+
+  Component_t* scanComponents[4];
+  for (int i = 0; i < scanCount; i++) {
+    uint8_t id = segment[1 + i * 2];
+    uint8_t tables = segment[2 + i * 2];
+    scanComponents[i] = nullptr;
+    for (int c = 0; c < componentCount; c++) {
+      if (components[c].id == id)
+        scanComponents[i] = &components[c];
+    }
+    if (!scanComponents[i])
+      return DECODE_CORRUPT;
+    scanComponents[i]->dcTable = (tables >> 4) & 0x03;
+    scanComponents[i]->acTable = tables & 0x03;
+    scanComponents[i]->predictor = 0;
+    if (!dcTables[scanComponents[i]->dcTable].defined ||
+        !acTables[scanComponents[i]->acTable].defined)
+      return DECODE_CORRUPT;
+  }
+  // a baseline file could split the components over several scans, the
+  // thumbnail needs the luma one to be first
+  if (scanComponents[0] != &components[0])
+    return DECODE_UNSUPPORTED;
+
+  cursor = segment + headerLen;
+  end = segment + len;
+  resetBitReader();
+
+  uint32_t restartsLeft = restartInterval;
+
+  if (scanCount == 1) {
+    // non-interleaved, every MCU is a single block
+    Component_t& luma = components[0];
+    for (uint16_t y = 0; y < thumbnailHeight; y++) {
+      for (uint16_t x = 0; x < thumbnailWidth; x++) {
+        if (restartInterval && !restartsLeft) {
+          if (!handleRestart())
+            return DECODE_CORRUPT;
+          restartsLeft = restartInterval;
+        }
+        int16_t dc;
+        if (!decodeBlock(luma, &dc))
+          return DECODE_CORRUPT;
+        storeBlock(dc, x, y);
+        restartsLeft--;
+      }
+    }
+    return DECODE_OK;
+  }
+
+  uint32_t mcuColumns = (imageWidth + 8 * maxH - 1) / (8 * maxH);
+  uint32_t mcuRows = (imageHeight + 8 * maxV - 1) / (8 * maxV);
+  for (uint32_t mcuY = 0; mcuY < mcuRows; mcuY++) {
+    for (uint32_t mcuX = 0; mcuX < mcuColumns; mcuX++) {
+      if (restartInterval && !restartsLeft) {
+        if (!handleRestart())
+          return DECODE_CORRUPT;
+        restartsLeft = restartInterval;
+      }
+      for (int i = 0; i < scanCount; i++) {
+        Component_t& component = *scanComponents[i];
+        for (int by = 0; by < component.v; by++) {
+          for (int bx = 0; bx < component.h; bx++) {
+            int16_t dc;
+            if (!decodeBlock(component, i == 0 ? &dc : nullptr))
+              return DECODE_CORRUPT;
+            if (i == 0)
+              storeBlock(dc, mcuX * component.h + bx, mcuY * component.v + by);
+          }
+        }
+      }
+      restartsLeft--;
+    }
+  }
+  return DECODE_OK;
+}
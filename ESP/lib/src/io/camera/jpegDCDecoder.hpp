@@ -0,0 +1,104 @@
+#pragma once
+#ifndef JPEG_DC_DECODER_HPP
+#define JPEG_DC_DECODER_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+//! 640x480 worth of luma blocks, bigger frames are rejected
+#define JPEG_DC_MAX_BLOCKS 4800
+#define JPEG_DC_LOOKAHEAD_BITS 9
+
+/**
+ * @brief Partial baseline JPEG decoder that only recovers the DC coefficient
+ * of every luma block
+ * @details The AC coefficients still have to be Huffman decoded to find the
+ * next block, but they are thrown away, so there is no dequantization, IDCT
+ * or color conversion. The result is a 1/8 scale grayscale thumbnail where
+ * every pixel is the mean of its 8x8 block.
+ * @note Has no Arduino dependencies on purpose, so it can be built on the
+ * host as well.
+ */
+class JpegDCDecoder {
+ public:
+  enum Result_e {
+    DECODE_OK,
+    DECODE_NOT_JPEG,
+    DECODE_UNSUPPORTED,
+    DECODE_TOO_LARGE,
+    DECODE_CORRUPT,
+  };
+
+  JpegDCDecoder();
+
+  /**
+   * @brief Decodes the luma DC coefficients of a baseline JPEG
+   * @param data the JPEG image, starting with SOI
+   * @param len the length of the image
+   * @return DECODE_OK when the thumbnail is valid
+   */
+  Result_e decode(const uint8_t* data, size_t len);
+
+  //! row-major thumbnail, one 0-255 pixel per 8x8 luma block
+  const uint8_t* getThumbnail() const { return thumbnail; }
+  uint16_t getThumbnailWidth() const { return thumbnailWidth; }
+  uint16_t getThumbnailHeight() const { return thumbnailHeight; }
+  uint16_t getImageWidth() const { return imageWidth; }
+  uint16_t getImageHeight() const { return imageHeight; }
+
+ private:
+  struct HuffmanTable_t {
+    bool defined;
+    //! (code length << 8) | symbol for every code of up to
+    //! JPEG_DC_LOOKAHEAD_BITS bits, 0 when the code is longer
+    uint16_t lookup[1 << JPEG_DC_LOOKAHEAD_BITS];
+    int32_t maxCode[18];
+    int32_t valueOffset[17];
+    uint8_t values[256];
+  };
+
+  struct Component_t {
+    uint8_t id;
+    uint8_t h;
+    uint8_t v;
+    uint8_t quantTable;
+    uint8_t dcTable;
+    uint8_t acTable;
+    int16_t predictor;
+  };
+
+  bool parseQuantizationTables(const uint8_t* segment, size_t len);
+  bool parseHuffmanTables(const uint8_t* segment, size_t len);
+  Result_e parseFrame(const uint8_t* segment, size_t len);
+  Result_e decodeScan(const uint8_t* segment, size_t len);
+  bool decodeBlock(Component_t& component, int16_t* dc);
+  void storeBlock(int16_t dc, uint16_t x, uint16_t y);
+
+  void resetBitReader();
+  void fillBits();
+  int decodeSymbol(const HuffmanTable_t& table);
+  int32_t receiveExtend(int size);
+  bool handleRestart();
+
+  HuffmanTable_t dcTables[4];
+  HuffmanTable_t acTables[4];
+  uint16_t quantDC[4];
+  Component_t components[4];
+  uint8_t componentCount;
+  uint8_t maxH;
+  uint8_t maxV;
+  uint16_t restartInterval;
+
+  const uint8_t* cursor;
+  const uint8_t* end;
+  uint32_t bitBuffer;
+  int bitCount;
+  bool markerHit;
+
+  uint8_t thumbnail[JPEG_DC_MAX_BLOCKS];
+  uint16_t thumbnailWidth;
+  uint16_t thumbnailHeight;
+  uint16_t imageWidth;
+  uint16_t imageHeight;
+};
+
+#endif  // JPEG_DC_DECODER_HPP
@@ -0,0 +1,63 @@
+#include "latencyTracker.hpp"
+
+LatencyTracker frameLatencyTracker;
+
+LatencyTracker::LatencyTracker()
+    : lock(portMUX_INITIALIZER_UNLOCKED),
+      samples(0),
+      total_us(0),
+      last_us(0),
+      min_us(0),
+      max_us(0) {}
+
+void LatencyTracker::record(const struct timeval& captured) {
+  int64_t captured_us =
+      (int64_t)captured.tv_sec * 1000000LL + (int64_t)captured.tv_usec;
+  int64_t latency = esp_timer_get_time() - captured_us;
+
+  portENTER_CRITICAL(&lock);
+  if (!samples || latency < min_us)
+    min_us = latency;
+  if (latency > max_us)
+    max_us = latency;
+  last_us = latency;
+  total_us += latency;
+  samples++;
+  portEXIT_CRITICAL(&lock);
+}
+
+/**
+ * @brief Drops the collected samples, call it whenever the capture pipeline
+ * changes so the stats only reflect the active configuration
+ */
+void LatencyTracker::reset() {
+  portENTER_CRITICAL(&lock);
+  samples = 0;
+  total_us = 0;
+  last_us = 0;
+  min_us = 0;
+  max_us = 0;
+  portEXIT_CRITICAL(&lock);
+}
+
+LatencyTracker::LatencyStats_t LatencyTracker::getStats() {
+  portENTER_CRITICAL(&lock);
+  LatencyStats_t stats = {
+      .samples = samples,
+      .last_us = last_us,
+      .min_us = min_us,
+      .max_us = max_us,
+      .avg_us = samples ? total_us / samples : 0,
+  };
+  portEXIT_CRITICAL(&lock);
+  return stats;
+}
+
+void LatencyTracker::writeJson(Print& out) {
+  LatencyStats_t stats = this->getStats();
+  out.printf(
+      "\"latency\": {\"samples\": %u, \"last_us\": %lld, \"min_us\": %lld, "
+      "\"max_us\": %lld, \"avg_us\": %lld}",
+      stats.samples, stats.last_us, stats.min_us, stats.max_us,
+      stats.avg_us);
+}
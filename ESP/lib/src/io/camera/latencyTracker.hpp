@@ -0,0 +1,41 @@
+#pragma once
+#ifndef LATENCY_TRACKER_HPP
+#define LATENCY_TRACKER_HPP
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <string>
+
+/**
+ * @brief Accumulates the capture-to-send latency of the frames pushed out by
+ * the transports (MJPEG stream, serial)
+ * @details Samples are taken against the frame buffer timestamp, which the
+ * camera driver fills in from esp_timer_get_time()
+ */
+class LatencyTracker {
+ public:
+  struct LatencyStats_t {
+    uint32_t samples;
+    int64_t last_us;
+    int64_t min_us;
+    int64_t max_us;
+    int64_t avg_us;
+  };
+
+  LatencyTracker();
+  void record(const struct timeval& captured);
+  void reset();
+  LatencyStats_t getStats();
+  void writeJson(Print& out);
+
+ private:
+  portMUX_TYPE lock;
+  uint32_t samples;
+  int64_t total_us;
+  int64_t last_us;
+  int64_t min_us;
+  int64_t max_us;
+};
+
+extern LatencyTracker frameLatencyTracker;
+
+#endif  // LATENCY_TRACKER_HPP
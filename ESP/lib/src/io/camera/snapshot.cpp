@@ -0,0 +1,184 @@
+#include "snapshot.hpp"
+#include <esp_heap_caps.h>
+#include <img_converters.h>
+#include "data/utilities/metrics.hpp"
+#include "io/camera/cameraGate.hpp"
+#include "io/camera/frameStats.hpp"
+
+//! buffered frames esp_camera_fb_get() may hand out before a fresh one, with
+//! nobody streaming they sat in the driver since the stream stopped
+#define SNAPSHOT_MAX_STALE_FRAMES 3
+
+SnapshotProvider snapshotProvider;
+
+SnapshotProvider::SnapshotProvider()
+    : lock(portMUX_INITIALIZER_UNLOCKED),
+      taker(xSemaphoreCreateMutexStatic(&takerBuffer)),
+      ready(xSemaphoreCreateBinaryStatic(&readyBuffer)),
+      pending(false),
+      lastOffer_ms(0),
+      lastProducer(nullptr),
+      handoff() {}
+
+void SnapshotProvider::offer(const uint8_t* jpeg,
+                             size_t len,
+                             const FrameMetadata_t& metadata) {
+  lastOffer_ms = millis();
+  lastProducer = xTaskGetCurrentTaskHandle();
+  if (!pending || !this->claim())
+    return;
+  this->handOver(copy(jpeg, len), len, metadata);
+}
+
+void SnapshotProvider::offer(const camera_fb_t* fb,
+                             const FrameMetadata_t* metadata) {
+  lastOffer_ms = millis();
+  lastProducer = xTaskGetCurrentTaskHandle();
+  if (!pending || !this->claim())
+    return;
+
+  size_t len = fb->len;
+  uint8_t* jpeg = fb->format == PIXFORMAT_JPEG ? copy(fb->buf, fb->len)
+                                               : encode(fb, &len);
+  this->handOver(jpeg, len,
+                 metadata ? *metadata : FrameMetadata::fromFrame(fb));
+}
+
+bool SnapshotProvider::take(Snapshot_t* snapshot) {
+  xSemaphoreTake(taker, portMAX_DELAY);
+
+  bool taken = false;
+  if (this->isStreaming()) {
+    portENTER_CRITICAL(&lock);
+    pending = true;
+    portEXIT_CRITICAL(&lock);
+
+    bool handed =
+        xSemaphoreTake(ready, pdMS_TO_TICKS(SNAPSHOT_WAIT_MS)) == pdTRUE;
+    // nothing came, unless a transport claimed it just now and is still
+    // copying, then it's worth the wait
+    if (!handed && !this->claim())
+      handed = xSemaphoreTake(ready, portMAX_DELAY) == pdTRUE;
+    if (handed && handoff.jpeg) {
+      *snapshot = handoff;
+      taken = true;
+    }
+    handoff = Snapshot_t();
+  }
+  if (!taken)
+    taken = this->capture(snapshot);
+
+  xSemaphoreGive(taker);
+  return taken;
+}
+
+void SnapshotProvider::release(Snapshot_t& snapshot) {
+  free(snapshot.jpeg);
+  snapshot.jpeg = nullptr;
+  snapshot.len = 0;
+}
+
+size_t SnapshotProvider::splitHeaders(char* block,
+                                      SnapshotHeader_t* headers,
+                                      size_t maxHeaders) {
+  size_t count = 0;
+  char* line = block;
+  while (*line && count < maxHeaders) {
+    char* end = strstr(line, "\r\n");
+    if (!end)
+      break;
+    *end = '\0';
+    char* colon = strchr(line, ':');
+    if (colon) {
+      *colon = '\0';
+      char* value = colon + 1;
+      while (*value == ' ')
+        value++;
+      headers[count++] = {line, value};
+    }
+    line = end + 2;
+  }
+  return count;
+}
+
+bool SnapshotProvider::isStreaming() {
+  TaskHandle_t producer = lastProducer;
+  return producer && producer != xTaskGetCurrentTaskHandle() &&
+         millis() - lastOffer_ms < SNAPSHOT_STREAM_IDLE_MS;
+}
+
+//! takes the waiting snapshot for the calling task, only one gets it
+bool SnapshotProvider::claim() {
+  portENTER_CRITICAL(&lock);
+  bool claimed = pending;
+  pending = false;
+  portEXIT_CRITICAL(&lock);
+  return claimed;
+}
+
+void SnapshotProvider::handOver(uint8_t* jpeg,
+                                size_t len,
+                                const FrameMetadata_t& metadata) {
+  if (!jpeg)
+    log_e("[Snapshot]: Could not copy the frame");
+  handoff.jpeg = jpeg;
+  handoff.len = jpeg ? len : 0;
+  handoff.metadata = metadata;
+  xSemaphoreGive(ready);
+}
+
+bool SnapshotProvider::capture(Snapshot_t* snapshot) {
+  CameraPass pass;
+  if (!pass)
+    return false;
+
+  camera_fb_t* fb = nullptr;
+  for (int i = 0; i <= SNAPSHOT_MAX_STALE_FRAMES; i++) {
+    fb = esp_camera_fb_get();
+    if (!fb)
+      break;
+    int64_t captured_us =
+        (int64_t)fb->timestamp.tv_sec * 1000000LL + fb->timestamp.tv_usec;
+    if (esp_timer_get_time() - captured_us < SNAPSHOT_STREAM_IDLE_MS * 1000LL ||
+        i == SNAPSHOT_MAX_STALE_FRAMES)
+      break;
+    esp_camera_fb_return(fb);
+  }
+  if (!fb) {
+    log_e("[Snapshot]: Camera capture failed");
+    metrics.count(METRIC_CAMERA_CAPTURE_ERRORS);
+    return false;
+  }
+
+  snapshot->metadata = FrameMetadata::fromFrame(fb);
+  FrameStats_t stats = {};
+  if (frameStatsProvider.process(fb, &stats))
+    FrameMetadata::attachStats(snapshot->metadata, stats);
+  snapshot->len = fb->len;
+  snapshot->jpeg = fb->format == PIXFORMAT_JPEG ? copy(fb->buf, fb->len)
+                                                : encode(fb, &snapshot->len);
+  esp_camera_fb_return(fb);
+  if (!snapshot->jpeg) {
+    log_e("[Snapshot]: Could not copy the frame");
+    snapshot->len = 0;
+    return false;
+  }
+  return true;
+}
+
+uint8_t* SnapshotProvider::copy(const uint8_t* data, size_t len) {
+  // a frame is tens of KB, keep it out of internal RAM when we can
+  uint32_t caps = psramFound() ? MALLOC_CAP_SPIRAM : MALLOC_CAP_8BIT;
+  uint8_t* buffer = (uint8_t*)heap_caps_malloc(len, caps);
+  if (buffer)
+    memcpy(buffer, data, len);
+  return buffer;
+}
+
+//! the pupil tracker runs the sensor in grayscale
+uint8_t* SnapshotProvider::encode(const camera_fb_t* fb, size_t* len) {
+  uint8_t* jpeg = nullptr;
+  if (!frame2jpg(const_cast<camera_fb_t*>(fb), 80, &jpeg, len))
+    return nullptr;
+  return jpeg;
+}
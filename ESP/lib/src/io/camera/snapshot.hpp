@@ -0,0 +1,82 @@
+#pragma once
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+#include <Arduino.h>
+#include <esp_camera.h>
+#include <freertos/semphr.h>
+#include "io/camera/frameMetadata.hpp"
+
+//! a transport that handed over a frame within that time counts as streaming
+#define SNAPSHOT_STREAM_IDLE_MS 500
+//! how long to wait for a streaming transport to hand over its next frame
+#define SNAPSHOT_WAIT_MS 250
+//! header fields FrameMetadata::formatHeaders produces at most
+#define SNAPSHOT_MAX_HEADERS 10
+
+struct Snapshot_t {
+  //! always JPEG, free it with SnapshotProvider::release
+  uint8_t* jpeg;
+  size_t len;
+  FrameMetadata_t metadata;
+};
+
+struct SnapshotHeader_t {
+  const char* name;
+  const char* value;
+};
+
+/**
+ * @brief Single JPEG stills out of the running capture pipeline
+ * @details The transports (MJPEG stream, serial stream, pupil tracker) offer
+ * every frame they got from the driver. While one of them streams, a
+ * snapshot is a copy of the next frame it offers - the stream keeps all its
+ * frames and the driver sees no extra esp_camera_fb_get(). Only when nothing
+ * streams does take() capture a frame itself.
+ *
+ * Offering costs a flag check per frame, the copy (and for grayscale frames
+ * the JPEG encoding) only happens when a snapshot is waiting.
+ */
+class SnapshotProvider {
+ public:
+  SnapshotProvider();
+  //! a frame the transport already has as JPEG
+  void offer(const uint8_t* jpeg, size_t len, const FrameMetadata_t& metadata);
+  //! a driver frame, without metadata it gets built from the frame if needed
+  void offer(const camera_fb_t* fb, const FrameMetadata_t* metadata);
+  /**
+   * @brief Blocks for up to a frame of the running stream, or for a capture
+   * when nothing streams
+   * @return false if the camera gave no frame or the copy did not fit
+   */
+  bool take(Snapshot_t* snapshot);
+  static void release(Snapshot_t& snapshot);
+  //! splits FrameMetadata::formatHeaders output in place, for HTTP servers
+  //! taking the headers one by one
+  static size_t splitHeaders(char* block,
+                             SnapshotHeader_t* headers,
+                             size_t maxHeaders);
+
+ private:
+  bool isStreaming();
+  bool claim();
+  void handOver(uint8_t* jpeg, size_t len, const FrameMetadata_t& metadata);
+  bool capture(Snapshot_t* snapshot);
+  static uint8_t* copy(const uint8_t* data, size_t len);
+  static uint8_t* encode(const camera_fb_t* fb, size_t* len);
+
+  portMUX_TYPE lock;
+  StaticSemaphore_t takerBuffer;
+  StaticSemaphore_t readyBuffer;
+  //! one snapshot at a time, the others queue up
+  SemaphoreHandle_t taker;
+  SemaphoreHandle_t ready;
+  volatile bool pending;
+  volatile uint32_t lastOffer_ms;
+  //! the task that offered last, a take() from that very task can't wait on it
+  volatile TaskHandle_t lastProducer;
+  Snapshot_t handoff;
+};
+
+extern SnapshotProvider snapshotProvider;
+
+#endif  // SNAPSHOT_HPP
@@ -36,6 +36,25 @@ void BaseAPI::begin() {
 
   DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
 
+  // the default path Prometheus scrapes
+  server.on("/metrics", 0b00000001,
+            [&](AsyncWebServerRequest* request) { getMetrics(request); });
+#ifndef SIM_ENABLED
+  // next to the stream server's, which can't answer while it streams
+  server.on("/snapshot", 0b00000001,
+            [&](AsyncWebServerRequest* request) { snapshot(request); });
+#endif  // SIM_ENABLED
+  // a whole or partial config as one JSON body, applied all or nothing
+  AsyncCallbackJsonWebHandler* configHandler = new AsyncCallbackJsonWebHandler(
+      "/config", [&](AsyncWebServerRequest* request, JsonVariant& json) {
+        setConfig(request, json);
+      });
+  configHandler->setMethod(0b00000010);
+  configHandler->setMaxContentLength(CONFIG_BATCH_MAX_BODY);
+  server.addHandler(configHandler);
+  // Server-Sent Events, state transitions and periodic telemetry
+  telemetryEvents.begin(server);
+
   // The restart_device endpoint has been removed in favor of using rebootDevice through POST
 
   // std::bind(&BaseAPI::notFound, &std::placeholders::_1);
@@ -118,24 +137,12 @@ void BaseAPI::getJsonConfig(AsyncWebServerRequest* request) {
   // returns the current stored config in case it get's deleted on the PC.
   switch (_networkMethodsMap_enum[request->method()]) {
     case GET: {
-      std::string wifiConfigSerialized = "\"wifi_config\": [";
-      auto networksConfigs = projectConfig.getWifiConfigs();
-      for (auto& networkConfig : networksConfigs) {
-        wifiConfigSerialized += networkConfig.toRepresentation();
-
-        if (&networkConfig != &networksConfigs.back())
-          wifiConfigSerialized += ",";
-      }
-      wifiConfigSerialized += "]";
-
-      std::string json = Helpers::format_string(
-          "{%s, %s, %s, %s, %s}",
-          projectConfig.getDeviceConfig().toRepresentation().c_str(),
-          projectConfig.getCameraConfig().toRepresentation().c_str(),
-          wifiConfigSerialized.c_str(),
-          projectConfig.getMDNSConfig().toRepresentation().c_str(),
-          projectConfig.getAPWifiConfig().toRepresentation().c_str());
-      request->send(200, MIMETYPE_JSON, json.c_str());
+      // printed section by section into the response buffer, no copies of
+      // the whole config on the way
+      AsyncResponseStream* response =
+          request->beginResponseStream(MIMETYPE_JSON);
+      projectConfig.writeJson(*response);
+      request->send(response);
       break;
     }
     default: {
@@ -159,6 +166,7 @@ void BaseAPI::setDeviceConfig(AsyncWebServerRequest* request) {
       std::string ota_password;
       std::string ota_login;
       int ota_port;
+      int ota_bandwidth_share = -1;
 
       for (int i = 0; i < params; i++) {
         const AsyncWebParameter* param = request->getParam(i);
@@ -178,11 +186,17 @@ void BaseAPI::setDeviceConfig(AsyncWebServerRequest* request) {
           ota_login.assign(param->value().c_str());
         } else if (param->name() == "ota_password") {
           ota_password.assign(param->value().c_str());
+        } else if (param->name() == "ota_bandwidth_share") {
+          ota_bandwidth_share = atoi(param->value().c_str());
         }
       }
       // note: We're passing empty params by design, this is done to reset
       // specific fields
       projectConfig.setDeviceConfig(ota_login, ota_password, ota_port, true);
+      // unlike the fields above, left out it keeps its value
+      if (ota_bandwidth_share >= 0)
+        projectConfig.setOTABandwidthShare(
+            min(ota_bandwidth_share, OTA_MAX_BANDWIDTH_SHARE), true);
       projectConfig.setMDNSConfig(hostname, service, true);
       request->send(200, MIMETYPE_JSON,
                     "{\"msg\":\"Done. Device Config has been set.\"}");
@@ -212,6 +226,232 @@ void BaseAPI::setWiFiTXPower(AsyncWebServerRequest* request) {
   }
 }
 
+void BaseAPI::setRadioProfile(AsyncWebServerRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET:
+    case POST: {
+      if (!request->hasParam("profile")) {
+        AsyncResponseStream* response =
+            request->beginResponseStream(MIMETYPE_JSON);
+        response->printf(
+            "{\"profile\": \"%s\", ",
+            RadioProfiles::getSettings(projectConfig.getRadioConfig().profile)
+                .name);
+        projectConfig.getRadioConfig().writeJson(*response);
+        response->print("}");
+        request->send(response);
+        break;
+      }
+
+      RadioProfile profile;
+      if (!RadioProfiles::fromName(
+              request->getParam("profile")->value().c_str(), &profile)) {
+        request->send(400, MIMETYPE_JSON,
+                      "{\"msg\":\"profile must be lowest_latency, balanced "
+                      "or low_power\"}");
+        break;
+      }
+      projectConfig.setRadioConfig(profile, true);
+      projectConfig.radioConfigSave();
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Done. Radio profile has been set.\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+/**
+ * @brief GET returns the last results, POST starts a new test with the
+ * optional host, port and count params
+ */
+void BaseAPI::radioSelfTest(AsyncWebServerRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET: {
+      AsyncResponseStream* response =
+          request->beginResponseStream(MIMETYPE_JSON);
+      response->print("{");
+      ::radioSelfTest.writeJson(*response);
+      response->print("}");
+      request->send(response);
+      break;
+    }
+    case POST: {
+      std::string host;
+      int port = 0;
+      int count = RADIO_SELF_TEST_PING_COUNT;
+
+      int params = request->params();
+      for (int i = 0; i < params; i++) {
+        const AsyncWebParameter* param = request->getParam(i);
+        if (param->name() == "host") {
+          host.assign(param->value().c_str());
+        } else if (param->name() == "port") {
+          port = param->value().toInt();
+        } else if (param->name() == "count") {
+          count = param->value().toInt();
+        }
+      }
+
+      if (port < 0 || port > 65535 || count < 1 || count > 1000) {
+        request->send(400, MIMETYPE_JSON,
+                      "{\"msg\":\"port must be 0-65535 and count 1-1000\"}");
+        break;
+      }
+
+      if (!::radioSelfTest.start(
+              host, port, count,
+              static_cast<int>(projectConfig.getRadioConfig().profile))) {
+        request->send(409, MIMETYPE_JSON,
+                      "{\"msg\":\"A test is already running, or we're not "
+                      "connected\"}");
+        break;
+      }
+      request->send(202, MIMETYPE_JSON,
+                    "{\"msg\":\"Self-test started, GET for the results\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+void BaseAPI::getMetrics(AsyncWebServerRequest* request) {
+  AsyncResponseStream* response =
+      request->beginResponseStream("text/plain; version=0.0.4");
+  ::metrics.writePrometheus(*response);
+  request->send(response);
+}
+
+void BaseAPI::getLog(AsyncWebServerRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET: {
+      // raw=1 for tools/binlog_decode.py, keeps the records
+      if (request->hasParam("raw")) {
+        AsyncResponseStream* response =
+            request->beginResponseStream("application/octet-stream");
+        binaryLog.dumpRaw(*response);
+        request->send(response);
+        break;
+      }
+      AsyncResponseStream* response = request->beginResponseStream("text/plain");
+      binaryLog.drain(*response);
+      request->send(response);
+      break;
+    }
+    case POST: {
+      LogModule_e module;
+      LogLevel_e level;
+      if (!BinaryLog::moduleFromName(request->arg("module").c_str(), &module) ||
+          !BinaryLog::levelFromName(request->arg("level").c_str(), &level)) {
+        request->send(400, MIMETYPE_JSON,
+                      "{\"msg\":\"Unknown log module or level\"}");
+        break;
+      }
+      binaryLog.setLevel(module, level);
+      request->send(200, MIMETYPE_JSON, "{\"msg\":\"Done. Log level set\"}");
+      break;
+    }
+    case DELETE: {
+      binaryLog.clear();
+      request->send(200, MIMETYPE_JSON, "{\"msg\":\"Log cleared\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+/**
+ * @brief GET returns the /events subscribers and counters, POST sets the
+ * telemetry interval with interval_ms
+ */
+void BaseAPI::eventsConfig(AsyncWebServerRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET: {
+      AsyncResponseStream* response =
+          request->beginResponseStream(MIMETYPE_JSON);
+      response->print("{");
+      telemetryEvents.writeJson(*response);
+      response->print("}");
+      request->send(response);
+      break;
+    }
+    case POST: {
+      if (!request->hasParam("interval_ms")) {
+        request->send(400, MIMETYPE_JSON,
+                      "{\"msg\":\"interval_ms is required\"}");
+        break;
+      }
+      telemetryEvents.setInterval(
+          request->getParam("interval_ms")->value().toInt());
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Done. Telemetry interval set\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+void BaseAPI::trace(AsyncWebServerRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET: {
+      // chunked, the full trace doesn't have to fit in RAM twice
+      auto exporter = std::make_shared<TraceExporter>();
+      AsyncWebServerResponse* response = request->beginChunkedResponse(
+          MIMETYPE_JSON, [exporter](uint8_t* buffer, size_t maxLen,
+                                    size_t index) -> size_t {
+            return exporter->read(buffer, maxLen);
+          });
+      request->send(response);
+      break;
+    }
+    case DELETE: {
+      traceProfiler.clear();
+      request->send(200, MIMETYPE_JSON, "{\"msg\":\"Trace cleared\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+//! GET the heap, PSRAM and stack report, DELETE starts the allocation counts
+//! over
+void BaseAPI::memory(AsyncWebServerRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET: {
+      AsyncResponseStream* response =
+          request->beginResponseStream(MIMETYPE_JSON);
+      memoryTelemetry.writeJson(*response);
+      request->send(response);
+      break;
+    }
+    case DELETE: {
+      memoryTelemetry.resetAllocations();
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Allocation counts cleared\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
 void BaseAPI::rebootDevice(AsyncWebServerRequest* request) {
   switch (_networkMethodsMap_enum[request->method()]) {
     case GET: {
@@ -299,10 +539,242 @@ void BaseAPI::setCamera(AsyncWebServerRequest* request) {
 
 void BaseAPI::restartCamera(AsyncWebServerRequest* request) {
   bool mode = (bool)atoi(request->arg("mode").c_str());
-  camera.resetCamera(mode);
+  // a power cycle takes a while, don't hold up the web server for it
+  CameraHandler* cameraHandler = &camera;
+  if (!OpenIrisTasks::Defer([cameraHandler, mode] {
+        cameraHandler->resetCamera(mode);
+      })) {
+    request->send(503, MIMETYPE_JSON,
+                  "{\"msg\":\"Could not schedule the camera restart\"}");
+    return;
+  }
 
   request->send(200, MIMETYPE_JSON,
-                "{\"msg\":\"Done. Camera had been restarted.\"}");
+                "{\"msg\":\"Done. Camera is being restarted.\"}");
+}
+
+void BaseAPI::setFrameBuffers(AsyncWebServerRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET:
+    case POST: {
+      auto cameraConfig = projectConfig.getCameraConfig();
+      uint8_t fb_count = cameraConfig.fb_count;
+      uint8_t grab_mode = cameraConfig.grab_mode;
+
+      int params = request->params();
+      for (int i = 0; i < params; i++) {
+        const AsyncWebParameter* param = request->getParam(i);
+        if (param->name() == "fb_count") {
+          fb_count = (uint8_t)param->value().toInt();
+        } else if (param->name() == "grab_mode") {
+          grab_mode = (uint8_t)param->value().toInt();
+        }
+      }
+
+      if (fb_count > 3 || grab_mode > CAMERA_GRAB_LATEST) {
+        request->send(400, MIMETYPE_JSON,
+                      "{\"msg\":\"fb_count must be 0-3 and grab_mode 0-1\"}");
+        break;
+      }
+
+      projectConfig.setCameraBufferConfig(fb_count, grab_mode, true);
+      projectConfig.cameraConfigSave();
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Done. Frame buffers have been set.\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+void BaseAPI::setConfig(AsyncWebServerRequest* request, JsonVariant& json) {
+  MEMORY_SCOPE(MEMORY_MODULE_API);
+  ConfigBatch batch(projectConfig);
+  AsyncResponseStream* response = request->beginResponseStream(MIMETYPE_JSON);
+  if (!batch.stage(json)) {
+    response->setCode(400);
+    response->print("{\"msg\": ");
+    JsonWriter::writeString(*response, batch.getError());
+    response->print("}");
+    request->send(response);
+    return;
+  }
+  // saved before the observers run, a reconnect may drop this connection
+  batch.commit(true);
+  response->print("{\"msg\": \"Done. Config applied\", \"sections\": ");
+  response->print(batch.sectionsToJson().c_str());
+  response->print("}");
+  request->send(response);
+}
+
+void BaseAPI::frameLatency(AsyncWebServerRequest* request) {
+  // report the latency together with the settings the driver is actually
+  // running with, the stored ones get clamped to what the board supports
+  AsyncResponseStream* response = request->beginResponseStream(MIMETYPE_JSON);
+  response->printf("{\"fb_count\": %u, \"grab_mode\": %u, ",
+                   camera.getFrameBufferCount(), camera.getGrabMode());
+  frameLatencyTracker.writeJson(*response);
+  response->print("}");
+  request->send(response);
+}
+
+void BaseAPI::frameStats(AsyncWebServerRequest* request) {
+  AsyncResponseStream* response = request->beginResponseStream(MIMETYPE_JSON);
+  response->print("{");
+  frameStatsProvider.writeJson(*response);
+  response->print("}");
+  request->send(response);
+}
+
+void BaseAPI::frameThumbnail(AsyncWebServerRequest* request) {
+  // the DC thumbnail of the latest frame, as a binary PGM image
+  uint16_t width = 0;
+  uint16_t height = 0;
+  std::unique_ptr<uint8_t[]> pixels(new uint8_t[JPEG_DC_MAX_BLOCKS]);
+  size_t count = frameStatsProvider.copyThumbnail(
+      pixels.get(), JPEG_DC_MAX_BLOCKS, &width, &height);
+  if (!count) {
+    request->send(404, MIMETYPE_JSON,
+                  "{\"msg\":\"No frame stats, enable them first\"}");
+    return;
+  }
+
+  AsyncResponseStream* response =
+      request->beginResponseStream("image/x-portable-graymap");
+  response->printf("P5\n%u %u\n255\n", width, height);
+  response->write(pixels.get(), count);
+  request->send(response);
+}
+
+void BaseAPI::setPupilTracker(AsyncWebServerRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET:
+    case POST: {
+      auto pupilConfig = projectConfig.getPupilConfig();
+      bool enabled = pupilConfig.enabled;
+      int threshold = pupilConfig.threshold;
+      bool ellipseFit = pupilConfig.ellipseFit;
+      PupilTransport transport = pupilConfig.transport;
+      std::string udpHost = pupilConfig.udpHost;
+      int udpPort = pupilConfig.udpPort;
+      int keyframeInterval = pupilConfig.keyframeInterval;
+
+      int params = request->params();
+      for (int i = 0; i < params; i++) {
+        const AsyncWebParameter* param = request->getParam(i);
+        if (param->name() == "enabled") {
+          enabled = (bool)param->value().toInt();
+        } else if (param->name() == "threshold") {
+          threshold = param->value().toInt();
+        } else if (param->name() == "ellipse_fit") {
+          ellipseFit = (bool)param->value().toInt();
+        } else if (param->name() == "transport") {
+          transport = param->value() == "udp" ? PupilTransport::UDP_OUTPUT
+                                              : PupilTransport::SERIAL_OUTPUT;
+        } else if (param->name() == "udp_host") {
+          udpHost = param->value().c_str();
+        } else if (param->name() == "udp_port") {
+          udpPort = param->value().toInt();
+        } else if (param->name() == "keyframe_interval") {
+          keyframeInterval = param->value().toInt();
+        }
+      }
+
+      if (threshold < 0 || threshold > 255 || udpPort <= 0 ||
+          udpPort > 65535 || keyframeInterval < 0 ||
+          keyframeInterval > 65535) {
+        request->send(400, MIMETYPE_JSON,
+                      "{\"msg\":\"threshold must be 0-255, udp_port 1-65535 "
+                      "and keyframe_interval 0-65535\"}");
+        break;
+      }
+
+      projectConfig.setPupilConfig(enabled, threshold, ellipseFit, transport,
+                                   udpHost, udpPort, keyframeInterval, true);
+      projectConfig.pupilConfigSave();
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Done. Pupil tracker config has been set.\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+void BaseAPI::setFrameSuppression(AsyncWebServerRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET:
+    case POST: {
+      auto streamConfig = projectConfig.getStreamConfig();
+      bool enabled = streamConfig.suppressUnchanged;
+      int sizeDelta = streamConfig.suppressSizeDelta;
+      int dcDelta = streamConfig.suppressDCDelta;
+      int maxKeyframeInterval = streamConfig.maxKeyframeInterval;
+
+      int params = request->params();
+      for (int i = 0; i < params; i++) {
+        const AsyncWebParameter* param = request->getParam(i);
+        if (param->name() == "enabled") {
+          enabled = (bool)param->value().toInt();
+        } else if (param->name() == "size_delta") {
+          sizeDelta = param->value().toInt();
+        } else if (param->name() == "dc_delta") {
+          dcDelta = param->value().toInt();
+        } else if (param->name() == "max_keyframe_interval") {
+          maxKeyframeInterval = param->value().toInt();
+        }
+      }
+
+      if (sizeDelta < 0 || sizeDelta > 100 || dcDelta < 0 || dcDelta > 255 ||
+          maxKeyframeInterval < 0 || maxKeyframeInterval > 65535) {
+        request->send(400, MIMETYPE_JSON,
+                      "{\"msg\":\"size_delta must be 0-100, dc_delta 0-255 "
+                      "and max_keyframe_interval 0-65535\"}");
+        break;
+      }
+
+      projectConfig.setFrameSuppressionConfig(enabled, sizeDelta, dcDelta,
+                                              maxKeyframeInterval, true);
+      projectConfig.streamConfigSave();
+      frameSuppression.resetCounters();
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Done. Frame suppression has been set.\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+void BaseAPI::frameSuppressionStats(AsyncWebServerRequest* request) {
+  AsyncResponseStream* response = request->beginResponseStream(MIMETYPE_JSON);
+  response->print("{");
+  frameSuppression.writeJson(*response);
+  response->print("}");
+  request->send(response);
+}
+
+/**
+ * @brief A single JPEG with the frame metadata as headers
+ * @details Taken on the deferred worker, the server goes on meanwhile, see
+ * SnapshotResponse
+ */
+void BaseAPI::snapshot(AsyncWebServerRequest* request) {
+  SnapshotResponse* response = new SnapshotResponse();
+  if (!response->begin()) {
+    delete response;
+    request->send(503, MIMETYPE_JSON,
+                  "{\"msg\":\"Could not take a snapshot\"}");
+    return;
+  }
+  request->send(response);
 }
 #endif  // SIM_ENABLED
 
@@ -319,31 +791,120 @@ void BaseAPI::save(AsyncWebServerRequest* request) {
   request->send(200, MIMETYPE_JSON, "{\"msg\": \"ok\" }");
 }
 
+/**
+ * @brief Answers right away from the background link sampler, the old
+ * "points" parameter is accepted but no longer needed
+ */
 void BaseAPI::rssi(AsyncWebServerRequest* request) {
-  int rssi = Network_Utilities::getStrength(
-      request->getParam("points")->value().toInt());
-  char _rssiBuffer[20];
-  snprintf(_rssiBuffer, sizeof(_rssiBuffer), "{\"rssi\": %d }", rssi);
-  request->send(200, MIMETYPE_JSON, _rssiBuffer);
+  AsyncResponseStream* response = request->beginResponseStream(MIMETYPE_JSON);
+  response->printf("{\"rssi\": %d, ", linkQuality.getRSSI());
+  linkQuality.writeJson(*response);
+  response->print("}");
+  request->send(response);
 }
 
 //*********************************************************************************************
 //!                                     OTA Command Functions
 //*********************************************************************************************
 
-void BaseAPI::checkAuthentication(AsyncWebServerRequest* request,
+/**
+ * @brief Asks for the credentials when they are required and missing
+ * @return false if the request got its 401, the handler must not answer it
+ * again
+ */
+bool BaseAPI::checkAuthentication(AsyncWebServerRequest* request,
                                   const char* login,
                                   const char* password) {
-  log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
   if (_authRequired) {
-    log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
     log_i("Auth required");
-    log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
     if (!request->authenticate(login, password, NULL, false)) {
-      log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
-      return request->requestAuthentication(NULL, false);
+      request->requestAuthentication(NULL, false);
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief POST /update/chunk?offset=<n>[&final=1], a piece of the file as the
+ * raw body
+ * @details Offset 0 starts a new session, that piece may name the
+ * encoding (gzip, deflate, none - detected when left out), md5, sha256 and
+ * target=filesystem. A piece at an offset past what arrived so far gets 409
+ * and the status, its "received" is where to go on from. final=1 on the
+ * last piece verifies and finishes the update.
+ */
+void BaseAPI::updateChunk(AsyncWebServerRequest* request) {
+  size_t offset = request->hasParam("offset")
+                      ? strtoul(request->getParam("offset")->value().c_str(),
+                                nullptr, 10)
+                      : 0;
+  switch (otaUpdater.getState()) {
+    case OTAUpdater::OTA_RECEIVING:
+      if (otaUpdater.getOffset() < offset + request->contentLength())
+        return sendUpdateStatus(request, 409);
+      if (request->hasParam("final") &&
+          request->getParam("final")->value() == "1" && !finishUpdate())
+        return sendUpdateStatus(request, 500);
+      return sendUpdateStatus(request, 200);
+    case OTAUpdater::OTA_DONE:
+      return sendUpdateStatus(request, 200);
+    case OTAUpdater::OTA_FAILED:
+      return sendUpdateStatus(request, 500);
+    default:
+      // nothing started, the first piece has to be at offset 0
+      return sendUpdateStatus(request, 409);
+  }
+}
+
+void BaseAPI::updateChunkBody(AsyncWebServerRequest* request,
+                              uint8_t* data,
+                              size_t len,
+                              size_t index) {
+  size_t offset = request->hasParam("offset")
+                      ? strtoul(request->getParam("offset")->value().c_str(),
+                                nullptr, 10)
+                      : 0;
+  if (offset + index == 0) {
+    OTAUpdater::Encoding_e encoding = OTAUpdater::ENCODING_AUTO;
+    const AsyncWebParameter* param = request->getParam("encoding");
+    if (param &&
+        !OTAUpdater::encodingFromName(param->value().c_str(), &encoding)) {
+      log_e("[OTA]: Unknown encoding: %s", param->value().c_str());
+      otaUpdater.abort();
+      return;
     }
+    param = request->getParam("target");
+    int command = param && param->value() == "filesystem" ? U_SPIFFS : U_FLASH;
+    param = request->getParam("md5");
+    std::string md5 = param ? param->value().c_str() : "";
+    param = request->getParam("sha256");
+    std::string sha256 = param ? param->value().c_str() : "";
+    otaUpdater.setBandwidthShare(
+        projectConfig.getDeviceConfig().OTABandwidthShare);
+    if (!otaUpdater.begin(command, encoding, md5, sha256))
+      return;
   }
+  otaUpdater.write(offset + index, data, len);
+}
+
+/**
+ * @brief The switch-over: once the image checks out the streams end, and the
+ * camera is powered down right before the restart into the new image
+ */
+bool BaseAPI::finishUpdate() {
+  if (!otaUpdater.end())
+    return false;
+  // the response still has to go out
+  OpenIrisTasks::ScheduleRestart(OTA_SWITCH_OVER_DELAY_MS);
+  return true;
+}
+
+void BaseAPI::sendUpdateStatus(AsyncWebServerRequest* request, int code) {
+  AsyncResponseStream* response = request->beginResponseStream(MIMETYPE_JSON);
+  response->setCode(code);
+  otaUpdater.writeJson(*response);
+  request->send(response);
 }
 
 void BaseAPI::beginOTA() {
@@ -367,15 +928,14 @@ void BaseAPI::beginOTA() {
 
   log_d("[OTA Server]: Username: %s, Password: %s",
         device_config.OTALogin.c_str(), device_config.OTAPassword.c_str());
-  log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
   const char* login = device_config.OTALogin.c_str();
   const char* password = device_config.OTAPassword.c_str();
-  log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
 
   // Note: HTTP_GET
   server.on(
       "/update/identity", 0b00000001, [&](AsyncWebServerRequest* request) {
-        checkAuthentication(request, login, password);
+        if (!checkAuthentication(request, login, password))
+          return;
 
         String _id = String((uint32_t)ESP.getEfuseMac(), HEX);
         _id.toUpperCase();
@@ -383,14 +943,48 @@ void BaseAPI::beginOTA() {
                       "{\"id\": \"" + _id + "\", \"hardware\": \"ESP32\"}");
       });
 
-  server.on("/update", 0b00000001, [&](AsyncWebServerRequest* request) {
-    log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
-    checkAuthentication(request, login, password);
-
-    // turn off the camera and stop the stream
+  // only after a successful update, the streams are gone by then, the serial
+  // transport and the pupil tracker have to let go first
+  OpenIrisTasks::AddPreRestartHook("camera", [] {
+    if (otaUpdater.getState() != OTAUpdater::OTA_DONE)
+      return;
+    if (!cameraGate.close(pdMS_TO_TICKS(CAMERA_DRAIN_TIMEOUT_MS)))
+      return;
     esp_camera_deinit();                // deinitialize the camera driver
     digitalWrite(PWDN_GPIO_NUM, HIGH);  // turn power off to camera module
+  });
+
+  // resumable uploads, see updateChunk
+  server.on(
+      "/update/chunk", 0b00000010,
+      [&](AsyncWebServerRequest* request) {
+        if (!checkAuthentication(request, login, password))
+          return;
+        updateChunk(request);
+      },
+      nullptr,
+      [&](AsyncWebServerRequest* request, uint8_t* data, size_t len,
+          size_t index, size_t total) {
+        // no response from here, the request handler answers afterwards
+        if (_authRequired &&
+            !request->authenticate(login, password, NULL, false))
+          return;
+        updateChunkBody(request, data, len, index);
+      });
 
+  // where an interrupted upload has to go on from, transfer time, bytes saved
+  server.on("/update/status", 0b00000001, [&](AsyncWebServerRequest* request) {
+    if (!checkAuthentication(request, login, password))
+      return;
+    sendUpdateStatus(request, 200);
+  });
+
+  server.on("/update", 0b00000001, [&](AsyncWebServerRequest* request) {
+    if (!checkAuthentication(request, login, password))
+      return;
+
+    // the camera keeps running, it only stops for the switch-over once the
+    // new image is in, see finishUpdate
     AsyncWebServerResponse* response = request->beginResponse(
         200, "text/html", ELEGANT_HTML, ELEGANT_HTML_SIZE);
     response->addHeader("Content-Encoding", "gzip");
@@ -401,54 +995,51 @@ void BaseAPI::beginOTA() {
   server.on(
       "/update", 0b00000010,
       [&](AsyncWebServerRequest* request) {
-        checkAuthentication(request, login, password);
+        if (!checkAuthentication(request, login, password))
+          return;
         // the request handler is triggered after the upload has finished...
-        // create the response, add header, and send response
+        if (!request->hasParam("MD5", true))
+          return request->send(400, "text/plain", "MD5 parameter missing");
+        bool done = otaUpdater.getState() == OTAUpdater::OTA_DONE;
         AsyncWebServerResponse* response = request->beginResponse(
-            (Update.hasError()) ? 500 : 200, "text/plain",
-            (Update.hasError()) ? "FAIL" : "OK");
+            done ? 200 : 500, "text/plain",
+            done ? "OK" : ("FAIL: " + otaUpdater.getError()).c_str());
         response->addHeader("Connection", "close");
         response->addHeader("Access-Control-Allow-Origin", "*");
         request->send(response);
-        this->save(request);
+        projectConfig.save();
       },
       [&](AsyncWebServerRequest* request, String filename, size_t index,
           uint8_t* data, size_t len, bool final) {
-        // Upload handler chunks in data
-        checkAuthentication(request, login, password);
+        // Upload handler chunks in data, the request handler answers once
+        // the upload is through
+        if (_authRequired &&
+            !request->authenticate(login, password, NULL, false))
+          return;
 
         if (!index) {
           if (!request->hasParam("MD5", true)) {
-            return request->send(400, "text/plain", "MD5 parameter missing");
-          }
-
-          if (!Update.setMD5(request->getParam("MD5", true)->value().c_str())) {
-            return request->send(400, "text/plain", "MD5 parameter invalid");
+            otaUpdater.abort();
+            return;
           }
           int cmd = (filename == "filesystem") ? U_SPIFFS : U_FLASH;
-          if (!Update.begin(UPDATE_SIZE_UNKNOWN,
-                            cmd)) {  // Start with max available size
-            Update.printError(Serial);
-            return request->send(400, "text/plain", "OTA could not begin");
-          }
+          // a .bin.gz gets inflated on the way, the MD5 is the file's
+          std::string sha256 =
+              request->hasParam("SHA256", true)
+                  ? request->getParam("SHA256", true)->value().c_str()
+                  : "";
+          otaUpdater.setBandwidthShare(
+              projectConfig.getDeviceConfig().OTABandwidthShare);
+          otaUpdater.begin(cmd, OTAUpdater::ENCODING_AUTO,
+                           request->getParam("MD5", true)->value().c_str(),
+                           sha256);
         }
 
         // Write chunked data to the free sketch space
-        if (len) {
-          if (Update.write(data, len) != len) {
-            return request->send(400, "text/plain", "OTA could not begin");
-          }
-        }
+        if (len)
+          otaUpdater.write(index, data, len);
 
-        if (final) {  // if the final flag is set then this is the last frame of
-                      // data
-          if (!Update.end(
-                  true)) {  // true to set the size to the current progress
-            Update.printError(Serial);
-            return request->send(400, "text/plain", "Could not end OTA");
-          }
-        } else {
-          return;
-        }
+        if (final)  // if the final flag is set then this is the last frame
+          finishUpdate();
       });
 }
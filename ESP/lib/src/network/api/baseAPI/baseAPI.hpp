@@ -3,6 +3,7 @@
 
 //! Warning do not format this file with clang-format or it will break the code
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -26,13 +27,28 @@ constexpr int HTTP_ANY = 0b01111111;
 
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
+#include <AsyncJson.h>
 #include <FS.h>
 #include "Hash.h"
 #include "data/StateManager/StateManager.hpp"
+#include "data/config/configBatch.hpp"
 #include "data/config/project_config.hpp"
+#include "data/utilities/binaryLog.hpp"
+#include "data/utilities/metrics.hpp"
 #include "data/utilities/network_utilities.hpp"
+#include "data/utilities/traceProfiler.hpp"
 #include "elegantWebpage.h"
+#include "io/camera/cameraGate.hpp"
 #include "io/camera/cameraHandler.hpp"
+#include "io/camera/frameStats.hpp"
+#include "io/camera/frameSuppression.hpp"
+#include "io/camera/latencyTracker.hpp"
+#include "network/api/otaUpdater.hpp"
+#include "network/api/snapshotResponse.hpp"
+#include "network/api/telemetryEvents.hpp"
+#include "network/wifihandler/linkQuality.hpp"
+#include "network/wifihandler/radioProfiles.hpp"
+#include "network/wifihandler/radioSelfTest.hpp"
 #include "tasks/tasks.hpp"
 
 class BaseAPI {
@@ -47,6 +63,8 @@ class BaseAPI {
   /* Commands */
   void setWiFi(AsyncWebServerRequest* request);
   void setWiFiTXPower(AsyncWebServerRequest* request);
+  void setRadioProfile(AsyncWebServerRequest* request);
+  void radioSelfTest(AsyncWebServerRequest* request);
   void getJsonConfig(AsyncWebServerRequest* request);
   void factoryReset(AsyncWebServerRequest* request);
   void setDeviceConfig(AsyncWebServerRequest* request);
@@ -54,10 +72,33 @@ class BaseAPI {
   void ping(AsyncWebServerRequest* request);
   void save(AsyncWebServerRequest* request);
   void rssi(AsyncWebServerRequest* request);
+  void trace(AsyncWebServerRequest* request);
+  void memory(AsyncWebServerRequest* request);
+  void getMetrics(AsyncWebServerRequest* request);
+  void getLog(AsyncWebServerRequest* request);
+  void eventsConfig(AsyncWebServerRequest* request);
+  void setConfig(AsyncWebServerRequest* request, JsonVariant& json);
 
   /* Camera Handlers */
   void setCamera(AsyncWebServerRequest* request);
   void restartCamera(AsyncWebServerRequest* request);
+  void setFrameBuffers(AsyncWebServerRequest* request);
+  void frameLatency(AsyncWebServerRequest* request);
+  void frameStats(AsyncWebServerRequest* request);
+  void frameThumbnail(AsyncWebServerRequest* request);
+  void setPupilTracker(AsyncWebServerRequest* request);
+  void setFrameSuppression(AsyncWebServerRequest* request);
+  void frameSuppressionStats(AsyncWebServerRequest* request);
+  void snapshot(AsyncWebServerRequest* request);
+
+  /* OTA Handlers */
+  void updateChunk(AsyncWebServerRequest* request);
+  void updateChunkBody(AsyncWebServerRequest* request,
+                       uint8_t* data,
+                       size_t len,
+                       size_t index);
+  bool finishUpdate();
+  void sendUpdateStatus(AsyncWebServerRequest* request, int code);
 
   /* Route Command types */
   using route_method = void (BaseAPI::*)(AsyncWebServerRequest*);
@@ -112,7 +153,7 @@ class BaseAPI {
 
   virtual ~BaseAPI();
   virtual void begin();
-  void checkAuthentication(AsyncWebServerRequest* request,
+  bool checkAuthentication(AsyncWebServerRequest* request,
                            const char* login,
                            const char* password);
   void beginOTA();
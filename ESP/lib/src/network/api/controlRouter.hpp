@@ -0,0 +1,115 @@
+#pragma once
+#ifndef CONTROL_ROUTER_HPP
+#define CONTROL_ROUTER_HPP
+#include <ctype.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "data/utilities/string_view.hpp"
+
+/**
+ * @brief The control API's routes, <api_url>/<map>/command/<command>, in a
+ * table sorted by map and command
+ * @details A request is dispatched by splitting its path in place and two
+ * binary searches over the table - no regex and no allocation per request,
+ * and next to no stack on the async_tcp task. Built once after the routes
+ * are registered, not locked.
+ */
+template <typename Handler>
+class ControlRouter {
+ public:
+  struct Route_t {
+    std::string map;
+    std::string command;
+    Handler handler;
+  };
+
+  void clear() { routes.clear(); }
+  void add(const std::string& map,
+           const std::string& command,
+           Handler handler) {
+    routes.push_back({map, command, handler});
+  }
+  //! call once all routes are in, find() relies on the order
+  void sort() {
+    std::sort(routes.begin(), routes.end(),
+              [](const Route_t& a, const Route_t& b) {
+                int order = a.map.compare(b.map);
+                return order ? order < 0 : a.command < b.command;
+              });
+  }
+  size_t size() const { return routes.size(); }
+
+  /**
+   * @brief Splits <prefix>/<map>/command/<command> in place
+   * @return false if the path doesn't have that shape, or a segment has
+   * anything but letters and digits in it
+   */
+  static bool parsePath(Helpers::string_view path,
+                        Helpers::string_view prefix,
+                        Helpers::string_view* map,
+                        Helpers::string_view* command) {
+    static const Helpers::string_view COMMAND_SEGMENT("/command/");
+
+    if (path.size() <= prefix.size() + 1 ||
+        path.compare(0, prefix.size(), prefix) != 0 ||
+        path[prefix.size()] != '/')
+      return false;
+    path.remove_prefix(prefix.size() + 1);
+
+    size_t len = segmentLength(path);
+    if (!len)
+      return false;
+    *map = path.substr(0, len);
+    path.remove_prefix(len);
+
+    if (path.size() <= COMMAND_SEGMENT.size() ||
+        path.compare(0, COMMAND_SEGMENT.size(), COMMAND_SEGMENT) != 0)
+      return false;
+    path.remove_prefix(COMMAND_SEGMENT.size());
+
+    len = segmentLength(path);
+    if (!len || len != path.size())
+      return false;
+    *command = path;
+    return true;
+  }
+
+  //! nullptr if there's no such route, mapFound tells why
+  const Route_t* find(Helpers::string_view map,
+                      Helpers::string_view command,
+                      bool* mapFound) const {
+    auto byMap = [](const Route_t& route, Helpers::string_view map) {
+      return view(route.map) < map;
+    };
+    auto it = std::lower_bound(routes.begin(), routes.end(), map, byMap);
+    *mapFound = it != routes.end() && view(it->map) == map;
+
+    // the commands of a map sit next to each other, sorted
+    auto byCommand = [map](const Route_t& route,
+                           Helpers::string_view command) {
+      return view(route.map) == map && view(route.command) < command;
+    };
+    it = std::lower_bound(it, routes.end(), command, byCommand);
+    if (it == routes.end() || view(it->map) != map ||
+        view(it->command) != command)
+      return nullptr;
+    return &*it;
+  }
+
+ private:
+  static Helpers::string_view view(const std::string& value) {
+    return Helpers::string_view(value.data(), value.size());
+  }
+  //! letters and digits from the start on
+  static size_t segmentLength(Helpers::string_view rest) {
+    size_t len = 0;
+    while (len < rest.size() && isalnum((unsigned char)rest[len]))
+      len++;
+    return len;
+  }
+
+  std::vector<Route_t> routes;
+};
+
+#endif  // CONTROL_ROUTER_HPP
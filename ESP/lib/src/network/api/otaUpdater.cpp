@@ -0,0 +1,434 @@
+#include "otaUpdater.hpp"
+#include <Update.h>
+#include <algorithm>
+#include <esp_heap_caps.h>
+#include <rom/crc.h>
+#include "data/utilities/jsonWriter.hpp"
+
+// gzip header flags, RFC 1952
+#define GZIP_FHCRC 0x02
+#define GZIP_FEXTRA 0x04
+#define GZIP_FNAME 0x08
+#define GZIP_FCOMMENT 0x10
+
+static const char* stateNames[] = {"idle", "receiving", "done", "failed"};
+static const char* encodingNames[] = {"auto", "none", "gzip", "deflate"};
+
+OTAUpdater otaUpdater;
+
+OTAUpdater::OTAUpdater()
+    : state(OTA_IDLE),
+      encoding(ENCODING_AUTO),
+      bandwidthShare(50),
+      sha256(),
+      received(0),
+      written(0),
+      started_ms(0),
+      finished_ms(0),
+      inflator(nullptr),
+      window(nullptr),
+      windowOffset(0),
+      inflated(false),
+      gzip() {
+  mbedtls_md5_init(&md5Context);
+  mbedtls_sha256_init(&sha256Context);
+}
+
+bool OTAUpdater::begin(int command,
+                       Encoding_e encoding,
+                       const std::string& md5,
+                       const std::string& sha256) {
+  if (state == OTA_RECEIVING) {
+    log_w("[OTA]: Dropping the unfinished update at %u bytes", received);
+    this->abort();
+  }
+  this->release();
+
+  this->encoding = encoding;
+  this->error.clear();
+  this->sha256[0] = '\0';
+  received = 0;
+  written = 0;
+  started_ms = millis();
+  finished_ms = 0;
+  inflated = false;
+  windowOffset = 0;
+  gzip = {};
+  state = OTA_RECEIVING;
+
+  if (!md5.empty() && md5.size() != 32)
+    return this->fail("the MD5 has to be 32 hex digits");
+  if (!sha256.empty() && sha256.size() != 64)
+    return this->fail("the SHA-256 has to be 64 hex digits");
+  expectedMD5 = md5;
+  expectedSHA256 = sha256;
+  std::transform(expectedMD5.begin(), expectedMD5.end(), expectedMD5.begin(),
+                 ::tolower);
+  std::transform(expectedSHA256.begin(), expectedSHA256.end(),
+                 expectedSHA256.begin(), ::tolower);
+
+  // the size is only known once the image is inflated
+  if (!Update.begin(UPDATE_SIZE_UNKNOWN, command))
+    return this->fail(Update.errorString());
+
+  mbedtls_md5_starts_ret(&md5Context);
+  mbedtls_sha256_starts_ret(&sha256Context, 0);
+  log_i("[OTA]: Update started");
+  return true;
+}
+
+bool OTAUpdater::write(size_t offset, const uint8_t* data, size_t len) {
+  if (state != OTA_RECEIVING) {
+    // a failed session keeps its reason
+    if (state != OTA_FAILED)
+      error = "no update in progress";
+    return false;
+  }
+  if (offset > received) {
+    // not a failure, the client resumes from getOffset()
+    log_w("[OTA]: Got offset %u, expected %u", offset, received);
+    return false;
+  }
+  // a resent chunk, what we already have is skipped
+  size_t skip = received - offset;
+  if (skip >= len)
+    return true;
+  data += skip;
+  len -= skip;
+
+  if (encoding == ENCODING_AUTO && !this->detectEncoding(data, len))
+    return false;
+
+  mbedtls_md5_update_ret(&md5Context, data, len);
+  received += len;
+
+  switch (encoding) {
+    case ENCODING_GZIP: {
+      while (len) {
+        size_t used;
+        if (gzip.stage < GZIP_DEFLATE) {
+          used = this->parseGzipHeader(data, len);
+        } else if (gzip.stage == GZIP_DEFLATE) {
+          if (!this->inflate(data, len, &used))
+            return false;
+          if (inflated)
+            gzip.stage = GZIP_TRAILER;
+        } else if (gzip.stage == GZIP_TRAILER) {
+          used = this->parseGzipTrailer(data, len);
+        } else {
+          log_w("[OTA]: Ignoring %u bytes past the end of the gzip stream",
+                len);
+          used = len;
+        }
+        if (state != OTA_RECEIVING)
+          return false;
+        data += used;
+        len -= used;
+      }
+      return true;
+    }
+    case ENCODING_DEFLATE: {
+      size_t used;
+      if (!this->inflate(data, len, &used))
+        return false;
+      if (used < len)
+        log_w("[OTA]: Ignoring %u bytes past the end of the zlib stream",
+              len - used);
+      return true;
+    }
+    default:
+      return this->flash(data, len);
+  }
+}
+
+bool OTAUpdater::end() {
+  if (state != OTA_RECEIVING) {
+    // a failed session keeps its reason
+    if (state != OTA_FAILED)
+      error = "no update in progress";
+    return false;
+  }
+
+  if (encoding == ENCODING_GZIP) {
+    if (gzip.stage != GZIP_COMPLETE)
+      return this->fail("the gzip stream is truncated");
+    uint32_t crc = gzip.trailer[0] | gzip.trailer[1] << 8 |
+                   gzip.trailer[2] << 16 | (uint32_t)gzip.trailer[3] << 24;
+    uint32_t size = gzip.trailer[4] | gzip.trailer[5] << 8 |
+                    gzip.trailer[6] << 16 | (uint32_t)gzip.trailer[7] << 24;
+    if (crc != gzip.crc)
+      return this->fail("the gzip CRC-32 does not match");
+    // modulo 2^32, as the trailer has it
+    if (size != (uint32_t)written)
+      return this->fail("the gzip size does not match");
+  } else if (encoding == ENCODING_DEFLATE && !inflated) {
+    return this->fail("the zlib stream is truncated");
+  }
+
+  uint8_t digest[32];
+  char hex[65];
+  mbedtls_md5_finish_ret(&md5Context, digest);
+  toHex(digest, 16, hex);
+  if (!expectedMD5.empty() && expectedMD5 != hex)
+    return this->fail("the MD5 does not match");
+
+  mbedtls_sha256_finish_ret(&sha256Context, digest);
+  toHex(digest, 32, sha256);
+  if (!expectedSHA256.empty() && expectedSHA256 != sha256)
+    return this->fail("the SHA-256 does not match");
+
+  // true - the image is as long as what got written
+  if (!Update.end(true))
+    return this->fail(Update.errorString());
+
+  state = OTA_DONE;
+  finished_ms = millis();
+  this->release();
+  log_i("[OTA]: Update done, %u bytes received for a %u byte image in %u ms",
+        received, written, this->elapsed_ms());
+  return true;
+}
+
+void OTAUpdater::abort() {
+  if (state == OTA_RECEIVING)
+    Update.abort();
+  this->release();
+  state = OTA_IDLE;
+}
+
+void OTAUpdater::setBandwidthShare(uint8_t share) {
+  bandwidthShare = min(share, (uint8_t)OTA_MAX_BANDWIDTH_SHARE);
+}
+
+void OTAUpdater::writeJson(Print& out) const {
+  uint32_t elapsed = this->elapsed_ms();
+  out.printf(
+      "{\"state\": \"%s\", \"encoding\": \"%s\", \"received\": %u, "
+      "\"written\": %u, \"bytes_saved\": %u, \"elapsed_ms\": %u, "
+      "\"kbps\": %.1f, \"bandwidth_share\": %u, \"sha256\": \"%s\", "
+      "\"error\": ",
+      stateNames[state], encodingNames[encoding], received, written,
+      written > received ? written - received : 0, elapsed,
+      elapsed ? received * 8.0f / elapsed : 0.0f, bandwidthShare, sha256);
+  JsonWriter::writeString(out, error);
+  out.print("}");
+}
+
+bool OTAUpdater::encodingFromName(const char* name, Encoding_e* encoding) {
+  if (!name || !*name)
+    *encoding = ENCODING_AUTO;
+  else if (strcmp(name, "none") == 0 || strcmp(name, "identity") == 0)
+    *encoding = ENCODING_NONE;
+  else if (strcmp(name, "gzip") == 0)
+    *encoding = ENCODING_GZIP;
+  else if (strcmp(name, "deflate") == 0)
+    *encoding = ENCODING_DEFLATE;
+  else
+    return false;
+  return true;
+}
+
+//! an image starts with 0xE9, neither a gzip nor a zlib stream can
+bool OTAUpdater::detectEncoding(const uint8_t* data, size_t len) {
+  if (len < 2)
+    return this->fail("the upload is too short to tell its encoding");
+  if (data[0] == 0x1f && data[1] == 0x8b)
+    encoding = ENCODING_GZIP;
+  else if ((data[0] & 0x0f) == 8 && ((data[0] << 8) | data[1]) % 31 == 0)
+    encoding = ENCODING_DEFLATE;
+  else
+    encoding = ENCODING_NONE;
+  log_i("[OTA]: Upload encoding: %s", encodingNames[encoding]);
+  return true;
+}
+
+bool OTAUpdater::allocateInflator() {
+  inflator = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+  // the window is the big one, keep it out of internal RAM when we can
+  uint32_t caps = psramFound() ? MALLOC_CAP_SPIRAM : MALLOC_CAP_8BIT;
+  window = (uint8_t*)heap_caps_malloc(TINFL_LZ_DICT_SIZE, caps);
+  if (!inflator || !window)
+    return this->fail("not enough memory to inflate the upload");
+  tinfl_init(inflator);
+  return true;
+}
+
+void OTAUpdater::release() {
+  free(inflator);
+  inflator = nullptr;
+  free(window);
+  window = nullptr;
+}
+
+size_t OTAUpdater::parseGzipHeader(const uint8_t* data, size_t len) {
+  size_t used = 0;
+  while (used < len && gzip.stage < GZIP_DEFLATE) {
+    uint8_t byte = data[used++];
+    switch (gzip.stage) {
+      case GZIP_FIXED:
+        // the magic, then 8 for deflate - the only method there is
+        if ((gzip.pos == 0 && byte != 0x1f) ||
+            (gzip.pos == 1 && byte != 0x8b) || (gzip.pos == 2 && byte != 8)) {
+          this->fail("not a gzip stream");
+          return used;
+        }
+        if (gzip.pos == 3)
+          gzip.flags = byte;
+        if (++gzip.pos == 10)
+          this->nextGzipField();
+        break;
+      case GZIP_EXTRA_LEN:
+        gzip.left |= byte << (8 * gzip.pos);
+        if (++gzip.pos == 2) {
+          if (gzip.left)
+            gzip.stage = GZIP_EXTRA;
+          else
+            this->nextGzipField();
+        }
+        break;
+      case GZIP_EXTRA:
+        if (--gzip.left == 0)
+          this->nextGzipField();
+        break;
+      case GZIP_NAME:
+      case GZIP_COMMENT:
+        if (byte == 0)
+          this->nextGzipField();
+        break;
+      default:
+        if (++gzip.pos == 2)
+          this->nextGzipField();
+        break;
+    }
+  }
+  return used;
+}
+
+void OTAUpdater::nextGzipField() {
+  gzip.pos = 0;
+  gzip.left = 0;
+  if (gzip.stage < GZIP_EXTRA_LEN && (gzip.flags & GZIP_FEXTRA))
+    gzip.stage = GZIP_EXTRA_LEN;
+  else if (gzip.stage < GZIP_NAME && (gzip.flags & GZIP_FNAME))
+    gzip.stage = GZIP_NAME;
+  else if (gzip.stage < GZIP_COMMENT && (gzip.flags & GZIP_FCOMMENT))
+    gzip.stage = GZIP_COMMENT;
+  else if (gzip.stage < GZIP_HEADER_CRC && (gzip.flags & GZIP_FHCRC))
+    gzip.stage = GZIP_HEADER_CRC;
+  else
+    gzip.stage = GZIP_DEFLATE;
+}
+
+size_t OTAUpdater::parseGzipTrailer(const uint8_t* data, size_t len) {
+  size_t used = min(len, sizeof(gzip.trailer) - gzip.pos);
+  memcpy(gzip.trailer + gzip.pos, data, used);
+  gzip.pos += used;
+  if (gzip.pos == sizeof(gzip.trailer))
+    gzip.stage = GZIP_COMPLETE;
+  return used;
+}
+
+/**
+ * @brief Inflates into the window and flashes what comes out, until the
+ * input is used up or the stream ended
+ * @param used the input consumed, less than len only at the end of the stream
+ */
+bool OTAUpdater::inflate(const uint8_t* data, size_t len, size_t* used) {
+  *used = 0;
+  if (!inflator && !this->allocateInflator())
+    return false;
+
+  mz_uint32 flags = TINFL_FLAG_HAS_MORE_INPUT;
+  // checks the Adler-32 at the end as well
+  if (encoding == ENCODING_DEFLATE)
+    flags |= TINFL_FLAG_PARSE_ZLIB_HEADER;
+
+  while (!inflated) {
+    size_t in = len - *used;
+    size_t out = TINFL_LZ_DICT_SIZE - windowOffset;
+    tinfl_status status =
+        tinfl_decompress(inflator, data + *used, &in, window,
+                         window + windowOffset, &out, flags);
+    *used += in;
+    if (out && !this->flash(window + windowOffset, out))
+      return false;
+    windowOffset = (windowOffset + out) & (TINFL_LZ_DICT_SIZE - 1);
+
+    if (status == TINFL_STATUS_DONE)
+      inflated = true;
+    else if (status < TINFL_STATUS_DONE)
+      return this->fail(status == TINFL_STATUS_ADLER32_MISMATCH
+                            ? "the zlib Adler-32 does not match"
+                            : "the compressed stream is corrupt");
+    else if (status == TINFL_STATUS_NEEDS_MORE_INPUT)
+      break;
+    // TINFL_STATUS_HAS_MORE_OUTPUT - the window is full, go on
+  }
+  return true;
+}
+
+bool OTAUpdater::flash(const uint8_t* data, size_t len) {
+  mbedtls_sha256_update_ret(&sha256Context, data, len);
+  if (encoding == ENCODING_GZIP)
+    gzip.crc = crc32_le(gzip.crc, data, len);
+  if (Update.write(const_cast<uint8_t*>(data), len) != len)
+    return this->fail(Update.errorString());
+  written += len;
+  return true;
+}
+
+bool OTAUpdater::fail(const char* reason) {
+  log_e("[OTA]: Update failed at %u bytes: %s", received, reason);
+  error = reason;
+  if (Update.isRunning())
+    Update.abort();
+  this->release();
+  state = OTA_FAILED;
+  finished_ms = millis();
+  return false;
+}
+
+uint32_t OTAUpdater::elapsed_ms() const {
+  if (state == OTA_IDLE)
+    return 0;
+  return (state == OTA_RECEIVING ? millis() : finished_ms) - started_ms;
+}
+
+void OTAUpdater::toHex(const uint8_t* digest, size_t len, char* hex) {
+  for (size_t i = 0; i < len; i++)
+    sprintf(hex + 2 * i, "%02x", digest[i]);
+  hex[2 * len] = '\0';
+}
+
+OTAStreamThrottle::OTAStreamThrottle() : priority(0), throttled(false) {}
+
+OTAStreamThrottle::~OTAStreamThrottle() {
+  this->restore();
+}
+
+void OTAStreamThrottle::frameSent(int64_t busy_us) {
+  if (!otaUpdater.isReceiving()) {
+    this->restore();
+    return;
+  }
+  if (!throttled) {
+    priority = uxTaskPriorityGet(NULL);
+    vTaskPrioritySet(NULL, min(priority, (UBaseType_t)OTA_STREAM_PRIORITY));
+    throttled = true;
+  }
+
+  uint8_t share = otaUpdater.getBandwidthShare();
+  if (!share)
+    return;
+  // the stream gets (100 - share)% of the time, the pause is the rest
+  int64_t pause_ms = busy_us * share / (100 - share) / 1000;
+  vTaskDelay(pdMS_TO_TICKS(
+      constrain(pause_ms, (int64_t)1, (int64_t)OTA_MAX_STREAM_PAUSE_MS)));
+}
+
+void OTAStreamThrottle::restore() {
+  if (!throttled)
+    return;
+  vTaskPrioritySet(NULL, priority);
+  throttled = false;
+}
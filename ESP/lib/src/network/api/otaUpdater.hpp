@@ -0,0 +1,175 @@
+#pragma once
+#ifndef OTA_UPDATER_HPP
+#define OTA_UPDATER_HPP
+#include <Arduino.h>
+#include <mbedtls/md5.h>
+#include <mbedtls/sha256.h>
+#include <rom/miniz.h>
+#include <string>
+
+//! the most air time a download may take from a stream, it keeps running
+#define OTA_MAX_BANDWIDTH_SHARE 90
+//! longest pause a throttled stream takes between two frames
+#define OTA_MAX_STREAM_PAUSE_MS 200
+//! time for the last response before the restart into the new image
+#define OTA_SWITCH_OVER_DELAY_MS 1000
+//! what a streaming task drops to while an update downloads
+#define OTA_STREAM_PRIORITY (tskIDLE_PRIORITY + 1)
+
+/**
+ * @brief Firmware updates streamed into the update partition, plain or
+ * compressed, one session at a time
+ * @details Uploads may be gzip or zlib ("deflate") compressed, they get
+ * inflated on the fly with the decompressor in ROM into a 32 KB window and
+ * written out from there - the image never has to fit in RAM. A gzip
+ * stream is checked against its CRC-32 and size trailer, a zlib one against
+ * its Adler-32.
+ *
+ * Two optional checksums, both computed while the data streams through:
+ * - MD5 of the uploaded file, compressed or not - what the update page sends
+ * - SHA-256 of the image as written to flash, whatever the encoding
+ *
+ * The camera and the streams keep running while the image downloads,
+ * throttled by OTAStreamThrottle, they only stop for the switch-over once
+ * end() succeeded.
+ *
+ * The session outlives the connection: write() takes the offset of the data
+ * within the uploaded file, so after a dropped connection the client asks
+ * for getOffset() and goes on from there. Data it already sent is skipped.
+ */
+class OTAUpdater {
+ public:
+  enum State_e {
+    OTA_IDLE,
+    OTA_RECEIVING,
+    OTA_DONE,
+    OTA_FAILED,
+  };
+
+  enum Encoding_e {
+    //! picked from the first bytes of the upload
+    ENCODING_AUTO,
+    ENCODING_NONE,
+    ENCODING_GZIP,
+    //! HTTP "deflate", a zlib stream
+    ENCODING_DEFLATE,
+  };
+
+  OTAUpdater();
+  /**
+   * @brief Starts a new session, an unfinished one gets dropped
+   * @param command U_FLASH or U_SPIFFS
+   * @param md5 hex MD5 of the uploaded file, empty to skip the check
+   * @param sha256 hex SHA-256 of the image, empty to skip the check
+   */
+  bool begin(int command,
+             Encoding_e encoding,
+             const std::string& md5,
+             const std::string& sha256);
+  /**
+   * @param offset where the data sits in the uploaded file, at most
+   * getOffset()
+   * @return false on a gap, the session stays as it was, or when the
+   * session failed
+   */
+  bool write(size_t offset, const uint8_t* data, size_t len);
+  //! verifies the checksums and finishes the update partition
+  bool end();
+  void abort();
+
+  State_e getState() const { return state; }
+  bool isReceiving() const { return state == OTA_RECEIVING; }
+  //! @param share percent, up to OTA_MAX_BANDWIDTH_SHARE
+  void setBandwidthShare(uint8_t share);
+  uint8_t getBandwidthShare() const { return bandwidthShare; }
+  //! bytes of the uploaded file received so far
+  size_t getOffset() const { return received; }
+  const std::string& getError() const { return error; }
+  //! the session as JSON - progress, transfer time, bytes saved
+  void writeJson(Print& out) const;
+
+  static bool encodingFromName(const char* name, Encoding_e* encoding);
+
+ private:
+  //! the parts of a gzip stream, RFC 1952, the optional fields in order
+  enum GzipStage_e {
+    GZIP_FIXED,
+    GZIP_EXTRA_LEN,
+    GZIP_EXTRA,
+    GZIP_NAME,
+    GZIP_COMMENT,
+    GZIP_HEADER_CRC,
+    GZIP_DEFLATE,
+    GZIP_TRAILER,
+    GZIP_COMPLETE,
+  };
+
+  bool detectEncoding(const uint8_t* data, size_t len);
+  bool allocateInflator();
+  void release();
+  size_t parseGzipHeader(const uint8_t* data, size_t len);
+  void nextGzipField();
+  size_t parseGzipTrailer(const uint8_t* data, size_t len);
+  bool inflate(const uint8_t* data, size_t len, size_t* used);
+  bool flash(const uint8_t* data, size_t len);
+  bool fail(const char* reason);
+  uint32_t elapsed_ms() const;
+  static void toHex(const uint8_t* digest, size_t len, char* hex);
+
+  volatile State_e state;
+  Encoding_e encoding;
+  volatile uint8_t bandwidthShare;
+  std::string error;
+  std::string expectedMD5;
+  std::string expectedSHA256;
+  char sha256[65];
+
+  size_t received;
+  size_t written;
+  uint32_t started_ms;
+  uint32_t finished_ms;
+
+  mbedtls_md5_context md5Context;
+  mbedtls_sha256_context sha256Context;
+
+  tinfl_decompressor* inflator;
+  //! the inflate window, output is written to flash straight from it
+  uint8_t* window;
+  size_t windowOffset;
+  bool inflated;
+
+  struct {
+    GzipStage_e stage;
+    uint8_t flags;
+    size_t pos;
+    size_t left;
+    uint8_t trailer[8];
+    uint32_t crc;
+  } gzip;
+};
+
+extern OTAUpdater otaUpdater;
+
+/**
+ * @brief Makes room for a downloading update in a streaming task, one per
+ * task and stream
+ * @details While an update downloads the task runs at OTA_STREAM_PRIORITY
+ * and pauses after every frame, long enough that the download gets its
+ * share of the time the stream would otherwise spend sending. Afterwards,
+ * or when it goes out of scope, the task gets its priority back.
+ */
+class OTAStreamThrottle {
+ public:
+  OTAStreamThrottle();
+  ~OTAStreamThrottle();
+  //! @param busy_us how long capturing and sending the frame took
+  void frameSent(int64_t busy_us);
+
+ private:
+  void restore();
+
+  UBaseType_t priority;
+  bool throttled;
+};
+
+#endif  // OTA_UPDATER_HPP
@@ -0,0 +1,74 @@
+#include "snapshotResponse.hpp"
+#include "tasks/tasks.hpp"
+
+static const char* SNAPSHOT_FAILED = "{\"msg\":\"Could not take a snapshot\"}";
+
+SnapshotResponse::SnapshotResponse()
+    : AsyncAbstractResponse(),
+      pending(std::make_shared<Pending_t>()),
+      started(false),
+      offset(0) {
+  _code = 200;
+  _contentType = "image/jpeg";
+}
+
+bool SnapshotResponse::begin() {
+  std::shared_ptr<Pending_t> job = pending;
+  return OpenIrisTasks::Defer([job] {
+    job->taken = snapshotProvider.take(&job->frame);
+    job->done = true;
+  });
+}
+
+//! nothing goes out before the frame is there, see _ack
+void SnapshotResponse::_respond(AsyncWebServerRequest* request) {
+  this->_ack(request, 0, 0);
+}
+
+size_t SnapshotResponse::_ack(AsyncWebServerRequest* request,
+                              size_t len,
+                              uint32_t time) {
+  if (started)
+    return AsyncAbstractResponse::_ack(request, len, time);
+  if (!pending->done)
+    return 0;
+
+  started = true;
+  if (pending->taken) {
+    _contentLength = pending->frame.len;
+    this->addMetadataHeaders();
+  } else {
+    _code = 503;
+    _contentType = "application/json";
+    _contentLength = strlen(SNAPSHOT_FAILED);
+  }
+  AsyncAbstractResponse::_respond(request);
+  return 0;
+}
+
+size_t SnapshotResponse::_fillBuffer(uint8_t* buffer, size_t maxLen) {
+  const uint8_t* body = pending->taken ? pending->frame.jpeg
+                                       : (const uint8_t*)SNAPSHOT_FAILED;
+  size_t len = std::min(maxLen, _contentLength - offset);
+  memcpy(buffer, body + offset, len);
+  offset += len;
+  return len;
+}
+
+void SnapshotResponse::addMetadataHeaders() {
+  FrameMetadata_t& metadata = pending->frame.metadata;
+  char timestamp[32];
+  char headers[512];
+  SnapshotHeader_t fields[SNAPSHOT_MAX_HEADERS];
+  snprintf(timestamp, sizeof(timestamp), "%lld.%06lld",
+           metadata.captured_us / 1000000, metadata.captured_us % 1000000);
+  FrameMetadata::markSent(metadata);
+  FrameMetadata::formatHeaders(metadata, headers, sizeof(headers));
+  size_t count =
+      SnapshotProvider::splitHeaders(headers, fields, SNAPSHOT_MAX_HEADERS);
+
+  this->addHeader("Content-Disposition", "inline; filename=snapshot.jpg");
+  this->addHeader("X-Timestamp", timestamp);
+  for (size_t i = 0; i < count; i++)
+    this->addHeader(fields[i].name, fields[i].value);
+}
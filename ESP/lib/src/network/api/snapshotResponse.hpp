@@ -0,0 +1,50 @@
+#pragma once
+#ifndef SNAPSHOT_RESPONSE_HPP
+#define SNAPSHOT_RESPONSE_HPP
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <atomic>
+#include <memory>
+#include "io/camera/snapshot.hpp"
+
+/**
+ * @brief GET /snapshot, answered once the frame is there instead of holding
+ * up the server for it
+ * @details SnapshotProvider::take() waits up to SNAPSHOT_WAIT_MS for a frame
+ * of the running stream, or for a whole capture when nothing streams - far
+ * too long for the async_tcp task every other request and SSE client is
+ * served from. take() runs on the deferred worker instead. The response
+ * holds back its status line and headers, the frame metadata goes into
+ * them, and the server polls it meanwhile - AsyncTCP does so every 500 ms -
+ * until the frame arrived, then it goes out like any other response.
+ */
+class SnapshotResponse : public AsyncAbstractResponse {
+ public:
+  SnapshotResponse();
+  //! false if the worker could not take the job, answer with a 503 then
+  bool begin();
+
+  void _respond(AsyncWebServerRequest* request) override;
+  size_t _ack(AsyncWebServerRequest* request,
+              size_t len,
+              uint32_t time) override;
+  bool _sourceValid() const override { return true; }
+  size_t _fillBuffer(uint8_t* buffer, size_t maxLen) override;
+
+ private:
+  //! shared with the worker, outlives a client that went away meanwhile
+  struct Pending_t {
+    ~Pending_t() { SnapshotProvider::release(frame); }
+    std::atomic<bool> done{false};
+    bool taken = false;
+    Snapshot_t frame = {};
+  };
+
+  void addMetadataHeaders();
+
+  std::shared_ptr<Pending_t> pending;
+  bool started;
+  size_t offset;
+};
+
+#endif  // SNAPSHOT_RESPONSE_HPP
@@ -0,0 +1,117 @@
+#include "telemetryEvents.hpp"
+// pulls in ESPAsyncWebServer the way it has to be included, see baseAPI.hpp
+#include "network/api/baseAPI/baseAPI.hpp"
+
+//! browsers reconnect after that long when the connection drops
+#define TELEMETRY_RECONNECT_MS 2000
+
+TelemetryEvents telemetryEvents;
+
+TelemetryEvents::TelemetryEvents()
+    : events(nullptr),
+      taskHandle(nullptr),
+      interval_ms(TELEMETRY_INTERVAL_MS),
+      eventId(0),
+      stateEvents(0),
+      telemetrySamples(0),
+      skippedSamples(0) {}
+
+void TelemetryEvents::begin(AsyncWebServer& server) {
+  if (events)
+    return;
+
+  events = new AsyncEventSource("/events");
+  // runs on the web server task, answers the new subscriber only
+  events->onConnect([this](AsyncEventSourceClient* client) {
+    this->sendStates(readStates(), client);
+  });
+  server.addHandler(events);
+
+  // next to the network stack, out of the way of the camera
+  if (xTaskCreatePinnedToCore(&TelemetryEvents::eventTask, "TelemetryEvents",
+                              4096, this, 1, &taskHandle, 0) != pdPASS) {
+    log_e("[TelemetryEvents]: Could not start the events task");
+    taskHandle = nullptr;
+  }
+}
+
+void TelemetryEvents::setInterval(uint32_t interval_ms) {
+  this->interval_ms = max(interval_ms, (uint32_t)TELEMETRY_MIN_INTERVAL_MS);
+}
+
+void TelemetryEvents::writeJson(Print& out) {
+  out.printf(
+      "\"events\": {\"subscribers\": %u, \"interval_ms\": %u, "
+      "\"state_events\": %u, \"telemetry_samples\": %u, "
+      "\"skipped_samples\": %u}",
+      events ? (unsigned)events->count() : 0u, interval_ms, stateEvents,
+      telemetrySamples, skippedSamples);
+}
+
+void TelemetryEvents::eventTask(void* pvParameters) {
+  TelemetryEvents* self = static_cast<TelemetryEvents*>(pvParameters);
+  States_t last = readStates();
+  TickType_t lastSample = xTaskGetTickCount();
+
+  while (true) {
+    vTaskDelay(pdMS_TO_TICKS(TELEMETRY_STATE_POLL_MS));
+    bool subscribed = self->events->count() > 0;
+
+    States_t states = readStates();
+    if (states.wifi != last.wifi || states.camera != last.camera ||
+        states.led != last.led) {
+      last = states;
+      if (subscribed)
+        self->sendStates(states, nullptr);
+    }
+
+    if (!subscribed ||
+        xTaskGetTickCount() - lastSample < pdMS_TO_TICKS(self->interval_ms))
+      continue;
+    lastSample = xTaskGetTickCount();
+    if (self->events->avgPacketsWaiting() > TELEMETRY_MAX_BACKLOG)
+      self->skippedSamples++;
+    else
+      self->sendTelemetry();
+  }
+}
+
+TelemetryEvents::States_t TelemetryEvents::readStates() {
+  return {
+      static_cast<int>(wifiStateManager.getCurrentState()),
+      static_cast<int>(cameraStateManager.getCurrentState()),
+      static_cast<int>(ledStateManager.getCurrentState()),
+  };
+}
+
+void TelemetryEvents::sendStates(const States_t& states,
+                                 AsyncEventSourceClient* client) {
+  char json[64];
+  snprintf(json, sizeof(json), "{\"wifi\": %d, \"camera\": %d, \"led\": %d}",
+           states.wifi, states.camera, states.led);
+  if (client) {
+    client->send(json, "state", this->nextId(), TELEMETRY_RECONNECT_MS);
+  } else {
+    events->send(json, "state", this->nextId());
+    stateEvents++;
+  }
+}
+
+void TelemetryEvents::sendTelemetry() {
+  char json[256];
+  snprintf(json, sizeof(json),
+           "{\"fps\": {\"serial\": %.1f, \"mjpeg\": %.1f, \"pupil\": %.1f}, "
+           "\"rssi\": %d, \"heap_free\": %u, \"heap_min_free\": %u, "
+           "\"psram_free\": %u, \"uptime_ms\": %llu}",
+           metrics.getFps(TRANSPORT_SERIAL), metrics.getFps(TRANSPORT_MJPEG),
+           metrics.getFps(TRANSPORT_PUPIL), linkQuality.getRSSI(),
+           ESP.getFreeHeap(), ESP.getMinFreeHeap(), ESP.getFreePsram(),
+           (unsigned long long)(esp_timer_get_time() / 1000));
+  events->send(json, "telemetry", this->nextId());
+  telemetrySamples++;
+}
+
+//! the web server task numbers the events of new subscribers too
+uint32_t TelemetryEvents::nextId() {
+  return __atomic_add_fetch(&eventId, 1, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,69 @@
+#pragma once
+#ifndef TELEMETRY_EVENTS_HPP
+#define TELEMETRY_EVENTS_HPP
+#include <Arduino.h>
+#include <string>
+
+//! how often the state managers get checked for transitions
+#define TELEMETRY_STATE_POLL_MS 100
+//! time between two fps / RSSI / heap samples, changeable at runtime
+#ifndef TELEMETRY_INTERVAL_MS
+#define TELEMETRY_INTERVAL_MS 2000
+#endif
+#define TELEMETRY_MIN_INTERVAL_MS 250
+//! messages the subscribers may have queued on average before samples get
+//! skipped, the library drops anything past SSE_MAX_QUEUED_MESSAGES
+#define TELEMETRY_MAX_BACKLOG 2
+
+class AsyncWebServer;
+class AsyncEventSource;
+class AsyncEventSourceClient;
+
+/**
+ * @brief Server-Sent Events on /events of the API server, so dashboards
+ * subscribe once instead of polling over fresh connections
+ * @details Two event types, both with a JSON payload:
+ * - "state": the Wi-Fi, camera and LED states, on connect and whenever one
+ *   of them changes. Transitions within TELEMETRY_STATE_POLL_MS of each
+ *   other arrive as one event.
+ * - "telemetry": fps per transport, smoothed RSSI, free heap and PSRAM,
+ *   every interval.
+ *
+ * A subscriber that can't keep up never queues more than
+ * SSE_MAX_QUEUED_MESSAGES events, and telemetry samples are skipped while
+ * the subscribers lag behind - the next one supersedes them anyway. Nothing
+ * gets formatted while nobody is subscribed.
+ */
+class TelemetryEvents {
+ public:
+  TelemetryEvents();
+  void begin(AsyncWebServer& server);
+  void setInterval(uint32_t interval_ms);
+  uint32_t getInterval() const { return interval_ms; }
+  void writeJson(Print& out);
+
+ private:
+  struct States_t {
+    int wifi;
+    int camera;
+    int led;
+  };
+
+  static void eventTask(void* pvParameters);
+  static States_t readStates();
+  void sendStates(const States_t& states, AsyncEventSourceClient* client);
+  void sendTelemetry();
+  uint32_t nextId();
+
+  AsyncEventSource* events;
+  TaskHandle_t taskHandle;
+  volatile uint32_t interval_ms;
+  uint32_t eventId;
+  uint32_t stateEvents;
+  uint32_t telemetrySamples;
+  uint32_t skippedSamples;
+};
+
+extern TelemetryEvents telemetryEvents;
+
+#endif  // TELEMETRY_EVENTS_HPP
@@ -21,16 +21,14 @@ APIServer::~APIServer() {}
 void APIServer::setup() {
   log_d("Initializing REST API Server");
   this->setupServer();
+  this->buildRouteTable();
   BaseAPI::begin();
 
-  char buffer[1000];
-  snprintf(buffer, sizeof(buffer),
-           "^\\%s\\/([a-zA-Z0-9]+)\\/command\\/([a-zA-Z0-9]+)$",
-           this->api_url.c_str());
-  log_d("API URL: %s", buffer);
-  server.on(buffer, 0b01111111, [&](AsyncWebServerRequest* request) {
-      handleRequest(request);
-  });
+  // matches the API url and everything below it, handleRequest takes the
+  // path apart
+  log_d("API URL: %s", this->api_url.c_str());
+  server.on(this->api_url.c_str(), 0b01111111,
+            [&](AsyncWebServerRequest* request) { handleRequest(request); });
 #ifndef SIM_ENABLED
     //this->_authRequired = true;
 #endif  // SIM_ENABLED
@@ -45,14 +43,27 @@ void APIServer::setupServer() {
   routes.emplace("rebootDevice", &APIServer::rebootDevice);
   routes.emplace("getStoredConfig", &APIServer::getJsonConfig);
   routes.emplace("setTxPower", &APIServer::setWiFiTXPower);
+  routes.emplace("setRadioProfile", &APIServer::setRadioProfile);
+  routes.emplace("radioSelfTest", &APIServer::radioSelfTest);
   // Camera Routes
 #ifndef SIM_ENABLED
   routes.emplace("setCamera", &APIServer::setCamera);
   routes.emplace("restartCamera", &APIServer::restartCamera);
+  routes.emplace("setFrameBuffers", &APIServer::setFrameBuffers);
+  routes.emplace("frameLatency", &APIServer::frameLatency);
+  routes.emplace("frameStats", &APIServer::frameStats);
+  routes.emplace("frameThumbnail", &APIServer::frameThumbnail);
+  routes.emplace("setPupil", &APIServer::setPupilTracker);
+  routes.emplace("setFrameSuppression", &APIServer::setFrameSuppression);
+  routes.emplace("frameSuppression", &APIServer::frameSuppressionStats);
 #endif  // SIM_ENABLED
   routes.emplace("ping", &APIServer::ping);
   routes.emplace("save", &APIServer::save);
   routes.emplace("wifiStrength", &APIServer::rssi);
+  routes.emplace("trace", &APIServer::trace);
+  routes.emplace("memory", &APIServer::memory);
+  routes.emplace("log", &APIServer::getLog);
+  routes.emplace("events", &APIServer::eventsConfig);
 
   //! reserve enough memory for all routes - must be called after adding routes
   //! and before adding routes to route_map
@@ -84,29 +95,46 @@ void APIServer::addRouteMap(const std::string& index,
   }
 }
 
+/**
+ * @brief Flattens the route maps into the router, so a request is dispatched
+ * with a binary search over the path segments
+ */
+void APIServer::buildRouteTable() {
+  router.clear();
+  for (const auto& map : route_map)
+    for (const auto& route : map.second)
+      router.add(map.first, route.first, route.second);
+  router.sort();
+}
+
 void APIServer::handleRequest(AsyncWebServerRequest* request) {
+  TRACE_SCOPE("api_request");
+  MEMORY_SCOPE(MEMORY_MODULE_API);
+  metrics.count(METRIC_API_REQUESTS);
   try {
-    // Get the route
-    log_i("Request URL: %s", request->url().c_str());
-    log_i("Request: %s", request->pathArg(0).c_str());
-    log_i("Request: %s", request->pathArg(1).c_str());
+    const String& url = request->url();
+    BLOG_I(LOG_MODULE_API, "Request URL: %s", url);
 
-    auto it_map = route_map.find(request->pathArg(0).c_str());
-    auto it_method = it_map->second.find(request->pathArg(1).c_str());
+    Helpers::string_view map;
+    Helpers::string_view command;
+    if (!router.parsePath(Helpers::string_view(url.c_str(), url.length()),
+                          Helpers::string_view(api_url.data(), api_url.size()),
+                          &map, &command)) {
+      notFound(request);
+      return;
+    }
 
-    if (it_map != route_map.end()) {
-      if (it_method != it_map->second.end()) {
-        log_d("We are trying to execute the function");
-        (*this.*(it_method->second))(request);
-      } else {
-        log_e("Invalid Command");
-        request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Command\"}");
-        return;
-      }
+    bool mapFound = false;
+    const auto* route = router.find(map, command, &mapFound);
+    if (route) {
+      log_d("We are trying to execute the function");
+      (*this.*(route->handler))(request);
+    } else if (mapFound) {
+      log_e("Invalid Command");
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Command\"}");
     } else {
       log_e("Invalid Map Index");
       request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Map Index\"}");
-      return;
     }
   } catch (...) {
     log_e("Error handling request");
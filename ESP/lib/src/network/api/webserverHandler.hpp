@@ -2,7 +2,9 @@
 #ifndef XWEBSERVERHANDLER_HPP
 #define XWEBSERVERHANDLER_HPP
 
+#include <algorithm>
 #include "network/api/baseAPI/baseAPI.hpp"
+#include "network/api/controlRouter.hpp"
 
 class APIServer : public BaseAPI {
  public:
@@ -22,5 +24,10 @@ class APIServer : public BaseAPI {
 
  public:
   std::vector<std::string> indexes;
+
+ private:
+  void buildRouteTable();
+
+  ControlRouter<route_method> router;
 };
 #endif  // WEBSERVERHANDLER_HPP
@@ -2,20 +2,27 @@
 
 constexpr static const char *STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
 constexpr static const char *STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
-constexpr static const char *STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\n\r\n";
+constexpr static const char *STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\n";
+constexpr static const char *STREAM_UNCHANGED_PART = "Content-Type: application/x-frame-unchanged\r\nContent-Length: 0\r\nX-Timestamp: %d.%06d\r\nX-Reference-Sequence: %u\r\n";
 
 esp_err_t StreamHelpers::stream(httpd_req_t *req)
 {
+    MEMORY_SCOPE(MEMORY_MODULE_STREAM);
     long last_request_time = 0;
     camera_fb_t *fb = NULL;
     struct timeval _timestamp;
+    FrameMetadata_t metadata;
+    FrameStats_t stats;
+    FrameChangeDetector changeDetector;
+    OTAStreamThrottle otaThrottle;
+    bool unchanged = false;
 
     esp_err_t res = ESP_OK;
 
     size_t _jpg_buf_len = 0;
     uint8_t *_jpg_buf = NULL;
 
-    char *part_buf[256];
+    char part_buf[512];
 
     static int64_t last_frame = 0;
     if (!last_frame)
@@ -28,30 +35,120 @@ esp_err_t StreamHelpers::stream(httpd_req_t *req)
     httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
     httpd_resp_set_hdr(req, "X-Framerate", "60");
 
+    // the server can come up before the camera finished initializing
+    if (!bootSequence.waitFor(BOOT_CAMERA, pdMS_TO_TICKS(CAMERA_INIT_WAIT_MS)))
+    {
+        log_e("Camera is not ready, closing the stream");
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
     while (true)
     {
-        fb = esp_camera_fb_get();
+        size_t sent_len = 0;
+        // a frame came off the camera, counted as dropped unless it is sent
+        bool captured = false;
+        // the camera is being reinitialized, keep the connection and wait
+        if (!cameraGate.enter())
+        {
+            if (cameraGate.hasFailed())
+            {
+                log_e("Camera is gone, closing the stream");
+                res = ESP_FAIL;
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(CAMERA_GATE_RETRY_MS));
+            continue;
+        }
+        int64_t frame_start = esp_timer_get_time();
+        {
+            TRACE_SCOPE("capture");
+            int64_t capture_start = esp_timer_get_time();
+            fb = esp_camera_fb_get();
+            metrics.observeCapture(esp_timer_get_time() - capture_start);
+        }
         if (!fb)
         {
             log_e("Camera capture failed with response: %s", esp_err_to_name(res));
+            metrics.count(METRIC_CAMERA_CAPTURE_ERRORS);
             res = ESP_FAIL;
         }
         else
         {
+            captured = true;
             _timestamp.tv_sec = fb->timestamp.tv_sec;
             _timestamp.tv_usec = fb->timestamp.tv_usec;
             _jpg_buf_len = fb->len;
             _jpg_buf = fb->buf;
+            metadata = FrameMetadata::fromFrame(fb);
+            stats.valid = false;
+            if (frameStatsProvider.process(fb, &stats))
+                FrameMetadata::attachStats(metadata, stats);
+            unchanged = changeDetector.isUnchanged(fb, metadata.sequence, &stats);
+            // the pupil tracker switches the sensor to grayscale, encode those
+            // frames here so the stream keeps working as a preview
+            if (fb->format != PIXFORMAT_JPEG)
+            {
+                bool jpeg_converted;
+                {
+                    TRACE_SCOPE("encode");
+                    jpeg_converted = frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
+                }
+                esp_camera_fb_return(fb);
+                fb = NULL;
+                if (!jpeg_converted)
+                {
+                    log_e("JPEG compression failed");
+                    // frame2jpg leaves it on the frame buffer just returned,
+                    // it is not ours to free
+                    _jpg_buf = NULL;
+                    _jpg_buf_len = 0;
+                    res = ESP_FAIL;
+                }
+            }
+            if (res == ESP_OK)
+                snapshotProvider.offer(_jpg_buf, _jpg_buf_len, metadata);
         }
-        if (res == ESP_OK)
-            res = httpd_resp_send_chunk(req, STREAM_BOUNDARY, strlen(STREAM_BOUNDARY));
-        if (res == ESP_OK)
         {
-            size_t hlen = snprintf((char *)part_buf, 128, STREAM_PART, _jpg_buf_len, _timestamp.tv_sec, _timestamp.tv_usec);
-            res = httpd_resp_send_chunk(req, (const char *)part_buf, hlen);
+            TRACE_SCOPE("mjpeg_send");
+            if (res == ESP_OK)
+                res = httpd_resp_send_chunk(req, STREAM_BOUNDARY, strlen(STREAM_BOUNDARY));
+            if (res == ESP_OK)
+            {
+                FrameMetadata::markSent(metadata);
+                size_t hlen;
+                // near-duplicate frames only get their headers sent, clients keep
+                // showing the frame with the reference sequence
+                if (unchanged)
+                    hlen = snprintf(part_buf, sizeof(part_buf), STREAM_UNCHANGED_PART, _timestamp.tv_sec, _timestamp.tv_usec, changeDetector.getReferenceSequence());
+                else
+                    hlen = snprintf(part_buf, sizeof(part_buf), STREAM_PART, _jpg_buf_len, _timestamp.tv_sec, _timestamp.tv_usec);
+                hlen += FrameMetadata::formatHeaders(metadata, part_buf + hlen, sizeof(part_buf) - hlen);
+                hlen += snprintf(part_buf + hlen, sizeof(part_buf) - hlen, "\r\n");
+                res = httpd_resp_send_chunk(req, part_buf, hlen);
+                sent_len = strlen(STREAM_BOUNDARY) + hlen;
+                if (unchanged)
+                    frameSuppression.countSuppressed(_jpg_buf_len, sent_len);
+                else
+                {
+                    sent_len += _jpg_buf_len;
+                    frameSuppression.countSent(sent_len);
+                }
+            }
+            if (res == ESP_OK && !unchanged)
+            {
+                res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
+                if (res == ESP_OK)
+                    bootSequence.recordFirstFrame(TRANSPORT_MJPEG);
+            }
         }
         if (res == ESP_OK)
-            res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
+        {
+            frameLatencyTracker.record(_timestamp);
+            metrics.frameSent(TRANSPORT_MJPEG, sent_len, _timestamp);
+        }
+        else if (captured)
+            metrics.frameDropped(TRANSPORT_MJPEG);
         if (fb)
         {
             esp_camera_fb_return(fb);
@@ -63,17 +160,57 @@ esp_err_t StreamHelpers::stream(httpd_req_t *req)
             free(_jpg_buf);
             _jpg_buf = NULL;
         }
+        cameraGate.leave();
         if (res != ESP_OK)
             break;
+        // the new image is in, the stream ends for the switch-over
+        if (otaUpdater.getState() == OTAUpdater::OTA_DONE)
+            break;
+        // a downloading update gets its share of the air time
+        otaThrottle.frameSent(esp_timer_get_time() - frame_start);
         long request_end = millis();
         long latency = (request_end - last_request_time);
         last_request_time = request_end;
-        log_d("Size: %uKB, Time: %ums (%ifps)\n", _jpg_buf_len / 1024, latency, 1000 / latency);
+        BLOG_D(LOG_MODULE_STREAM, "Size: %uKB, Time: %ums (%ifps)", _jpg_buf_len / 1024, latency, latency ? 1000 / latency : 0);
     }
     last_frame = 0;
     return res;
 }
 
+/**
+ * @brief A single JPEG with the frame metadata as headers
+ * @note esp_http_server runs one handler at a time, while a client streams
+ * from this server the request waits - the API server answers /snapshot too
+ */
+esp_err_t StreamHelpers::snapshot(httpd_req_t *req)
+{
+    Snapshot_t snapshot;
+    if (!snapshotProvider.take(&snapshot))
+    {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    // the header values have to stay around until the response went out
+    char timestamp[32];
+    char headers[512];
+    SnapshotHeader_t fields[SNAPSHOT_MAX_HEADERS];
+    snprintf(timestamp, sizeof(timestamp), "%lld.%06lld", snapshot.metadata.captured_us / 1000000, snapshot.metadata.captured_us % 1000000);
+    FrameMetadata::markSent(snapshot.metadata);
+    FrameMetadata::formatHeaders(snapshot.metadata, headers, sizeof(headers));
+    size_t count = SnapshotProvider::splitHeaders(headers, fields, SNAPSHOT_MAX_HEADERS);
+
+    httpd_resp_set_type(req, "image/jpeg");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_set_hdr(req, "Content-Disposition", "inline; filename=snapshot.jpg");
+    httpd_resp_set_hdr(req, "X-Timestamp", timestamp);
+    for (size_t i = 0; i < count; i++)
+        httpd_resp_set_hdr(req, fields[i].name, fields[i].value);
+    esp_err_t res = httpd_resp_send(req, (const char *)snapshot.jpeg, snapshot.len);
+    SnapshotProvider::release(snapshot);
+    return res;
+}
+
 StreamServer::StreamServer(const int STREAM_PORT) : STREAM_SERVER_PORT(STREAM_PORT) {}
 
 int StreamServer::startStreamServer()
@@ -81,7 +218,9 @@ int StreamServer::startStreamServer()
     // WRITE_PERI_REG(RTC_CNTL_BROWN_OUT_REG, 0); //! Turn-off the 'brownout detector'
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.stack_size = 20480;
-    config.max_uri_handlers = 1;
+    config.max_uri_handlers = 2;
+    // the snapshot carries the frame metadata as headers
+    config.max_resp_headers = 16;
     config.server_port = this->STREAM_SERVER_PORT;
     config.ctrl_port = this->STREAM_SERVER_PORT;
     config.stack_size = 20480;
@@ -92,6 +231,12 @@ int StreamServer::startStreamServer()
         .handler = &StreamHelpers::stream,
         .user_ctx = nullptr};
 
+    httpd_uri_t snapshot_page = {
+        .uri = "/snapshot",
+        .method = HTTP_GET,
+        .handler = &StreamHelpers::snapshot,
+        .user_ctx = nullptr};
+
     int status = httpd_start(&camera_stream, &config);
 
     if (status != ESP_OK)
@@ -99,6 +244,7 @@ int StreamServer::startStreamServer()
     else
     {
         httpd_register_uri_handler(camera_stream, &stream_page);
+        httpd_register_uri_handler(camera_stream, &snapshot_page);
         Serial.println("Stream server initialized");
         switch (wifiStateManager.getCurrentState())
         {
@@ -5,6 +5,18 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include "data/StateManager/StateManager.hpp"
+#include "data/utilities/binaryLog.hpp"
+#include "data/utilities/memoryTelemetry.hpp"
+#include "data/utilities/metrics.hpp"
+#include "data/utilities/traceProfiler.hpp"
+#include "io/camera/cameraGate.hpp"
+#include "io/camera/cameraHandler.hpp"
+#include "io/camera/frameMetadata.hpp"
+#include "io/camera/frameSuppression.hpp"
+#include "io/camera/latencyTracker.hpp"
+#include "io/camera/snapshot.hpp"
+#include "network/api/otaUpdater.hpp"
+#include "tasks/bootSequence.hpp"
 
 // Camera includes
 #include "esp_camera.h"
@@ -16,6 +28,7 @@
 namespace StreamHelpers
 {
 	esp_err_t stream(httpd_req_t *req);
+	esp_err_t snapshot(httpd_req_t *req);
 }
 class StreamServer
 {
@@ -0,0 +1,131 @@
+#include "linkQuality.hpp"
+#include <lwip/stats.h>
+
+LinkQuality linkQuality;
+
+LinkQuality::LinkQuality()
+    : lock(portMUX_INITIALIZER_UNLOCKED),
+      timer(nullptr),
+      stats(),
+      rssi_avg_fixed(0),
+      bssid() {}
+
+void LinkQuality::begin() {
+  if (timer)
+    return;
+
+  esp_timer_create_args_t args = {
+      .callback = &LinkQuality::sampleCallback,
+      .arg = this,
+      .dispatch_method = ESP_TIMER_TASK,
+      .name = "LinkQuality",
+      .skip_unhandled_events = true,
+  };
+  if (esp_timer_create(&args, &timer) != ESP_OK ||
+      esp_timer_start_periodic(timer,
+                               LINK_QUALITY_SAMPLE_INTERVAL_MS * 1000) !=
+          ESP_OK) {
+    log_e("[LinkQuality]: Could not start the sampler");
+    return;
+  }
+  log_i("[LinkQuality]: Sampling the link every %d ms",
+        LINK_QUALITY_SAMPLE_INTERVAL_MS);
+}
+
+void LinkQuality::sampleCallback(void* arg) {
+  static_cast<LinkQuality*>(arg)->sample();
+}
+
+void LinkQuality::sample() {
+  wifi_ap_record_t ap;
+  if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) {
+    portENTER_CRITICAL(&lock);
+    stats.connected = false;
+    portEXIT_CRITICAL(&lock);
+    return;
+  }
+
+  wifi_bandwidth_t bandwidth = WIFI_BW_HT20;
+  esp_wifi_get_bandwidth(WIFI_IF_STA, &bandwidth);
+  bool ht40 = ap.phy_11n && ap.second != WIFI_SECOND_CHAN_NONE &&
+              bandwidth == WIFI_BW_HT40;
+  char phy_mode = ap.phy_11n ? 'n' : (ap.phy_11g ? 'g' : 'b');
+  // single spatial stream, short guard interval
+  float phy_rate = phy_mode == 'n' ? (ht40 ? 150.0f : 72.2f)
+                                   : (phy_mode == 'g' ? 54.0f : 11.0f);
+
+  portENTER_CRITICAL(&lock);
+  // min, max and the average only make sense for a single access point
+  if (!stats.connected || memcmp(bssid, ap.bssid, sizeof(bssid)) != 0) {
+    memcpy(bssid, ap.bssid, sizeof(bssid));
+    stats.samples = 0;
+  }
+  if (!stats.samples) {
+    stats.rssi_min = ap.rssi;
+    stats.rssi_max = ap.rssi;
+    rssi_avg_fixed = (int32_t)ap.rssi * 256;
+  }
+  rssi_avg_fixed +=
+      ((int32_t)ap.rssi * 256 - rssi_avg_fixed) >> LINK_QUALITY_EWMA_SHIFT;
+  if (ap.rssi < stats.rssi_min)
+    stats.rssi_min = ap.rssi;
+  if (ap.rssi > stats.rssi_max)
+    stats.rssi_max = ap.rssi;
+  stats.connected = true;
+  stats.samples++;
+  stats.rssi_last = ap.rssi;
+  stats.rssi_avg = rssi_avg_fixed / 256.0f;
+  stats.channel = ap.primary;
+  stats.phy_mode = phy_mode;
+  stats.ht40 = ht40;
+  stats.phy_rate_mbps = phy_rate;
+#if LWIP_STATS && TCP_STATS
+  stats.tcp_retransmits = lwip_stats.tcp.rexmit;
+#endif
+#if LWIP_STATS && LINK_STATS
+  stats.link_drops = lwip_stats.link.drop;
+#endif
+  portEXIT_CRITICAL(&lock);
+}
+
+/**
+ * @brief Starts over the min, max and average, e.g. after a reconnect
+ */
+void LinkQuality::reset() {
+  portENTER_CRITICAL(&lock);
+  stats.samples = 0;
+  portEXIT_CRITICAL(&lock);
+}
+
+LinkQuality::LinkStats_t LinkQuality::getStats() {
+  portENTER_CRITICAL(&lock);
+  LinkStats_t current = stats;
+  portEXIT_CRITICAL(&lock);
+  return current;
+}
+
+int LinkQuality::getRSSI() {
+  LinkStats_t current = this->getStats();
+  if (!current.connected || !current.samples)
+    return 0;
+  return lroundf(current.rssi_avg);
+}
+
+void LinkQuality::writeJson(Print& out) {
+  LinkStats_t current = this->getStats();
+  if (!current.connected || !current.samples) {
+    out.print("\"link_quality\": {\"connected\": false}");
+    return;
+  }
+
+  out.printf(
+      "\"link_quality\": {\"connected\": true, \"samples\": %u, "
+      "\"rssi_avg\": %.1f, \"rssi_last\": %d, \"rssi_min\": %d, "
+      "\"rssi_max\": %d, \"channel\": %u, \"phy_mode\": \"11%c\", "
+      "\"bandwidth\": \"%s\", \"phy_rate_mbps\": %.1f, "
+      "\"tcp_retransmits\": %u, \"link_drops\": %u}",
+      current.samples, current.rssi_avg, current.rssi_last, current.rssi_min,
+      current.rssi_max, current.channel, current.phy_mode,
+      current.ht40 ? "HT40" : "HT20", current.phy_rate_mbps,
+      current.tcp_retransmits, current.link_drops);
+}
@@ -0,0 +1,64 @@
+#pragma once
+#ifndef LINK_QUALITY_HPP
+#define LINK_QUALITY_HPP
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <esp_wifi.h>
+#include <string>
+
+#define LINK_QUALITY_SAMPLE_INTERVAL_MS 200
+//! weight of a new sample in the moving average, as a power of two (1/8)
+#define LINK_QUALITY_EWMA_SHIFT 3
+
+/**
+ * @brief Samples the station link in the background, so anything that needs
+ * the signal quality (the API, roaming, adaptive quality) reads it instantly
+ * @details Runs off an esp_timer, every sample is a single
+ * esp_wifi_sta_get_ap_info() call. The 802.11 retry counters and the actual
+ * TX rate are not exposed by the Wi-Fi driver, we report the negotiated PHY
+ * mode and bandwidth instead, and the TCP retransmissions when lwIP keeps
+ * stats.
+ */
+class LinkQuality {
+ public:
+  struct LinkStats_t {
+    bool connected;
+    uint32_t samples;
+    int8_t rssi_last;
+    int8_t rssi_min;
+    int8_t rssi_max;
+    //! exponentially weighted moving average, in dBm
+    float rssi_avg;
+    uint8_t channel;
+    //! "b", "g", "n" - the best the access point and us agreed on
+    char phy_mode;
+    bool ht40;
+    //! nominal top rate of the PHY mode and bandwidth, in Mbps
+    float phy_rate_mbps;
+    uint32_t tcp_retransmits;
+    uint32_t link_drops;
+  };
+
+  LinkQuality();
+  void begin();
+  void reset();
+  LinkStats_t getStats();
+  //! smoothed RSSI, 0 while not connected
+  int getRSSI();
+  void writeJson(Print& out);
+
+ private:
+  static void sampleCallback(void* arg);
+  void sample();
+
+  portMUX_TYPE lock;
+  esp_timer_handle_t timer;
+  LinkStats_t stats;
+  //! moving average in 1/256 dBm
+  int32_t rssi_avg_fixed;
+  uint8_t bssid[6];
+};
+
+extern LinkQuality linkQuality;
+
+#endif  // LINK_QUALITY_HPP
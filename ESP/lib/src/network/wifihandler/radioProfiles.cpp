@@ -0,0 +1,103 @@
+#include "radioProfiles.hpp"
+
+//! indexed by RadioProfile
+static const RadioProfiles::Settings_t RADIO_PROFILES[] = {
+    {
+        .name = "lowest_latency",
+        .protocols = WIFI_PROTOCOL_11G | WIFI_PROTOCOL_11N,
+        .bandwidth = WIFI_BW_HT40,
+        .powerSave = WIFI_PS_NONE,
+        .maxTxPower = WIFI_POWER_19_5dBm,
+    },
+    {
+        .name = "balanced",
+        .protocols = WIFI_PROTOCOL_11B | WIFI_PROTOCOL_11G | WIFI_PROTOCOL_11N,
+        .bandwidth = WIFI_BW_HT20,
+        .powerSave = WIFI_PS_NONE,
+        .maxTxPower = WIFI_POWER_19_5dBm,
+    },
+    {
+        .name = "low_power",
+        .protocols = WIFI_PROTOCOL_11B | WIFI_PROTOCOL_11G | WIFI_PROTOCOL_11N,
+        .bandwidth = WIFI_BW_HT20,
+        .powerSave = WIFI_PS_MAX_MODEM,
+        .maxTxPower = WIFI_POWER_11dBm,
+    },
+};
+
+RadioProfiles::RadioProfiles(ProjectConfig& configManager)
+    : configManager(configManager) {}
+
+const RadioProfiles::Settings_t& RadioProfiles::getSettings(
+    RadioProfile profile) {
+  size_t index = static_cast<size_t>(profile);
+  if (index >= sizeof(RADIO_PROFILES) / sizeof(RADIO_PROFILES[0]))
+    index = static_cast<size_t>(RadioProfile::BALANCED);
+  return RADIO_PROFILES[index];
+}
+
+bool RadioProfiles::fromName(const std::string& name, RadioProfile* profile) {
+  for (size_t i = 0; i < sizeof(RADIO_PROFILES) / sizeof(RADIO_PROFILES[0]);
+       i++) {
+    if (name == RADIO_PROFILES[i].name) {
+      *profile = static_cast<RadioProfile>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+void RadioProfiles::apply(RadioProfile profile,
+                          wifi_interface_t interface,
+                          wifi_power_t txPower) {
+  const Settings_t& settings = getSettings(profile);
+  log_i("[RadioProfiles]: Applying the %s profile", settings.name);
+
+  esp_err_t err = esp_wifi_set_protocol(interface, settings.protocols);
+  if (err != ESP_OK)
+    log_w("[RadioProfiles]: Could not set the protocols: %s",
+          esp_err_to_name(err));
+  err = esp_wifi_set_bandwidth(interface, settings.bandwidth);
+  if (err != ESP_OK)
+    log_w("[RadioProfiles]: Could not set the bandwidth: %s",
+          esp_err_to_name(err));
+
+  // power save is a station thing, the access point never sleeps. Goes
+  // through Arduino so it doesn't put its own setting back on a mode change
+  if (interface == WIFI_IF_STA)
+    WiFi.setSleep(settings.powerSave);
+  WiFi.setTxPower(min(txPower, settings.maxTxPower));
+}
+
+void RadioProfiles::update(ConfigState_e event) {
+  if (event != ConfigState_e::radioConfigUpdated)
+    return;
+
+  wifi_mode_t mode = WiFi.getMode();
+  if (mode == WIFI_MODE_NULL)
+    return;
+  wifi_interface_t interface =
+      (mode & WIFI_MODE_STA) ? WIFI_IF_STA : WIFI_IF_AP;
+
+  // the protocols and bandwidth only change on the next association
+  uint8_t protocols = 0;
+  wifi_bandwidth_t bandwidth = WIFI_BW_HT20;
+  esp_wifi_get_protocol(interface, &protocols);
+  esp_wifi_get_bandwidth(interface, &bandwidth);
+
+  RadioProfile profile = configManager.getRadioConfig().profile;
+  const Settings_t& settings = getSettings(profile);
+  apply(profile, interface,
+        (wifi_power_t)configManager.getWiFiTxPowerConfig().power);
+
+  if (interface == WIFI_IF_STA && WiFi.isConnected() &&
+      (protocols != settings.protocols || bandwidth != settings.bandwidth)) {
+    // the Wi-Fi handler picks the link back up with the new settings
+    log_i("[RadioProfiles]: Reconnecting for the new protocols / bandwidth");
+    esp_wifi_disconnect();
+  }
+}
+
+std::string RadioProfiles::getName() {
+  return "RadioProfiles";
+}
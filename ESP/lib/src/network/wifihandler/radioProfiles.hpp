@@ -0,0 +1,57 @@
+#pragma once
+#ifndef RADIO_PROFILES_HPP
+#define RADIO_PROFILES_HPP
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_wifi.h>
+#include <string>
+#include "data/config/project_config.hpp"
+#include "data/utilities/Observer.hpp"
+
+/**
+ * @brief Named radio settings, so the latency / power trade-off is one
+ * switch instead of being spread over the Wi-Fi setup
+ * @details A profile covers the 802.11 protocols we allow, the channel
+ * bandwidth, modem power save and a cap on the TX power of the network. The
+ * power save and TX power change right away, the protocols and bandwidth only
+ * on the next association, so switching those while connected reconnects.
+ *
+ * lowest_latency - 11g/n only, no slow 11b rates, HT40, no power save
+ * balanced       - 11b/g/n, HT20, no power save, what we always ran with
+ * low_power      - 11b/g/n, HT20, maximum modem sleep, TX power capped
+ *
+ * AMPDU aggregation is fixed in the Wi-Fi libraries at build time
+ * (sdkconfig), it can't be part of a runtime profile.
+ */
+class RadioProfiles : public IObserver<ConfigState_e> {
+ public:
+  struct Settings_t {
+    const char* name;
+    //! WIFI_PROTOCOL_11B / 11G / 11N bitmap
+    uint8_t protocols;
+    wifi_bandwidth_t bandwidth;
+    wifi_ps_type_t powerSave;
+    //! TX power cap, the network's own power is used when it's lower
+    wifi_power_t maxTxPower;
+  };
+
+  RadioProfiles(ProjectConfig& configManager);
+  void update(ConfigState_e event) override;
+  std::string getName() override;
+
+  static const Settings_t& getSettings(RadioProfile profile);
+  static bool fromName(const std::string& name, RadioProfile* profile);
+  /**
+   * @brief Applies the profile to the interface, call with the interface
+   * already started and before connecting
+   * @param txPower the TX power configured for the network
+   */
+  static void apply(RadioProfile profile,
+                    wifi_interface_t interface,
+                    wifi_power_t txPower);
+
+ private:
+  ProjectConfig& configManager;
+};
+
+#endif  // RADIO_PROFILES_HPP
@@ -0,0 +1,196 @@
+#include "radioSelfTest.hpp"
+#include <esp_timer.h>
+#include <ping/ping_sock.h>
+#include "data/utilities/jsonWriter.hpp"
+#include "linkQuality.hpp"
+
+RadioSelfTest radioSelfTest;
+
+RadioSelfTest::RadioSelfTest()
+    : lock(portMUX_INITIALIZER_UNLOCKED),
+      result(),
+      port(0),
+      pingCount(RADIO_SELF_TEST_PING_COUNT),
+      printResult(false),
+      pingDone(nullptr) {}
+
+bool RadioSelfTest::start(const std::string& host,
+                          uint16_t port,
+                          uint16_t pingCount,
+                          int profile,
+                          bool printResult) {
+  if (!WiFi.isConnected()) {
+    log_w("[RadioSelfTest]: Not connected to a network");
+    return false;
+  }
+
+  portENTER_CRITICAL(&lock);
+  if (result.running) {
+    portEXIT_CRITICAL(&lock);
+    return false;
+  }
+  result = Result_t();
+  result.running = true;
+  result.profile = profile;
+  portEXIT_CRITICAL(&lock);
+
+  this->host = host;
+  this->port = port;
+  this->pingCount = pingCount ? pingCount : RADIO_SELF_TEST_PING_COUNT;
+  this->printResult = printResult;
+  if (!pingDone)
+    pingDone = xSemaphoreCreateBinary();
+
+  // next to the Wi-Fi handler, out of the way of the camera
+  if (xTaskCreatePinnedToCore(&RadioSelfTest::testTask, "RadioSelfTest", 4096,
+                              this, 1, nullptr, 0) != pdPASS) {
+    portENTER_CRITICAL(&lock);
+    result.running = false;
+    portEXIT_CRITICAL(&lock);
+    return false;
+  }
+  return true;
+}
+
+void RadioSelfTest::testTask(void* pvParameters) {
+  static_cast<RadioSelfTest*>(pvParameters)->run();
+  vTaskDelete(nullptr);
+}
+
+void RadioSelfTest::run() {
+  IPAddress address = WiFi.gatewayIP();
+  if (!host.empty() && !address.fromString(host.c_str()) &&
+      !WiFi.hostByName(host.c_str(), address))
+    address = IPAddress();
+
+  portENTER_CRITICAL(&lock);
+  snprintf(result.target, sizeof(result.target), "%s",
+           address.toString().c_str());
+  portEXIT_CRITICAL(&lock);
+
+  if (address != IPAddress()) {
+    this->ping(address);
+    if (port)
+      this->throughput(address);
+  } else {
+    log_e("[RadioSelfTest]: Could not resolve %s", host.c_str());
+  }
+
+  portENTER_CRITICAL(&lock);
+  result.rssi = linkQuality.getRSSI();
+  result.running = false;
+  result.done = true;
+  portEXIT_CRITICAL(&lock);
+
+  std::string json;
+  JsonWriter::StringPrint jsonOut(json);
+  this->writeJson(jsonOut);
+  log_i("[RadioSelfTest]: %s", json.c_str());
+  if (printResult)
+    Serial.printf("{%s}\n\r", json.c_str());
+}
+
+void RadioSelfTest::ping(const IPAddress& address) {
+  esp_ping_config_t config = ESP_PING_DEFAULT_CONFIG();
+  IP_ADDR4(&config.target_addr, address[0], address[1], address[2],
+           address[3]);
+  config.count = pingCount;
+  config.interval_ms = RADIO_SELF_TEST_PING_INTERVAL_MS;
+  config.timeout_ms = 1000;
+
+  esp_ping_callbacks_t callbacks = {};
+  callbacks.cb_args = this;
+  callbacks.on_ping_success = [](esp_ping_handle_t handle, void* args) {
+    auto* self = static_cast<RadioSelfTest*>(args);
+    uint32_t rtt = 0;
+    esp_ping_get_profile(handle, ESP_PING_PROF_TIMEGAP, &rtt, sizeof(rtt));
+    portENTER_CRITICAL(&self->lock);
+    Result_t& result = self->result;
+    if (!result.pingReceived || rtt < result.rttMin_ms)
+      result.rttMin_ms = rtt;
+    if (rtt > result.rttMax_ms)
+      result.rttMax_ms = rtt;
+    result.rttAvg_ms += (rtt - result.rttAvg_ms) / (result.pingReceived + 1);
+    result.pingReceived++;
+    portEXIT_CRITICAL(&self->lock);
+  };
+  callbacks.on_ping_end = [](esp_ping_handle_t handle, void* args) {
+    auto* self = static_cast<RadioSelfTest*>(args);
+    uint32_t sent = 0;
+    esp_ping_get_profile(handle, ESP_PING_PROF_REQUEST, &sent, sizeof(sent));
+    portENTER_CRITICAL(&self->lock);
+    self->result.pingSent = sent;
+    portEXIT_CRITICAL(&self->lock);
+    xSemaphoreGive(self->pingDone);
+  };
+
+  esp_ping_handle_t session = nullptr;
+  if (esp_ping_new_session(&config, &callbacks, &session) != ESP_OK) {
+    log_e("[RadioSelfTest]: Could not start pinging");
+    return;
+  }
+  xSemaphoreTake(pingDone, 0);
+  esp_ping_start(session);
+  xSemaphoreTake(pingDone, portMAX_DELAY);
+  esp_ping_delete_session(session);
+}
+
+void RadioSelfTest::throughput(const IPAddress& address) {
+  WiFiClient client;
+  if (!client.connect(address, port, 2000)) {
+    log_e("[RadioSelfTest]: Could not connect to %s:%u",
+          address.toString().c_str(), port);
+    return;
+  }
+  client.setNoDelay(true);
+
+  uint8_t* chunk = (uint8_t*)calloc(1, RADIO_SELF_TEST_CHUNK_SIZE);
+  if (!chunk) {
+    client.stop();
+    return;
+  }
+
+  uint32_t sent = 0;
+  int64_t started_us = esp_timer_get_time();
+  int64_t end_us = started_us + RADIO_SELF_TEST_THROUGHPUT_MS * 1000LL;
+  while (esp_timer_get_time() < end_us && client.connected()) {
+    size_t written = client.write(chunk, RADIO_SELF_TEST_CHUNK_SIZE);
+    if (!written)
+      break;
+    sent += written;
+  }
+  int64_t elapsed_us = esp_timer_get_time() - started_us;
+  client.stop();
+  free(chunk);
+
+  portENTER_CRITICAL(&lock);
+  result.bytesSent = sent;
+  result.throughput_kbps =
+      elapsed_us > 0 ? sent * 8000.0f / elapsed_us : 0.0f;
+  portEXIT_CRITICAL(&lock);
+}
+
+RadioSelfTest::Result_t RadioSelfTest::getResult() {
+  portENTER_CRITICAL(&lock);
+  Result_t current = result;
+  portEXIT_CRITICAL(&lock);
+  return current;
+}
+
+void RadioSelfTest::writeJson(Print& out) {
+  Result_t current = this->getResult();
+  out.printf(
+      "\"radio_self_test\": {\"running\": %s, \"done\": %s, \"profile\": %d, "
+      "\"target\": ",
+      JsonWriter::boolean(current.running), JsonWriter::boolean(current.done),
+      current.profile);
+  JsonWriter::writeString(out, current.target);
+  out.printf(
+      ", \"ping_sent\": %u, \"ping_received\": %u, "
+      "\"rtt_min_ms\": %u, \"rtt_avg_ms\": %.1f, \"rtt_max_ms\": %u, "
+      "\"bytes_sent\": %u, \"throughput_kbps\": %.1f, \"rssi\": %d}",
+      current.pingSent,
+      current.pingReceived, current.rttMin_ms, current.rttAvg_ms,
+      current.rttMax_ms, current.bytesSent, current.throughput_kbps,
+      current.rssi);
+}
@@ -0,0 +1,74 @@
+#pragma once
+#ifndef RADIO_SELF_TEST_HPP
+#define RADIO_SELF_TEST_HPP
+#include <Arduino.h>
+#include <WiFi.h>
+#include <string>
+
+#define RADIO_SELF_TEST_PING_COUNT 20
+#define RADIO_SELF_TEST_PING_INTERVAL_MS 50
+#define RADIO_SELF_TEST_THROUGHPUT_MS 3000
+#define RADIO_SELF_TEST_CHUNK_SIZE 1436
+
+/**
+ * @brief Measures the link with the current radio profile, so profiles can
+ * be compared on the spot
+ * @details Pings the host (the gateway by default) and, when a port is
+ * given, pushes data over TCP to it for a few seconds - anything that
+ * accepts and drops a TCP stream works as the sink, e.g.
+ * `nc -l 5001 > /dev/null` or an iperf2 server. Runs on its own task, the
+ * results are there once it's done.
+ */
+class RadioSelfTest {
+ public:
+  struct Result_t {
+    bool running;
+    bool done;
+    //! the profile the test ran with
+    int profile;
+    char target[40];
+    uint16_t pingSent;
+    uint16_t pingReceived;
+    uint32_t rttMin_ms;
+    uint32_t rttMax_ms;
+    float rttAvg_ms;
+    //! 0 when no throughput test was asked for, or the connection failed
+    uint32_t bytesSent;
+    float throughput_kbps;
+    int rssi;
+  };
+
+  RadioSelfTest();
+  /**
+   * @brief Starts a test in the background
+   * @param host IP or hostname to test against, the gateway when empty
+   * @param port TCP sink port for the throughput test, 0 skips it
+   * @param printResult print the result to serial once done
+   * @return false if a test is still running or we're not connected
+   */
+  bool start(const std::string& host,
+             uint16_t port,
+             uint16_t pingCount,
+             int profile,
+             bool printResult = false);
+  Result_t getResult();
+  void writeJson(Print& out);
+
+ private:
+  static void testTask(void* pvParameters);
+  void run();
+  void ping(const IPAddress& address);
+  void throughput(const IPAddress& address);
+
+  portMUX_TYPE lock;
+  Result_t result;
+  std::string host;
+  uint16_t port;
+  uint16_t pingCount;
+  bool printResult;
+  SemaphoreHandle_t pingDone;
+};
+
+extern RadioSelfTest radioSelfTest;
+
+#endif  // RADIO_SELF_TEST_HPP
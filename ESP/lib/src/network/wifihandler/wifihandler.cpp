@@ -1,7 +1,10 @@
 #include "wifihandler.hpp"
-#include <WiFi.h>
+#include <esp_timer.h>
+#include <algorithm>
 #include "data/StateManager/StateManager.hpp"
 #include "data/utilities/helpers.hpp"
+#include "data/utilities/network_utilities.hpp"
+#include "tasks/bootSequence.hpp"
 
 WiFiHandler::WiFiHandler(ProjectConfig& configManager,
                          const std::string& ssid,
@@ -9,23 +12,294 @@ WiFiHandler::WiFiHandler(ProjectConfig& configManager,
                          uint8_t channel,
                          bool enable_adhoc)
     : configManager(configManager),
+      events(nullptr),
+      taskHandle(nullptr),
+      candidateIndex(0),
+      phase(PHASE_IDLE),
+      attemptDeadline(0),
+      connectStarted_us(0),
+      reconnecting(false),
+      roaming(false),
+      nextReconnect(0),
+      reconnectBackoff(WIFI_RECONNECT_BACKOFF_MIN_MS),
+      weakSamples(0),
+      lastRoamScan(0),
+      reconnectCount(0),
+      _enable_adhoc(enable_adhoc),
       ssid(std::move(ssid)),
       password(std::move(password)),
       channel(channel),
-      power(0),
-      _enable_adhoc(enable_adhoc) {}
+      power(0) {}
 
 WiFiHandler::~WiFiHandler() {}
 
 void WiFiHandler::begin() {
+  log_i("Starting WiFi Handler \n\r");
+  linkQuality.begin();
+  if (!events) {
+    events = xQueueCreate(8, sizeof(WiFiEvent_t));
+    WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info) {
+      this->onWiFiEvent(event, info);
+    });
+    // the radio work happens on core 0 anyway, keep the loop core free
+    xTaskCreatePinnedToCore(&WiFiHandler::connectionTask, "WiFiHandler", 4096,
+                            this, 1, &taskHandle, 0);
+  }
+
+  this->requestConnect();
+}
+
+/**
+ * @brief Has the connection task start over with the stored networks, the
+ * task owns the connection state, so this only queues the request
+ */
+void WiFiHandler::requestConnect() {
+  if (!events) {
+    log_w("WiFi Handler is not running yet, not reconnecting \n\r");
+    return;
+  }
+  WiFiEvent_t start = {.event = CONNECT_START, .reason = 0};
+  if (xQueueSend(events, &start, 0) != pdTRUE)
+    log_e("Could not queue the WiFi connection request \n\r");
+}
+
+/**
+ * @brief Runs in the Arduino event task, only forwards what we care about
+ */
+void WiFiHandler::onWiFiEvent(arduino_event_id_t event,
+                              arduino_event_info_t info) {
+  WiFiEvent_t wifiEvent = {};
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_SCAN_DONE:
+      wifiEvent.event = WIFI_SCAN_DONE;
+      break;
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      wifiEvent.event = WIFI_GOT_IP;
+      break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+      wifiEvent.event = WIFI_DISCONNECTED;
+      wifiEvent.reason = info.wifi_sta_disconnected.reason;
+      break;
+    default:
+      return;
+  }
+  xQueueSend(events, &wifiEvent, 0);
+}
+
+void WiFiHandler::connectionTask(void* pvParameters) {
+  WiFiHandler* handler = static_cast<WiFiHandler*>(pvParameters);
+  WiFiEvent_t event;
+
+  while (true) {
+    TickType_t wait = portMAX_DELAY;
+    if (handler->phase != PHASE_IDLE) {
+      int32_t remaining = handler->attemptDeadline - xTaskGetTickCount();
+      wait = remaining > 0 ? remaining : 0;
+    } else if (wifiStateManager.getCurrentState() !=
+               WiFiState_e::WiFiState_ADHOC) {
+      wait = pdMS_TO_TICKS(WIFI_MONITOR_INTERVAL_MS);
+    }
+
+    if (xQueueReceive(handler->events, &event, wait) == pdTRUE)
+      handler->handleEvent(event);
+    else
+      handler->handleTimeout();
+  }
+}
+
+void WiFiHandler::handleTimeout() {
+  switch (phase) {
+    case PHASE_FAST_CONNECT:
+      log_w("Fast connect to: %s TIMEOUT, scanning \n\r", attemptSSID.c_str());
+      this->startScan();
+      break;
+    case PHASE_SCANNING:
+      if (roaming &&
+          wifiStateManager.getCurrentState() == WiFiState_e::WiFiState_Connected) {
+        log_w("Roaming scan TIMEOUT, staying on the current network \n\r");
+        roaming = false;
+        phase = PHASE_IDLE;
+        break;
+      }
+      log_w("WiFi scan TIMEOUT, trying the networks in stored order \n\r");
+      this->rankCandidates();
+      this->connectNext();
+      break;
+    case PHASE_CONNECTING:
+      log_e("Connection to: %s TIMEOUT \n\r", attemptSSID.c_str());
+      this->connectNext();
+      break;
+    default:
+      this->monitorLink();
+      break;
+  }
+}
+
+/**
+ * @brief Periodic check while no connection attempt is running
+ */
+void WiFiHandler::monitorLink() {
+  if (configManager.getDeviceModeConfig().mode == DeviceMode::USB_MODE ||
+      wifiStateManager.getCurrentState() == WiFiState_e::WiFiState_ADHOC)
+    return;
+
+  // the events should have told us already, this catches anything they
+  // didn't
+  Network_Utilities::checkWiFiState();
+  if (wifiStateManager.getCurrentState() == WiFiState_e::WiFiState_Connected) {
+    this->checkRoaming();
+    return;
+  }
+
+  if ((int32_t)(xTaskGetTickCount() - nextReconnect) < 0)
+    return;
+
+  log_i("Reconnecting, attempt %u \n\r", reconnectCount + 1);
+  reconnectCount++;
+  metrics.count(METRIC_WIFI_RECONNECTS);
+  reconnecting = true;
+  roaming = false;
+  connectStarted_us = esp_timer_get_time();
+  this->startConnecting();
+}
+
+void WiFiHandler::checkRoaming() {
+  // the smoothed value, a single bad sample shouldn't count as weak
+  int rssi = linkQuality.getRSSI();
+  if (!rssi || rssi >= WIFI_ROAM_RSSI_THRESHOLD) {
+    weakSamples = 0;
+    return;
+  }
+  if (++weakSamples < WIFI_ROAM_WEAK_SAMPLES)
+    return;
+
+  TickType_t now = xTaskGetTickCount();
+  if (lastRoamScan && now - lastRoamScan < pdMS_TO_TICKS(WIFI_ROAM_COOLDOWN_MS))
+    return;
+
+  log_i("Signal is weak (%d dBm), looking for a better access point \n\r",
+        rssi);
+  lastRoamScan = now;
+  weakSamples = 0;
+  roaming = true;
+  this->buildCandidates();
+  this->startScan(false);
+}
+
+/**
+ * @brief A whole round through the networks failed while reconnecting, wait
+ * a bit longer every time before the next one
+ */
+void WiFiHandler::scheduleReconnect() {
+  log_w("Reconnect failed, retrying in %u ms \n\r", reconnectBackoff);
+  phase = PHASE_IDLE;
+  wifiStateManager.setState(WiFiState_e::WiFiState_Disconnected);
+  nextReconnect = xTaskGetTickCount() + pdMS_TO_TICKS(reconnectBackoff);
+  reconnectBackoff = min(reconnectBackoff * 2, (uint32_t)WIFI_RECONNECT_BACKOFF_MAX_MS);
+}
+
+void WiFiHandler::handleEvent(const WiFiEvent_t& event) {
+  switch (event.event) {
+    case CONNECT_START:
+      connectStarted_us = esp_timer_get_time();
+      reconnecting = false;
+      roaming = false;
+      this->startConnecting();
+      break;
+    case WIFI_SCAN_DONE: {
+      if (phase != PHASE_SCANNING)
+        break;
+      this->rankCandidates();
+      if (!roaming) {
+        this->connectNext();
+        break;
+      }
+
+      roaming = false;
+      const Candidate_t& best = candidates.front();
+      bool connected = wifiStateManager.getCurrentState() ==
+                       WiFiState_e::WiFiState_Connected;
+      if (connected &&
+          (!best.present || best.rssi < linkQuality.getRSSI() + WIFI_ROAM_RSSI_MARGIN ||
+           memcmp(best.bssid, WiFi.BSSID(), sizeof(best.bssid)) == 0)) {
+        log_i("No better access point around, staying \n\r");
+        phase = PHASE_IDLE;
+        break;
+      }
+
+      if (connected) {
+        log_i("Roaming to %s (%d dBm) \n\r", best.network.ssid.c_str(),
+              best.rssi);
+        metrics.count(METRIC_WIFI_ROAMS);
+      }
+      reconnecting = true;
+      connectStarted_us = esp_timer_get_time();
+      WiFi.disconnect();
+      this->connectNext();
+      break;
+    }
+    case WIFI_GOT_IP: {
+      if (wifiStateManager.getCurrentState() ==
+          WiFiState_e::WiFiState_Connected)
+        break;
+      bool fastConnect = phase == PHASE_FAST_CONNECT;
+      phase = PHASE_IDLE;
+      wifiStateManager.setState(WiFiState_e::WiFiState_Connected);
+      uint32_t elapsed_ms = (esp_timer_get_time() - connectStarted_us) / 1000;
+      metrics.observeConnect(elapsed_ms);
+      log_i("Successfully %s to %s in %u ms%s \n\r",
+            reconnecting ? "reconnected" : "connected", WiFi.SSID().c_str(),
+            elapsed_ms, fastConnect ? " (fast connect)" : "");
+      bootSequence.markDone(BOOT_NETWORK);
+      reconnecting = false;
+      reconnectBackoff = WIFI_RECONNECT_BACKOFF_MIN_MS;
+      weakSamples = 0;
+      linkQuality.reset();
+
+      // only touch the flash when we ended up on another access point
+      if (configManager.setLastNetwork(WiFi.SSID().c_str(), WiFi.BSSID(),
+                                       WiFi.channel()))
+        configManager.lastNetworkSave();
+      break;
+    }
+    case WIFI_DISCONNECTED: {
+      // that's us leaving the previous network, not the current attempt
+      if (event.reason == WIFI_REASON_ASSOC_LEAVE && phase != PHASE_IDLE)
+        break;
 
+      if (phase == PHASE_FAST_CONNECT) {
+        log_w("Fast connect to: %s failed, reason: %u, scanning \n\r",
+              attemptSSID.c_str(), event.reason);
+        this->startScan();
+      } else if (phase == PHASE_CONNECTING) {
+        log_w("Connection to: %s failed, reason: %u \n\r",
+              attemptSSID.c_str(), event.reason);
+        this->connectNext();
+      } else if (wifiStateManager.getCurrentState() ==
+                 WiFiState_e::WiFiState_Connected) {
+        // a roaming scan carries on, once done it reconnects to the best
+        // network instead
+        log_w("Lost connection to the network, reason: %u \n\r",
+              event.reason);
+        wifiStateManager.setState(WiFiState_e::WiFiState_Disconnected);
+        metrics.count(METRIC_WIFI_DISCONNECTS);
+        nextReconnect =
+            xTaskGetTickCount() + pdMS_TO_TICKS(WIFI_RECONNECT_BACKOFF_MIN_MS);
+      }
+      break;
+    }
+  }
+}
+
+void WiFiHandler::startConnecting() {
   // just to be sure, we reeset everything before we do anything, some boards were having problems otherwise
   WiFi.disconnect();
   // we purposefully set the lowest min required security level, some boards have problems connecting otherwise
   // https://github.com/espressif/arduino-esp32/issues/8770
   WiFi.setMinSecurity(WIFI_AUTH_WEP);
+  // we pick the next network ourselves
+  WiFi.setAutoReconnect(false);
 
-  log_i("Starting WiFi Handler \n\r");
   if (this->_enable_adhoc ||
       wifiStateManager.getCurrentState() == WiFiState_e::WiFiState_ADHOC) {
     log_d("ADHOC is enabled, setting up ADHOC network \n\r");
@@ -33,78 +307,161 @@ void WiFiHandler::begin() {
     return;
   }
 
-  log_d("ADHOC is disabled, setting up STA network and checking transmission power \n\r");
-  auto txpower = configManager.getWiFiTxPowerConfig();
-  log_d("Setting Wifi Power to: %d", txpower.power);
-  log_d("Setting WiFi sleep mode to NONE \n\r");
-  WiFi.setSleep(false);
+  log_d("ADHOC is disabled, setting up STA network \n\r");
 
   log_i("Initializing connection to wifi \n\r");
   wifiStateManager.setState(WiFiState_e::WiFiState_Connecting);
 
-  auto networks = configManager.getWifiConfigs();
-
-  if (networks.empty()) {
-    log_i("No networks found in config, trying the default one \n\r");
-    
-    if (this->iniSTA(
-          this->ssid,
-          this->password,
-          this->channel, 
-          (wifi_power_t)txpower.power
-        )
-    ) {
+  this->buildCandidates();
+
+  // go straight to the access point that worked last time, if it's still one
+  // of ours
+  auto& lastNetwork = configManager.getLastNetwork();
+  for (auto& candidate : candidates) {
+    if (lastNetwork.ssid.empty() || !lastNetwork.channel ||
+        candidate.network.ssid != lastNetwork.ssid)
+      continue;
+
+    log_i("Fast connecting to: %s on channel %u \n\r",
+          lastNetwork.ssid.c_str(), lastNetwork.channel);
+    if (this->iniSTA(candidate.network.ssid.c_str(),
+                     candidate.network.password.c_str(),
+                     lastNetwork.channel,
+                     (wifi_power_t)candidate.network.power,
+                     lastNetwork.bssid)) {
+      phase = PHASE_FAST_CONNECT;
+      attemptDeadline =
+          xTaskGetTickCount() + pdMS_TO_TICKS(WIFI_FAST_CONNECT_TIMEOUT_MS);
       return;
     }
+  }
 
-    log_i(
-        "Could not connect to the hardcoded network, setting up ADHOC "
-        "network \n\r");
-    this->setUpADHOC();
+  this->startScan();
+}
+
+void WiFiHandler::buildCandidates() {
+  // the stored networks go first, the hardcoded one is the last resort
+  candidates.clear();
+  for (auto& network : configManager.getWifiConfigs())
+    candidates.emplace_back(network);
+  candidates.emplace_back(ProjectConfig::WiFiConfig_t(
+      "default", this->ssid, this->password, this->channel,
+      configManager.getWiFiTxPowerConfig().power, false));
+  candidateIndex = 0;
+}
+
+void WiFiHandler::startScan(bool disconnect) {
+  // stop whatever attempt is still going on, the scan needs the radio
+  if (disconnect)
+    WiFi.disconnect();
+  phase = PHASE_SCANNING;
+  attemptDeadline = xTaskGetTickCount() + pdMS_TO_TICKS(WIFI_SCAN_TIMEOUT_MS);
+  int16_t result = WiFi.scanNetworks(true, false, false,
+                                     WIFI_SCAN_TIME_PER_CHANNEL_MS);
+  if (result == WIFI_SCAN_FAILED) {
+    if (roaming) {
+      roaming = false;
+      phase = PHASE_IDLE;
+      return;
+    }
+    log_w("WiFi scan failed, trying the networks in stored order \n\r");
+    this->rankCandidates();
+    this->connectNext();
+  }
+}
+
+/**
+ * @brief Matches the scan results against the candidates, the ones in range
+ * go first, strongest first, the rest keep their stored order
+ */
+void WiFiHandler::rankCandidates() {
+  int16_t found = WiFi.scanComplete();
+  for (int16_t i = 0; i < found; i++) {
+    String scannedSSID = WiFi.SSID(i);
+    int32_t rssi = WiFi.RSSI(i);
+    for (auto& candidate : candidates) {
+      if (candidate.network.ssid != scannedSSID.c_str())
+        continue;
+      if (candidate.present && rssi <= candidate.rssi)
+        continue;
+      candidate.present = true;
+      candidate.rssi = rssi;
+      candidate.channel = WiFi.channel(i);
+      memcpy(candidate.bssid, WiFi.BSSID(i), sizeof(candidate.bssid));
+    }
+  }
+  if (found > 0)
+    WiFi.scanDelete();
+
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const Candidate_t& a, const Candidate_t& b) {
+                     if (a.present != b.present)
+                       return a.present;
+                     return a.present && a.rssi > b.rssi;
+                   });
+  candidateIndex = 0;
+
+  log_i("Scan found %d networks \n\r", found > 0 ? found : 0);
+  for (auto& candidate : candidates)
+    if (candidate.present)
+      log_i("  %s: %d dBm on channel %u \n\r",
+            candidate.network.ssid.c_str(), candidate.rssi, candidate.channel);
+}
+
+void WiFiHandler::connectNext() {
+  // Check if mode has been changed to USB mode during connection attempt
+  if (configManager.getDeviceModeConfig().mode == DeviceMode::USB_MODE) {
+    log_i("[WiFiHandler] Mode changed to USB during connection, aborting WiFi setup");
+    phase = PHASE_IDLE;
+    WiFi.disconnect(true);
+    wifiStateManager.setState(WiFiState_e::WiFiState_Disconnected);
     return;
   }
 
-  for (auto& network : networks) {
-    log_i("Trying to connect to network: %s \n\r", network.ssid.c_str());
-    if (this->iniSTA(network.ssid, network.password, network.channel,
-                     (wifi_power_t)network.power)) {
+  phase = PHASE_CONNECTING;
+  while (candidateIndex < candidates.size()) {
+    auto& candidate = candidates[candidateIndex++];
+    log_i("Trying to connect to network: %s \n\r",
+          candidate.network.ssid.c_str());
+    if (this->iniSTA(candidate.network.ssid.c_str(),
+                     candidate.network.password.c_str(),
+                     candidate.channel, (wifi_power_t)candidate.network.power,
+                     candidate.present ? candidate.bssid : nullptr))
       return;
-    }
   }
 
-  // at this point, we've tried every network, let's just setup adhoc
-  log_i(
-      "We've gone through every network, each timed out. Trying to connect "
-      "to hardcoded network: %s \n\r",
-      this->ssid.c_str());
-  if (this->iniSTA(this->ssid, this->password, this->channel,
-                   (wifi_power_t)txpower.power)) {
-    log_i("Successfully connected to the hardcoded network. \n\r");
+  // we had a network before, it's likely to come back, keep the servers
+  // where they are and try again later
+  if (reconnecting) {
+    this->scheduleReconnect();
     return;
   }
 
+  // at this point, we've tried every network, let's just setup adhoc
   log_i(
-      "Could not connect to the hardcoded network, setting up adhoc. "
+      "We've gone through every network, each failed. Setting up adhoc. "
       "\n\r");
+  phase = PHASE_IDLE;
   this->setUpADHOC();
 }
 
-void WiFiHandler::adhoc(const std::string& ssid,
+void WiFiHandler::adhoc(const char* ssid,
                         uint8_t channel,
-                        const std::string& password) {
+                        const char* password) {
   wifiStateManager.setState(WiFiState_e::WiFiState_ADHOC);
 
   log_i("\n[INFO]: Configuring access point...\n");
   WiFi.mode(WIFI_AP);
-  WiFi.setSleep(WIFI_PS_NONE);
   Serial.printf("\r\nStarting AP. \r\n");
   IPAddress IP = WiFi.softAPIP();
   Serial.printf("[INFO]: AP IP address: %s.\r\n", IP.toString().c_str());
   // You can remove the password parameter if you want the AP to be open.
   ProjectConfig::WiFiTxPower_t txpower = configManager.getWiFiTxPowerConfig();
-  WiFi.softAP(ssid.c_str(), password.c_str(),
+  WiFi.softAP(ssid, password,
               channel);  // AP mode with password
-  WiFi.setTxPower((wifi_power_t)txpower.power);
+  RadioProfiles::apply(configManager.getRadioConfig().profile, WIFI_IF_AP,
+                       (wifi_power_t)txpower.power);
+  bootSequence.markDone(BOOT_NETWORK);
 }
 
 void WiFiHandler::setUpADHOC() {
@@ -119,14 +476,14 @@ void WiFiHandler::setUpADHOC() {
 
   if (passwordLen <= 0) {
     log_i("\n[INFO]: Configuring access point without a password\n");
-    this->adhoc(configManager.getAPWifiConfig().ssid,
+    this->adhoc(configManager.getAPWifiConfig().ssid.c_str(),
                 configManager.getAPWifiConfig().channel);
     return;
   }
 
-  this->adhoc(configManager.getAPWifiConfig().ssid,
+  this->adhoc(configManager.getAPWifiConfig().ssid.c_str(),
               configManager.getAPWifiConfig().channel,
-              configManager.getAPWifiConfig().password);
+              configManager.getAPWifiConfig().password.c_str());
 
   log_i("\n[INFO]: Configuring access point...\n");
   log_d("\n[DEBUG]: ssid: %s\n", configManager.getAPWifiConfig().ssid.c_str());
@@ -135,68 +492,50 @@ void WiFiHandler::setUpADHOC() {
   log_d("\n[DEBUG]: channel: %d\n", configManager.getAPWifiConfig().channel);
 }
 
-bool WiFiHandler::iniSTA(const std::string& ssid,
-                         const std::string& password,
+/**
+ * @brief Starts connecting to a network, the outcome arrives as a Wi-Fi event
+ * or as the attempt deadline passing
+ * @return false if the network can't even be tried
+ */
+bool WiFiHandler::iniSTA(const char* ssid,
+                         const char* password,
                          uint8_t channel,
-                         wifi_power_t power) {
+                         wifi_power_t power,
+                         const uint8_t* bssid) {
   
   // since networks may not have a password, we only need to check if we have an ssid
   // bail if we don't  
-  if (ssid == ""){
+  if (!*ssid){
     log_d("ssid missing, bailing");
     return false; 
   }
 
-  unsigned long currentMillis = millis();
-  unsigned long startingMillis = currentMillis;
-  int connectionTimeout = 45000;  // 30 seconds
-  int progress = 0;
-
   wifiStateManager.setState(WiFiState_e::WiFiState_Connecting);
-  log_i("Trying to connect to: %s \n\r", ssid.c_str());
+  attemptSSID = ssid;
+  log_i("Trying to connect to: %s \n\r", ssid);
   auto mdnsConfig = configManager.getMDNSConfig();
   WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE,
               INADDR_NONE);  // need to call before setting hostname
   log_d("Setting hostname %s \n\r");
   WiFi.setHostname(mdnsConfig.hostname.c_str());
-    log_i("Setting TX power to: %d \n\r", (uint8_t)power);
-  WiFi.setTxPower(power); // https://github.com/espressif/arduino-esp32/issues/5698
-  WiFi.begin(ssid.c_str(), password.c_str(), channel);
+  // the protocols and bandwidth need the station up, but not associated yet
+  WiFi.mode(WIFI_STA);
+  log_i("Setting TX power to: %d \n\r", (uint8_t)power);
+  // https://github.com/espressif/arduino-esp32/issues/5698
+  RadioProfiles::apply(configManager.getRadioConfig().profile, WIFI_IF_STA,
+                       power);
+  // with a BSSID and channel the driver skips its own scan
+  WiFi.begin(ssid, password, channel, bssid);
 
+  attemptDeadline = xTaskGetTickCount() + pdMS_TO_TICKS(WIFI_CONNECT_TIMEOUT_MS);
   log_d("Waiting for WiFi to connect... \n\r");
-  while (WiFi.status() != WL_CONNECTED) {
-    progress++;
-    currentMillis = millis();
-    log_i(".");
-    log_d("Progress: %d \n\r", progress);
-    
-    // Check if mode has been changed to USB mode during connection attempt
-    if (configManager.getDeviceModeConfig().mode == DeviceMode::USB_MODE) {
-      log_i("[WiFiHandler] Mode changed to USB during connection, aborting WiFi setup");
-      WiFi.disconnect(true);
-      wifiStateManager.setState(WiFiState_e::WiFiState_Disconnected);
-      return false;
-    }
-    
-    if (Serial.available()) {
-      yield(); // Allow other processes to run
-    }
-    
-    if ((currentMillis - startingMillis) >= connectionTimeout) {
-      wifiStateManager.setState(WiFiState_e::WiFiState_Error);
-      log_e("Connection to: %s TIMEOUT \n\r", ssid.c_str());
-      return false;
-    }
-  }
-  wifiStateManager.setState(WiFiState_e::WiFiState_Connected);
-  log_i("Successfully connected to %s \n\r", ssid.c_str());
   return true;
 }
 
 void WiFiHandler::update(ConfigState_e event) {
   switch (event) {
     case ConfigState_e::networksConfigUpdated:
-      this->begin();
+      this->requestConnect();
       break;
     default:
       break;
@@ -1,10 +1,55 @@
 #pragma once
 #ifndef WIFIHANDLER_HPP
 #define WIFIHANDLER_HPP
+#include <WiFi.h>
 #include <string>
+#include <vector>
 #include "data/config/project_config.hpp"
 #include "data/utilities/Observer.hpp"
+#include "data/utilities/metrics.hpp"
+#include "linkQuality.hpp"
+#include "radioProfiles.hpp"
 
+//! how long a single network gets before we move on, failures are usually
+//! reported way sooner by a disconnect event
+#define WIFI_CONNECT_TIMEOUT_MS 15000
+//! going straight to the cached access point either works quickly or not at
+//! all
+#define WIFI_FAST_CONNECT_TIMEOUT_MS 4000
+#define WIFI_SCAN_TIMEOUT_MS 8000
+#define WIFI_SCAN_TIME_PER_CHANNEL_MS 120
+
+//! how often the link gets checked once we're connected
+#define WIFI_MONITOR_INTERVAL_MS 1000
+//! reconnect attempts back off from the min to the max, doubling every time
+//! a whole round through the networks fails
+#define WIFI_RECONNECT_BACKOFF_MIN_MS 1000
+#define WIFI_RECONNECT_BACKOFF_MAX_MS 60000
+//! roam once the signal stayed under the threshold for that many checks, and
+//! only to an access point that's at least the margin stronger
+#define WIFI_ROAM_RSSI_THRESHOLD -75
+#define WIFI_ROAM_RSSI_MARGIN 8
+#define WIFI_ROAM_WEAK_SAMPLES 5
+#define WIFI_ROAM_COOLDOWN_MS 60000
+
+/**
+ * @brief Connects to the stored networks in the background
+ * @details begin() only kicks the connection off, the attempts themselves
+ * run on a low priority task driven by the Wi-Fi events, so the camera,
+ * serial commands and USB streaming are up while we connect. Falls back to
+ * the access point once every network failed.
+ *
+ * The access point we last connected to is tried first, directly by BSSID
+ * and channel. If that fails, a single scan ranks the stored networks: the
+ * ones in range go first, strongest first, and get connected to by BSSID
+ * too; the ones not seen (hidden, or out of range) are only tried last.
+ *
+ * Once connected the same task keeps an eye on the link: a dropped
+ * connection is re-established with an exponential backoff instead of
+ * falling back to the access point, and a weak signal triggers a scan to
+ * roam to a stronger stored network. The servers are bound to the
+ * interface, so they keep running across reconnects.
+ */
 class WiFiHandler : public IObserver<ConfigState_e> {
  public:
   WiFiHandler(ProjectConfig& configManager,
@@ -18,17 +63,81 @@ class WiFiHandler : public IObserver<ConfigState_e> {
   std::string getName() override;
 
  private:
+  enum Phase_e {
+    PHASE_IDLE,
+    PHASE_FAST_CONNECT,
+    PHASE_SCANNING,
+    PHASE_CONNECTING,
+  };
+
+  enum Event_e {
+    CONNECT_START,
+    WIFI_SCAN_DONE,
+    WIFI_GOT_IP,
+    WIFI_DISCONNECTED,
+  };
+
+  struct Candidate_t {
+    Candidate_t(const ProjectConfig::WiFiConfig_t& network)
+        : network(network),
+          present(false),
+          rssi(0),
+          bssid(),
+          channel(network.channel) {}
+    ProjectConfig::WiFiConfig_t network;
+    //! seen in the last scan, the rest of the fields come from it
+    bool present;
+    int32_t rssi;
+    uint8_t bssid[6];
+    uint8_t channel;
+  };
+
+  struct WiFiEvent_t {
+    Event_e event;
+    uint8_t reason;
+  };
+
+  static void connectionTask(void* pvParameters);
+  void requestConnect();
+  void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info);
+  void handleEvent(const WiFiEvent_t& event);
+  void handleTimeout();
+  void monitorLink();
+  void checkRoaming();
+  void scheduleReconnect();
+  void startConnecting();
+  void buildCandidates();
+  void startScan(bool disconnect = true);
+  void rankCandidates();
+  void connectNext();
   void setUpADHOC();
-  void adhoc(const std::string& ssid,
-             uint8_t channel,
-             const std::string& password = std::string());
-  bool iniSTA(const std::string& ssid,
-              const std::string& password,
+  void adhoc(const char* ssid, uint8_t channel, const char* password = "");
+  bool iniSTA(const char* ssid,
+              const char* password,
               uint8_t channel,
-              wifi_power_t power);
+              wifi_power_t power,
+              const uint8_t* bssid = nullptr);
 
   ProjectConfig& configManager;
+  QueueHandle_t events;
+  TaskHandle_t taskHandle;
+  std::vector<Candidate_t> candidates;
+  size_t candidateIndex;
+  Phase_e phase;
+  std::string attemptSSID;
+  TickType_t attemptDeadline;
+  //! the connect times, reconnects and roams go to the metrics
+  int64_t connectStarted_us;
 
+  //! set while getting back on a network we lost, no access point fallback
+  bool reconnecting;
+  //! set while scanning for a stronger access point to roam to
+  bool roaming;
+  TickType_t nextReconnect;
+  uint32_t reconnectBackoff;
+  uint8_t weakSamples;
+  TickType_t lastRoamScan;
+  uint32_t reconnectCount;
 
   bool _enable_adhoc;
   std::string ssid;
@@ -9,6 +9,8 @@
 #include <io/Serial/SerialManager.hpp>
 #include <io/camera/cameraHandler.hpp>
 #include <logo/logo.hpp>
+#include <processing/PupilTracker/PupilTracker.hpp>
+#include <tasks/bootSequence.hpp>
 
 #ifndef ETVR_EYE_TRACKER_USB_API
 #include <network/api/webserverHandler.hpp>
@@ -0,0 +1,281 @@
+#include "PupilDetector.hpp"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+PupilDetector::PupilDetector()
+    : settings({
+          .threshold = 0,
+          .fitEllipse = true,
+          .minArea = 0.002f,
+          .maxArea = 0.25f,
+      }),
+      runs(nullptr),
+      blobIndex(nullptr),
+      blobs(nullptr),
+      ownsMemory(false) {}
+
+PupilDetector::~PupilDetector() {
+  if (!ownsMemory)
+    return;
+  free(runs);
+  free(blobIndex);
+  free(blobs);
+}
+
+/**
+ * @brief Allocates the ~54KB of working memory
+ * @param allocator malloc-compatible allocator, handy to place it in PSRAM
+ */
+bool PupilDetector::begin(void* (*allocator)(size_t)) {
+  if (runs)
+    return true;
+  if (!allocator)
+    allocator = malloc;
+
+  runs = (Run_t*)allocator(sizeof(Run_t) * PUPIL_MAX_RUNS);
+  blobIndex = (uint16_t*)allocator(sizeof(uint16_t) * PUPIL_MAX_RUNS);
+  blobs = (Blob_t*)allocator(sizeof(Blob_t) * PUPIL_MAX_BLOBS);
+  ownsMemory = true;
+  if (!runs || !blobIndex || !blobs) {
+    free(runs);
+    free(blobIndex);
+    free(blobs);
+    runs = nullptr;
+    blobIndex = nullptr;
+    blobs = nullptr;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Places the threshold a third of the way from the darkest pixels to
+ * the median, sampled on a 4x4 grid to keep it cheap
+ */
+uint8_t PupilDetector::pickThreshold(const uint8_t* frame,
+                                     uint16_t width,
+                                     uint16_t height) {
+  uint32_t histogram[64] = {0};
+  uint32_t samples = 0;
+  for (uint16_t y = 0; y < height; y += 4) {
+    const uint8_t* row = frame + (size_t)y * width;
+    for (uint16_t x = 0; x < width; x += 4) {
+      histogram[row[x] >> 2]++;
+      samples++;
+    }
+  }
+
+  uint32_t darkCount = samples / 100;
+  uint32_t medianCount = samples / 2;
+  int dark = -1;
+  int median = 63;
+  uint32_t cumulative = 0;
+  for (int i = 0; i < 64; i++) {
+    cumulative += histogram[i];
+    if (dark < 0 && cumulative > darkCount)
+      dark = i;
+    if (cumulative > medianCount) {
+      median = i;
+      break;
+    }
+  }
+  if (dark < 0)
+    dark = 0;
+  return ((dark * 4) + ((median - dark) * 4) / 3) + 2;
+}
+
+uint16_t PupilDetector::findRoot(uint16_t run) {
+  while (runs[run].parent != run) {
+    runs[run].parent = runs[runs[run].parent].parent;
+    run = runs[run].parent;
+  }
+  return run;
+}
+
+void PupilDetector::merge(uint16_t a, uint16_t b) {
+  a = findRoot(a);
+  b = findRoot(b);
+  if (a == b)
+    return;
+  // keep the oldest run as the root, it makes the roots stable while scanning
+  if (a < b)
+    runs[b].parent = a;
+  else
+    runs[a].parent = b;
+}
+
+bool PupilDetector::detect(const uint8_t* frame,
+                           uint16_t width,
+                           uint16_t height,
+                           PupilResult_t& result) {
+  memset(&result, 0, sizeof(result));
+  if (!runs || !frame || !width || !height)
+    return false;
+
+  uint8_t threshold = settings.threshold
+                          ? settings.threshold
+                          : this->pickThreshold(frame, width, height);
+  result.threshold = threshold;
+
+  // 1. threshold every row into runs of dark pixels, linking each run to the
+  // ones of the previous row it touches (8-connectivity)
+  uint16_t runCount = 0;
+  uint16_t previousStart = 0;
+  uint16_t previousEnd = 0;
+  for (uint16_t y = 0; y < height; y++) {
+    const uint8_t* row = frame + (size_t)y * width;
+    uint16_t rowStart = runCount;
+    uint16_t above = previousStart;
+
+    uint16_t x = 0;
+    while (x < width) {
+      while (x < width && row[x] >= threshold)
+        x++;
+      if (x >= width)
+        break;
+      uint16_t x0 = x;
+      while (x < width && row[x] < threshold)
+        x++;
+      uint16_t x1 = x - 1;
+
+      // too noisy to be worth finishing, most likely a bad threshold
+      if (runCount >= PUPIL_MAX_RUNS)
+        return false;
+
+      Run_t& run = runs[runCount];
+      run.y = y;
+      run.x0 = x0;
+      run.x1 = x1;
+      run.parent = runCount;
+
+      // runs are sorted by x, so we can walk the previous row only once
+      while (above < previousEnd && runs[above].x1 + 1 < x0)
+        above++;
+      for (uint16_t i = above; i < previousEnd && runs[i].x0 <= x1 + 1; i++)
+        merge(i, runCount);
+      runCount++;
+    }
+
+    previousStart = rowStart;
+    previousEnd = runCount;
+  }
+
+  // 2. collect the moments of every blob
+  uint16_t blobCount = 0;
+  for (uint16_t i = 0; i < runCount; i++) {
+    uint16_t root = findRoot(i);
+    if (root == i) {
+      if (blobCount >= PUPIL_MAX_BLOBS) {
+        blobIndex[i] = PUPIL_MAX_BLOBS;
+        continue;
+      }
+      blobIndex[i] = blobCount;
+      Blob_t& blob = blobs[blobCount++];
+      memset(&blob, 0, sizeof(blob));
+      blob.minX = runs[i].x0;
+      blob.minY = runs[i].y;
+    } else {
+      blobIndex[i] = blobIndex[root];
+    }
+    if (blobIndex[i] >= PUPIL_MAX_BLOBS)
+      continue;
+
+    const Run_t& run = runs[i];
+    Blob_t& blob = blobs[blobIndex[i]];
+    uint64_t n = run.x1 - run.x0 + 1;
+    uint64_t a = run.x0;
+    uint64_t b = run.x1;
+    // closed forms of the sums of x and x^2 over [x0, x1]
+    uint64_t sumX = (a + b) * n / 2;
+    uint64_t sumXX = (b * (b + 1) * (2 * b + 1) -
+                      (a ? (a - 1) * a * (2 * a - 1) : 0)) /
+                     6;
+    blob.area += n;
+    blob.sumX += sumX;
+    blob.sumXX += sumXX;
+    blob.sumY += n * run.y;
+    blob.sumYY += n * run.y * run.y;
+    blob.sumXY += sumX * run.y;
+    if (run.x0 < blob.minX)
+      blob.minX = run.x0;
+    if (run.x1 > blob.maxX)
+      blob.maxX = run.x1;
+    if (run.y > blob.maxY)
+      blob.maxY = run.y;
+  }
+
+  // 3. the pupil is the most solid and round blob, bigger ones win ties
+  uint32_t pixels = (uint32_t)width * height;
+  float bestScore = 0;
+  for (uint16_t i = 0; i < blobCount; i++) {
+    PupilResult_t candidate;
+    if (!this->describe(blobs[i], pixels, candidate))
+      continue;
+
+    // a blob cut by the frame edge is likely a shadow or the eyelashes
+    const Blob_t& blob = blobs[i];
+    if (!blob.minX || !blob.minY || blob.maxX == width - 1 ||
+        blob.maxY == height - 1)
+      candidate.confidence *= 0.5f;
+
+    float score = candidate.confidence * sqrtf((float)blob.area);
+    if (score > bestScore) {
+      bestScore = score;
+      candidate.threshold = threshold;
+      result = candidate;
+    }
+  }
+
+  if (!settings.fitEllipse) {
+    result.axisMajor = 0;
+    result.axisMinor = 0;
+    result.angle = 0;
+  }
+  return result.confidence > 0;
+}
+
+/**
+ * @brief Turns the raw moments of a blob into a pupil candidate
+ * @return false if the blob is out of the size limits
+ */
+bool PupilDetector::describe(const Blob_t& blob,
+                             uint32_t pixels,
+                             PupilResult_t& result) {
+  memset(&result, 0, sizeof(result));
+  float fraction = (float)blob.area / pixels;
+  if (fraction < settings.minArea || fraction > settings.maxArea)
+    return false;
+
+  float area = blob.area;
+  float cx = blob.sumX / area;
+  float cy = blob.sumY / area;
+  float mu20 = blob.sumXX / area - cx * cx;
+  float mu02 = blob.sumYY / area - cy * cy;
+  float mu11 = blob.sumXY / area - cx * cy;
+
+  // eigenvalues of the covariance matrix, a solid ellipse with semi-axes a, b
+  // has variances a^2 / 4 and b^2 / 4 along them
+  float common = sqrtf((mu20 - mu02) * (mu20 - mu02) + 4 * mu11 * mu11);
+  float lambdaMajor = (mu20 + mu02 + common) / 2;
+  float lambdaMinor = (mu20 + mu02 - common) / 2;
+  if (lambdaMinor <= 0)
+    return false;
+
+  result.x = cx;
+  result.y = cy;
+  result.area = blob.area;
+  result.radius = sqrtf(area / (float)M_PI);
+  result.axisMajor = 2 * sqrtf(lambdaMajor);
+  result.axisMinor = 2 * sqrtf(lambdaMinor);
+  result.angle = 0.5f * atan2f(2 * mu11, mu20 - mu02);
+
+  // solidity is 1 for a filled ellipse, lower for rings, crescents and
+  // ragged shapes; roundness is 1 for a circle, lower for streaks
+  float solidity = area / ((float)M_PI * result.axisMajor * result.axisMinor);
+  if (solidity > 1)
+    solidity = 1 / solidity;
+  float roundness = result.axisMinor / result.axisMajor;
+  result.confidence = solidity * sqrtf(roundness);
+  return true;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#ifndef PUPIL_DETECTOR_HPP
+#define PUPIL_DETECTOR_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+#define PUPIL_MAX_RUNS 4096
+#define PUPIL_MAX_BLOBS 256
+
+struct PupilResult_t {
+  //! center and radius in pixels of the source frame
+  float x;
+  float y;
+  float radius;
+  //! ellipse semi-axes and rotation in radians, only set with ellipse fitting
+  float axisMajor;
+  float axisMinor;
+  float angle;
+  //! 0 - nothing pupil-like found (closed eye, bad threshold), 1 - a solid,
+  //! round blob
+  float confidence;
+  uint8_t threshold;
+  uint32_t area;
+};
+
+/**
+ * @brief Finds the pupil as the best dark blob of a grayscale frame
+ * @details The frame is thresholded row by row into runs of dark pixels,
+ * which are merged into 8-connected blobs with a union-find. Each blob keeps
+ * its raw moments, the pupil is the most compact blob within the size limits,
+ * and the ellipse comes from its second order central moments.
+ * @note Has no Arduino dependencies on purpose, so recorded frames can be
+ * replayed through it on the host.
+ */
+class PupilDetector {
+ public:
+  struct Settings_t {
+    //! 0 picks the threshold from the darkest pixels of every frame
+    uint8_t threshold;
+    bool fitEllipse;
+    //! blob area limits, as a fraction of the frame
+    float minArea;
+    float maxArea;
+  };
+
+  PupilDetector();
+  ~PupilDetector();
+  bool begin(void* (*allocator)(size_t) = nullptr);
+  void setSettings(const Settings_t& settings) { this->settings = settings; }
+  const Settings_t& getSettings() const { return settings; }
+
+  /**
+   * @brief Locates the pupil in an 8 bit grayscale frame
+   * @return false if nothing usable was found, result.confidence is 0 then
+   */
+  bool detect(const uint8_t* frame,
+              uint16_t width,
+              uint16_t height,
+              PupilResult_t& result);
+
+ private:
+  struct Run_t {
+    uint16_t y;
+    uint16_t x0;
+    uint16_t x1;
+    uint16_t parent;
+  };
+
+  struct Blob_t {
+    uint32_t area;
+    uint64_t sumX;
+    uint64_t sumY;
+    uint64_t sumXX;
+    uint64_t sumYY;
+    uint64_t sumXY;
+    uint16_t minX;
+    uint16_t maxX;
+    uint16_t minY;
+    uint16_t maxY;
+  };
+
+  uint8_t pickThreshold(const uint8_t* frame, uint16_t width, uint16_t height);
+  uint16_t findRoot(uint16_t run);
+  void merge(uint16_t a, uint16_t b);
+  bool describe(const Blob_t& blob, uint32_t pixels, PupilResult_t& result);
+
+  Settings_t settings;
+  Run_t* runs;
+  uint16_t* blobIndex;
+  Blob_t* blobs;
+  bool ownsMemory;
+};
+
+#endif  // PUPIL_DETECTOR_HPP
@@ -0,0 +1,246 @@
+#include "PupilTracker.hpp"
+#include <img_converters.h>
+
+PupilTracker::PupilTracker(ProjectConfig& configManager)
+    : configManager(configManager),
+      lock(portMUX_INITIALIZER_UNLOCKED),
+      taskHandle(nullptr),
+      running(false),
+      transport(PupilTransport::SERIAL_OUTPUT),
+      udpPort(0),
+      keyframeInterval(0),
+      sequence(0),
+      sinceKeyframe(0) {}
+
+static void* allocateWorkingMemory(size_t size) {
+  return psramFound() ? ps_malloc(size) : malloc(size);
+}
+
+void PupilTracker::applySettings() {
+  const auto& pupilConfig = configManager.getPupilConfig();
+
+  PupilDetector::Settings_t settings = detector.getSettings();
+  settings.threshold = pupilConfig.threshold;
+  settings.fitEllipse = pupilConfig.ellipseFit;
+  detector.setSettings(settings);
+
+  if (pupilConfig.transport == PupilTransport::UDP_OUTPUT &&
+      !udpAddress.fromString(pupilConfig.udpHost.c_str()))
+    log_e("[PupilTracker]: Invalid UDP host %s, expected an IP address",
+          pupilConfig.udpHost.c_str());
+  transport = pupilConfig.transport;
+  udpPort = pupilConfig.udpPort;
+  keyframeInterval = pupilConfig.keyframeInterval;
+}
+
+void PupilTracker::start() {
+  this->applySettings();
+  // a task that is still finishing its last frame after a stop() just keeps
+  // going, see trackerTask
+  portENTER_CRITICAL(&lock);
+  bool alive = taskHandle;
+  if (alive)
+    running = true;
+  portEXIT_CRITICAL(&lock);
+  if (alive)
+    return;
+
+  if (!detector.begin(allocateWorkingMemory)) {
+    log_e("[PupilTracker]: Could not allocate the detector memory");
+    return;
+  }
+
+  running = true;
+  sinceKeyframe = 0;
+  // the detector keeps up with the sensor on its own core, next to the
+  // network stack rather than the loop
+  if (xTaskCreatePinnedToCore(&PupilTracker::trackerTask, "PupilTracker",
+                              4096, this, 2, &taskHandle, 1) != pdPASS) {
+    log_e("[PupilTracker]: Could not start the tracker task");
+    running = false;
+    taskHandle = nullptr;
+    return;
+  }
+  log_i("[PupilTracker]: Started");
+}
+
+void PupilTracker::stop() {
+  // the task finishes its current frame and deletes itself
+  running = false;
+}
+
+void PupilTracker::trackerTask(void* pvParameters) {
+  PupilTracker* tracker = static_cast<PupilTracker*>(pvParameters);
+  // the camera might still be initializing on boot
+  bootSequence.waitFor(BOOT_CAMERA, portMAX_DELAY);
+
+  while (true) {
+    if (!tracker->running) {
+      // start() may have re-armed the task meanwhile, under the lock it
+      // either sees the task alive or we're gone before it starts a new one
+      portENTER_CRITICAL(&tracker->lock);
+      bool stopped = !tracker->running;
+      if (stopped)
+        tracker->taskHandle = nullptr;
+      portEXIT_CRITICAL(&tracker->lock);
+      if (stopped)
+        break;
+    }
+
+    // switching to grayscale reinitializes the camera, wait for it
+    if (!cameraGate.enter()) {
+      vTaskDelay(pdMS_TO_TICKS(CAMERA_GATE_RETRY_MS));
+      continue;
+    }
+    camera_fb_t* fb = esp_camera_fb_get();
+    if (!fb) {
+      cameraGate.leave();
+      metrics.count(METRIC_CAMERA_CAPTURE_ERRORS);
+      vTaskDelay(pdMS_TO_TICKS(100));
+      continue;
+    }
+
+    // the camera is still being switched over to grayscale
+    if (fb->format != PIXFORMAT_GRAYSCALE) {
+      esp_camera_fb_return(fb);
+      cameraGate.leave();
+      vTaskDelay(pdMS_TO_TICKS(10));
+      continue;
+    }
+
+    snapshotProvider.offer(fb, nullptr);
+    tracker->processFrame(fb);
+    esp_camera_fb_return(fb);
+    cameraGate.leave();
+    bootSequence.recordFirstFrame(TRANSPORT_PUPIL);
+  }
+
+  log_i("[PupilTracker]: Stopped");
+  vTaskDelete(nullptr);
+}
+
+void PupilTracker::processFrame(camera_fb_t* fb) {
+  PupilResult_t result;
+  {
+    TRACE_SCOPE("pupil_detect");
+    detector.detect(fb->buf, fb->width, fb->height, result);
+  }
+
+  int64_t captured_us =
+      (int64_t)fb->timestamp.tv_sec * 1000000LL + fb->timestamp.tv_usec;
+  uint8_t payload[PUPIL_RESULT_SIZE];
+  size_t len = this->packResult(result, captured_us, payload);
+  if (this->sendResult(payload, len))
+    metrics.frameSent(TRANSPORT_PUPIL, len, fb->timestamp);
+  else
+    metrics.frameDropped(TRANSPORT_PUPIL);
+
+  if (keyframeInterval && ++sinceKeyframe >= keyframeInterval) {
+    sinceKeyframe = 0;
+    this->sendKeyframe(fb);
+  }
+  sequence++;
+}
+
+static uint8_t* putLE(uint8_t* buffer, uint64_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; i++)
+    *buffer++ = (value >> (i * 8)) & 0xFF;
+  return buffer;
+}
+
+static uint16_t toFixed(float value) {
+  float fixed = value * 16.0f + 0.5f;
+  if (fixed < 0)
+    return 0;
+  return fixed > 65535.0f ? 65535 : (uint16_t)fixed;
+}
+
+size_t PupilTracker::packResult(const PupilResult_t& result,
+                                int64_t captured_us,
+                                uint8_t* buffer) {
+  uint8_t* it = buffer;
+  it = putLE(it, sequence, 4);
+  it = putLE(it, captured_us, 8);
+  it = putLE(it, toFixed(result.x), 2);
+  it = putLE(it, toFixed(result.y), 2);
+  it = putLE(it, toFixed(result.radius), 2);
+  it = putLE(it, toFixed(result.axisMajor), 2);
+  it = putLE(it, toFixed(result.axisMinor), 2);
+  it = putLE(it, (uint16_t)(int16_t)lroundf(result.angle * 10000.0f), 2);
+  it = putLE(it, (uint8_t)lroundf(result.confidence * 255.0f), 1);
+  it = putLE(it, result.threshold, 1);
+  return it - buffer;
+}
+
+bool PupilTracker::sendResult(const uint8_t* payload, size_t len) {
+  if (transport == PupilTransport::UDP_OUTPUT) {
+    if (!WiFi.isConnected() && WiFi.getMode() != WIFI_AP)
+      return false;
+    udp.beginPacket(udpAddress, udpPort);
+    udp.write((const uint8_t*)PUPIL_UDP_MAGIC "R", 4);
+    udp.write(payload, len);
+    return udp.endPacket();
+  }
+
+  uint8_t len_bytes[2] = {(uint8_t)(len & 0xFF), (uint8_t)(len >> CHAR_BIT)};
+  SerialLock serialLock;
+  Serial.write(ETVR_HEADER, 2);
+  Serial.write(ETVR_HEADER_PUPIL, 2);
+  Serial.write(len_bytes, 2);
+  Serial.write(payload, len);
+  return true;
+}
+
+void PupilTracker::sendKeyframe(camera_fb_t* fb) {
+  uint8_t* jpg_buf = nullptr;
+  size_t jpg_len = 0;
+  if (!frame2jpg(fb, 80, &jpg_buf, &jpg_len)) {
+    log_e("[PupilTracker]: Keyframe encoding failed");
+    return;
+  }
+
+  if (transport == PupilTransport::UDP_OUTPUT) {
+    uint16_t count = (jpg_len + PUPIL_UDP_CHUNK_SIZE - 1) / PUPIL_UDP_CHUNK_SIZE;
+    for (uint16_t index = 0; index < count; index++) {
+      size_t offset = (size_t)index * PUPIL_UDP_CHUNK_SIZE;
+      size_t chunk = min((size_t)PUPIL_UDP_CHUNK_SIZE, jpg_len - offset);
+      uint8_t header[8];
+      uint8_t* it = putLE(header, sequence, 4);
+      it = putLE(it, index, 2);
+      putLE(it, count, 2);
+
+      udp.beginPacket(udpAddress, udpPort);
+      udp.write((const uint8_t*)PUPIL_UDP_MAGIC "K", 4);
+      udp.write(header, sizeof(header));
+      udp.write(jpg_buf + offset, chunk);
+      udp.endPacket();
+    }
+  } else {
+    uint8_t len_bytes[2] = {(uint8_t)(jpg_len & 0xFF),
+                            (uint8_t)((jpg_len >> CHAR_BIT) & 0xFF)};
+    SerialLock serialLock;
+    Serial.write(ETVR_HEADER, 2);
+    Serial.write(ETVR_HEADER_FRAME, 2);
+    Serial.write(len_bytes, 2);
+    Serial.write(jpg_buf, jpg_len);
+  }
+  free(jpg_buf);
+}
+
+void PupilTracker::update(ConfigState_e event) {
+  switch (event) {
+    case ConfigState_e::configLoaded:
+    case ConfigState_e::pupilConfigUpdated:
+      if (configManager.getPupilConfig().enabled)
+        this->start();
+      else
+        this->stop();
+      break;
+    default:
+      break;
+  }
+}
+
+std::string PupilTracker::getName() {
+  return "PupilTracker";
+}
@@ -0,0 +1,72 @@
+#pragma once
+#ifndef PUPIL_TRACKER_HPP
+#define PUPIL_TRACKER_HPP
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <esp_camera.h>
+#include "data/StateManager/StateManager.hpp"
+#include "data/config/project_config.hpp"
+#include "data/utilities/Observer.hpp"
+#include "data/utilities/metrics.hpp"
+#include "data/utilities/traceProfiler.hpp"
+#include "io/Serial/SerialManager.hpp"
+#include "io/camera/cameraGate.hpp"
+#include "io/camera/snapshot.hpp"
+#include "processing/PupilTracker/PupilDetector.hpp"
+#include "tasks/bootSequence.hpp"
+
+//! u32 sequence, i64 captured_us, u16 x, y, radius, major, minor in 1/16
+//! pixels, i16 angle in 1/10000 radians, u8 confidence (255 = 1.0),
+//! u8 threshold
+#define PUPIL_RESULT_SIZE 26
+#define PUPIL_UDP_MAGIC "OIP"
+#define PUPIL_UDP_CHUNK_SIZE 1400
+
+/**
+ * @brief Runs the pupil detector on every grayscale frame and streams only
+ * the results, plus a JPEG keyframe every now and then so the host can
+ * validate them
+ * @details Serial packets use the usual ETVR framing with the ff a4 type,
+ * keyframes are regular ff a1 frame packets. UDP datagrams start with "OIP"
+ * and a type byte - 'R' for a result, 'K' for a keyframe fragment followed by
+ * u32 sequence, u16 fragment index and u16 fragment count.
+ */
+class PupilTracker : public IObserver<ConfigState_e> {
+ public:
+  PupilTracker(ProjectConfig& configManager);
+  void update(ConfigState_e event) override;
+  std::string getName() override;
+  bool isActive() const { return running; }
+
+ private:
+  static void trackerTask(void* pvParameters);
+  void start();
+  void stop();
+  void applySettings();
+  void processFrame(camera_fb_t* fb);
+  size_t packResult(const PupilResult_t& result,
+                    int64_t captured_us,
+                    uint8_t* buffer);
+  //! false if the result could not go out
+  bool sendResult(const uint8_t* payload, size_t len);
+  void sendKeyframe(camera_fb_t* fb);
+
+  ProjectConfig& configManager;
+  PupilDetector detector;
+  WiFiUDP udp;
+  //! copied from the config by applySettings, the config's strings can
+  //! change under the tracker task
+  IPAddress udpAddress;
+  PupilTransport transport;
+  uint16_t udpPort;
+  uint16_t keyframeInterval;
+  //! hands the task over between stop() and a start() right after
+  portMUX_TYPE lock;
+  TaskHandle_t taskHandle;
+  volatile bool running;
+  uint32_t sequence;
+  uint32_t sinceKeyframe;
+};
+
+#endif  // PUPIL_TRACKER_HPP
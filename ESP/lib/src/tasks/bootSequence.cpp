@@ -0,0 +1,80 @@
+#include "bootSequence.hpp"
+#include <esp_timer.h>
+
+BootSequence bootSequence;
+
+static const char* const BOOT_STAGE_NAMES[BOOT_STAGE_COUNT] = {
+    "config",
+    "camera",
+    "network",
+    "services",
+};
+
+static const char* const TRANSPORT_NAMES[TRANSPORT_COUNT] = {
+    "serial",
+    "MJPEG",
+    "pupil results",
+};
+
+#define BOOT_DONE_BIT(stage) (1 << (stage))
+#define BOOT_SUCCEEDED_BIT(stage) (1 << ((stage) + BOOT_STAGE_COUNT))
+
+BootSequence::BootSequence()
+    : eventGroupBuffer(),
+      eventGroup(xEventGroupCreateStatic(&eventGroupBuffer)),
+      lock(portMUX_INITIALIZER_UNLOCKED),
+      stageTimes(),
+      firstFrameTimes() {}
+
+uint32_t BootSequence::sinceBoot() {
+  uint32_t ms = esp_timer_get_time() / 1000;
+  // 0 means not there yet
+  return ms ? ms : 1;
+}
+
+void BootSequence::markDone(BootStage_e stage, bool succeeded) {
+  portENTER_CRITICAL(&lock);
+  bool first = !stageTimes[stage];
+  if (first)
+    stageTimes[stage] = sinceBoot();
+  portEXIT_CRITICAL(&lock);
+  if (!first)
+    return;
+
+  TRACE_INSTANT(BOOT_STAGE_NAMES[stage]);
+  xEventGroupSetBits(eventGroup, BOOT_DONE_BIT(stage) |
+                                     (succeeded ? BOOT_SUCCEEDED_BIT(stage) : 0));
+  log_i("[Boot]: %s %s after %u ms", BOOT_STAGE_NAMES[stage],
+        succeeded ? "ready" : "failed", stageTimes[stage]);
+}
+
+bool BootSequence::waitFor(BootStage_e stage, TickType_t timeout) {
+  EventBits_t bits = xEventGroupWaitBits(eventGroup, BOOT_DONE_BIT(stage),
+                                         pdFALSE, pdTRUE, timeout);
+  return bits & BOOT_SUCCEEDED_BIT(stage);
+}
+
+bool BootSequence::isReady(BootStage_e stage) {
+  return xEventGroupGetBits(eventGroup) & BOOT_SUCCEEDED_BIT(stage);
+}
+
+void BootSequence::recordFirstFrame(FrameTransport_e transport) {
+  // checked without the lock first, this gets called for every frame
+  if (firstFrameTimes[transport])
+    return;
+
+  portENTER_CRITICAL(&lock);
+  bool first = !firstFrameTimes[transport];
+  if (first)
+    firstFrameTimes[transport] = sinceBoot();
+  portEXIT_CRITICAL(&lock);
+  if (!first)
+    return;
+
+  log_i(
+      "[Boot]: First frame over %s after %u ms (config %u ms, camera %u ms, "
+      "network %u ms)",
+      TRANSPORT_NAMES[transport], firstFrameTimes[transport],
+      stageTimes[BOOT_CONFIG], stageTimes[BOOT_CAMERA],
+      stageTimes[BOOT_NETWORK]);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#ifndef BOOT_SEQUENCE_HPP
+#define BOOT_SEQUENCE_HPP
+#include <Arduino.h>
+#include <freertos/event_groups.h>
+#include "data/utilities/traceProfiler.hpp"
+
+enum BootStage_e {
+  BOOT_CONFIG,
+  BOOT_CAMERA,
+  BOOT_NETWORK,
+  BOOT_SERVICES,
+  BOOT_STAGE_COUNT,
+};
+
+enum FrameTransport_e {
+  TRANSPORT_SERIAL,
+  TRANSPORT_MJPEG,
+  TRANSPORT_PUPIL,
+  TRANSPORT_COUNT,
+};
+
+/**
+ * @brief Tracks the boot stages that run concurrently, so the ones depending
+ * on another can wait for it instead of everything running in sequence
+ * @details The config gets loaded in setup, the camera initializes on its
+ * own task while Wi-Fi associates in the background, and the servers come up
+ * once we're on a network. Every stage has a done bit and a succeeded bit in
+ * an event group. The time every stage finished and the first frame went out
+ * over every transport is logged, all relative to the boot.
+ */
+class BootSequence {
+ public:
+  BootSequence();
+  //! marks the stage done, only the first call for a stage counts
+  void markDone(BootStage_e stage, bool succeeded = true);
+  /**
+   * @brief Blocks until the stage is done or the timeout passed
+   * @return true if the stage finished and succeeded
+   */
+  bool waitFor(BootStage_e stage, TickType_t timeout);
+  bool isReady(BootStage_e stage);
+  //! logs the time to the first frame of the transport, once
+  void recordFirstFrame(FrameTransport_e transport);
+  //! milliseconds since boot the stage finished at, 0 if it did not yet
+  uint32_t getStageTime(BootStage_e stage) const { return stageTimes[stage]; }
+  uint32_t getFirstFrameTime(FrameTransport_e transport) const {
+    return firstFrameTimes[transport];
+  }
+
+ private:
+  static uint32_t sinceBoot();
+
+  StaticEventGroup_t eventGroupBuffer;
+  EventGroupHandle_t eventGroup;
+  portMUX_TYPE lock;
+  volatile uint32_t stageTimes[BOOT_STAGE_COUNT];
+  volatile uint32_t firstFrameTimes[TRANSPORT_COUNT];
+};
+
+extern BootSequence bootSequence;
+
+#endif  // BOOT_SEQUENCE_HPP
@@ -1,11 +1,116 @@
 #include "tasks.hpp"
+#include <vector>
 
-void OpenIrisTasks::ScheduleRestart(int milliseconds) {
-    yield();
-    int initialTime = millis();
-    while (millis() - initialTime <= milliseconds) {
+namespace {
+struct DeferredJob_t {
+  TickType_t due;
+  OpenIrisTasks::Job_t job;
+};
+
+struct PreRestartHook_t {
+  const char* name;
+  OpenIrisTasks::Job_t hook;
+};
+
+QueueHandle_t jobQueue = nullptr;
+//! only ever added to from setup and the loop
+std::vector<PreRestartHook_t> preRestartHooks;
+portMUX_TYPE restartLock = portMUX_INITIALIZER_UNLOCKED;
+bool restartScheduled = false;
+
+/**
+ * @brief Picks up new jobs and runs the pending ones as they get due, the
+ * queue wait doubles as the timer
+ */
+void deferredWorker(void* pvParameters) {
+  std::vector<DeferredJob_t*> pending;
+  while (true) {
+    TickType_t wait = portMAX_DELAY;
+    TickType_t now = xTaskGetTickCount();
+    for (auto* pendingJob : pending) {
+      TickType_t left =
+          (int32_t)(pendingJob->due - now) > 0 ? pendingJob->due - now : 0;
+      wait = min(wait, left);
+    }
+
+    DeferredJob_t* job = nullptr;
+    if (xQueueReceive(jobQueue, &job, wait) == pdTRUE) {
+      pending.push_back(job);
+      continue;
+    }
+
+    now = xTaskGetTickCount();
+    for (size_t i = 0; i < pending.size();) {
+      if ((int32_t)(pending[i]->due - now) > 0) {
+        i++;
         continue;
+      }
+      DeferredJob_t* dueJob = pending[i];
+      pending.erase(pending.begin() + i);
+      dueJob->job();
+      delete dueJob;
     }
-    yield();
+  }
+}
+
+bool startWorker() {
+  static bool started = [] {
+    jobQueue = xQueueCreate(DEFERRED_QUEUE_LENGTH, sizeof(DeferredJob_t*));
+    if (!jobQueue)
+      return false;
+    // priority above the loop, a restart has to happen even with a busy loop
+    return xTaskCreatePinnedToCore(&deferredWorker, "Deferred",
+                                   DEFERRED_WORKER_STACK_SIZE, nullptr, 2,
+                                   nullptr, 0) == pdPASS;
+  }();
+  return started;
+}
+}  // namespace
+
+bool OpenIrisTasks::Defer(Job_t job, uint32_t delay_ms) {
+  if (!startWorker()) {
+    log_e("[Tasks]: Deferred worker is not running");
+    return false;
+  }
+
+  auto* deferred =
+      new DeferredJob_t{xTaskGetTickCount() + pdMS_TO_TICKS(delay_ms),
+                        std::move(job)};
+  if (xQueueSend(jobQueue, &deferred, 0) != pdTRUE) {
+    log_e("[Tasks]: Deferred queue is full, dropping the job");
+    delete deferred;
+    return false;
+  }
+  return true;
+}
+
+void OpenIrisTasks::AddPreRestartHook(const char* name, Job_t hook) {
+  preRestartHooks.push_back({name, std::move(hook)});
+}
+
+void OpenIrisTasks::ScheduleRestart(int milliseconds) {
+  // several requests in a row still restart once
+  portENTER_CRITICAL(&restartLock);
+  bool alreadyScheduled = restartScheduled;
+  restartScheduled = true;
+  portEXIT_CRITICAL(&restartLock);
+  if (alreadyScheduled)
+    return;
+
+  log_i("[Tasks]: Restarting in %d ms", milliseconds);
+  bool deferred = Defer(
+      [] {
+        for (auto& hook : preRestartHooks) {
+          log_i("[Tasks]: Running pre-restart hook: %s", hook.name);
+          hook.hook();
+        }
+        // let the last logs make it out
+        Serial.flush();
+        ESP.restart();
+      },
+      milliseconds);
+
+  // no worker, no hooks, at least do what we were asked to
+  if (!deferred)
     ESP.restart();
 }
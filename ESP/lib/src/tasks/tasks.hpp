@@ -3,9 +3,40 @@
 #define TASKS_HPP
 
 #include <Arduino.h>
+#include <functional>
 
+//! how many jobs can wait to be handed to the worker at once
+#define DEFERRED_QUEUE_LENGTH 8
+#define DEFERRED_WORKER_STACK_SIZE 4096
+
+/**
+ * @brief Deferred work, run on a single worker task instead of the caller
+ * @details Handy from contexts that must not block - the web server task,
+ * observers, the main loop - for restarts, delayed reinits and anything else
+ * that can happen a bit later. Jobs run one after the other in the order
+ * they're due, so a job may block briefly, but not for long.
+ */
 namespace OpenIrisTasks {
+using Job_t = std::function<void()>;
+
+/**
+ * @brief Runs the job on the worker once the delay passed
+ * @return false if the job could not be queued
+ */
+bool Defer(Job_t job, uint32_t delay_ms = 0);
+
+/**
+ * @brief Registers a hook ran right before restarting, e.g. to flush the
+ * config or drain connections, hooks run in the order they were added
+ * @note Not thread safe, add hooks from setup or the loop only
+ */
+void AddPreRestartHook(const char* name, Job_t hook);
+
+/**
+ * @brief Restarts the device after the delay, without blocking the caller,
+ * so responses get flushed first
+ */
 void ScheduleRestart(int milliseconds);
-}
+}  // namespace OpenIrisTasks
 
-#endif // TASKS_HPP
\ No newline at end of file
+#endif  // TASKS_HPP
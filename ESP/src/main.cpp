@@ -21,6 +21,7 @@ LEDManager ledManager(33);
 
 #ifndef SIM_ENABLED
 CameraHandler cameraHandler(deviceConfig);
+PupilTracker pupilTracker(deviceConfig);
 #endif  // SIM_ENABLED
 
 #ifndef ETVR_EYE_TRACKER_USB_API
@@ -30,6 +31,7 @@ WiFiHandler wifiHandler(deviceConfig,
                         WIFI_CHANNEL,
                         ENABLE_ADHOC);
 MDNSHandler mdnsHandler(deviceConfig);
+RadioProfiles radioProfiles(deviceConfig);
 #ifdef SIM_ENABLED
 APIServer apiServer(deviceConfig, wifiStateManager, "/control");
 #else
@@ -37,6 +39,8 @@ APIServer apiServer(deviceConfig, cameraHandler, "/control");
 StreamServer streamServer;
 #endif  // SIM_ENABLED
 
+bool networkServicesStarted = false;
+
 void etvr_eye_tracker_web_init() {
   // Check if mode has been changed to USB mode before starting network initialization
   if (deviceConfig.getDeviceModeConfig().mode == DeviceMode::USB_MODE) {
@@ -47,63 +51,50 @@ void etvr_eye_tracker_web_init() {
   
   log_d("[SETUP]: Starting Network Handler");
   deviceConfig.attach(mdnsHandler);
+  deviceConfig.attach(radioProfiles);
   
-  // Check mode again before starting WiFi
-  if (deviceConfig.getDeviceModeConfig().mode == DeviceMode::USB_MODE) {
-    log_i("[SETUP]: Mode changed to USB before WiFi initialization, aborting");
-    WiFi.disconnect(true);
-    return;
-  }
-  
+  // the connection happens in the background, the servers get started from
+  // the loop once we're on a network
   log_d("[SETUP]: Starting WiFi Handler");
+  TRACE_SCOPE("wifi_begin");
   wifiHandler.begin();
-  
-  // Check mode again before starting MDNS
-  if (deviceConfig.getDeviceModeConfig().mode == DeviceMode::USB_MODE) {
-    log_i("[SETUP]: Mode changed to USB before MDNS initialization, aborting");
-    WiFi.disconnect(true);
+}
+
+/**
+ * @brief Starts the network services the first time we're connected or
+ * hosting the access point, they keep running across reconnects
+ */
+void etvr_eye_tracker_web_start() {
+  if (networkServicesStarted)
     return;
-  }
-  
-  log_d("[SETUP]: Starting MDNS Handler");
-  mdnsHandler.startMDNS();
 
   switch (wifiStateManager.getCurrentState()) {
-    case WiFiState_e::WiFiState_Disconnected: {
-      //! TODO: Implement
-      break;
-    }
-    case WiFiState_e::WiFiState_ADHOC: {
-#ifndef SIM_ENABLED
-      log_d("[SETUP]: Starting Stream Server");
-      streamServer.startStreamServer();
-#endif  // SIM_ENABLED
-      log_d("[SETUP]: Starting API Server");
-      apiServer.setup();
+    case WiFiState_e::WiFiState_ADHOC:
+    case WiFiState_e::WiFiState_Connected:
       break;
-    }
-    case WiFiState_e::WiFiState_Connected: {
+    default:
+      return;
+  }
+  networkServicesStarted = true;
+  TRACE_SCOPE("services_start");
+  // leave the network cleanly, the access point drops us right away instead
+  // of waiting for a timeout
+  OpenIrisTasks::AddPreRestartHook("network", [] { WiFi.disconnect(true); });
+
+  log_d("[SETUP]: Starting MDNS Handler");
+  mdnsHandler.startMDNS();
 #ifndef SIM_ENABLED
-      log_d("[SETUP]: Starting Stream Server");
-      streamServer.startStreamServer();
+  log_d("[SETUP]: Starting Stream Server");
+  streamServer.startStreamServer();
 #endif  // SIM_ENABLED
-      log_d("[SETUP]: Starting API Server");
-      apiServer.setup();
-      break;
-    }
-    case WiFiState_e::WiFiState_Connecting: {
-      //! TODO: Implement
-      break;
-    }
-    case WiFiState_e::WiFiState_Error: {
-      //! TODO: Implement
-      break;
-    }
-  }
+  log_d("[SETUP]: Starting API Server");
+  apiServer.setup();
+  bootSequence.markDone(BOOT_SERVICES);
 }
 #endif  // ETVR_EYE_TRACKER_WEB_API
 
 void setup() {
+  TRACE_SCOPE("setup");
   setCpuFrequencyMhz(240);
   Serial.begin(115200);
   Logo::printASCII();
@@ -124,8 +115,18 @@ void setup() {
 
 #ifndef SIM_ENABLED
   deviceConfig.attach(cameraHandler);
+  deviceConfig.attach(pupilTracker);
 #endif  // SIM_ENABLED
-  deviceConfig.load();
+  // kicks the camera init off on its own task, everything below runs
+  // alongside it
+  {
+    TRACE_SCOPE("config_load");
+    deviceConfig.load();
+  }
+  bootSequence.markDone(BOOT_CONFIG);
+  // the config is committed on every write, just make sure the handle is
+  // closed
+  OpenIrisTasks::AddPreRestartHook("config", [] { deviceConfig.end(); });
 
   serialManager.init();
 
@@ -148,4 +149,7 @@ void setup() {
 void loop() {
   ledManager.handleLED();
   serialManager.run();
+#ifndef ETVR_EYE_TRACKER_USB_API
+  etvr_eye_tracker_web_start();
+#endif  // ETVR_EYE_TRACKER_USB_API
 }
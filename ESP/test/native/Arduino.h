@@ -0,0 +1,119 @@
+#pragma once
+// The parts of the Arduino core and FreeRTOS the host tests need, just
+// enough to build the sources under test on the host. Single threaded, the
+// locks do nothing.
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+using std::max;
+using std::min;
+
+//! not format checked, the sources print size_t with %u like on the ESP32
+inline void hostLog(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  vfprintf(stderr, format, args);
+  va_end(args);
+  fputc('\n', stderr);
+}
+
+#define log_e(format, ...) hostLog(format, ##__VA_ARGS__)
+#define log_w(format, ...) hostLog(format, ##__VA_ARGS__)
+#define log_i(format, ...) ((void)0)
+#define log_d(format, ...) ((void)0)
+#define log_v(format, ...) ((void)0)
+
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+typedef uint32_t TickType_t;
+typedef void* SemaphoreHandle_t;
+#define portMAX_DELAY UINT32_MAX
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+inline int64_t hostMicros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+inline unsigned long millis() {
+  return hostMicros() / 1000;
+}
+inline unsigned long micros() {
+  return hostMicros();
+}
+inline bool psramFound() {
+  return false;
+}
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (size--)
+      written += this->write(*buffer++);
+    return written;
+  }
+  size_t write(const char* text) {
+    return this->write((const uint8_t*)text, strlen(text));
+  }
+  size_t print(const char* text) { return this->write(text); }
+  size_t println() { return this->write("\r\n"); }
+  size_t println(const char* text) {
+    return this->print(text) + this->println();
+  }
+  size_t printf(const char* format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    return len > 0 ? this->write((const uint8_t*)line,
+                                 min((size_t)len, sizeof(line) - 1))
+                   : 0;
+  }
+};
+
+//! collects everything printed, for checking it
+class StringPrint : public Print {
+ public:
+  size_t write(uint8_t c) override {
+    text += (char)c;
+    return 1;
+  }
+  std::string text;
+};
+
+class String : public std::string {
+ public:
+  String(const char* value = "") : std::string(value) {}
+  String(const std::string& value) : std::string(value) {}
+};
+
+class EspClass {
+ public:
+  //! nanoseconds on the host, there are no cycles to count
+  uint32_t getCycleCount() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+};
+inline EspClass ESP;
+
+//! the serial console goes to stdout
+class HardwareSerial : public Print {
+ public:
+  size_t write(uint8_t c) override { return fputc(c, stdout) != EOF; }
+};
+inline HardwareSerial Serial;
@@ -0,0 +1,97 @@
+#pragma once
+// An in-memory NVS for the host tests, one store shared by every namespace
+// and every instance, like the flash is. Counts the writes per key.
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+
+struct NvsEntry_t {
+  std::vector<uint8_t> value;
+  size_t writes = 0;
+};
+
+inline std::map<std::string, NvsEntry_t>& nvsStore() {
+  static std::map<std::string, NvsEntry_t> store;
+  return store;
+}
+
+class Preferences {
+ public:
+  bool begin(const char* name, bool readOnly = false,
+             const char* partition = nullptr) {
+    return true;
+  }
+  void end() {}
+  bool clear() {
+    nvsStore().clear();
+    return true;
+  }
+  bool isKey(const char* key) { return nvsStore().count(key); }
+  bool remove(const char* key) { return nvsStore().erase(key); }
+
+  size_t putInt(const char* key, int32_t value) { return put(key, value); }
+  size_t putUInt(const char* key, uint32_t value) { return put(key, value); }
+  size_t putUChar(const char* key, uint8_t value) { return put(key, value); }
+  size_t putBool(const char* key, bool value) {
+    return put(key, (uint8_t)value);
+  }
+  size_t putString(const char* key, const char* value) {
+    this->putBytes(key, value, strlen(value) + 1);
+    return strlen(value);
+  }
+  size_t putBytes(const char* key, const void* value, size_t length) {
+    if (!length)
+      return 0;
+    NvsEntry_t& entry = nvsStore()[key];
+    entry.value.assign((const uint8_t*)value, (const uint8_t*)value + length);
+    entry.writes++;
+    return length;
+  }
+
+  int32_t getInt(const char* key, int32_t fallback = 0) {
+    return get(key, fallback);
+  }
+  uint32_t getUInt(const char* key, uint32_t fallback = 0) {
+    return get(key, fallback);
+  }
+  uint8_t getUChar(const char* key, uint8_t fallback = 0) {
+    return get(key, fallback);
+  }
+  bool getBool(const char* key, bool fallback = false) {
+    return get(key, (uint8_t)fallback);
+  }
+  String getString(const char* key, const char* fallback = "") {
+    auto it = nvsStore().find(key);
+    if (it == nvsStore().end())
+      return String(fallback);
+    return String((const char*)it->second.value.data());
+  }
+  size_t getBytesLength(const char* key) {
+    auto it = nvsStore().find(key);
+    return it == nvsStore().end() ? 0 : it->second.value.size();
+  }
+  size_t getBytes(const char* key, void* buffer, size_t maxLength) {
+    auto it = nvsStore().find(key);
+    if (it == nvsStore().end() || it->second.value.size() > maxLength)
+      return 0;
+    memcpy(buffer, it->second.value.data(), it->second.value.size());
+    return it->second.value.size();
+  }
+
+ private:
+  template <typename T>
+  size_t put(const char* key, T value) {
+    return this->putBytes(key, &value, sizeof(value));
+  }
+  template <typename T>
+  T get(const char* key, T fallback) {
+    auto it = nvsStore().find(key);
+    if (it == nvsStore().end())
+      return fallback;
+    memcpy(&fallback, it->second.value.data(), sizeof(fallback));
+    return fallback;
+  }
+};
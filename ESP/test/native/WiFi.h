@@ -0,0 +1,9 @@
+#pragma once
+// Just what the config and the network helpers reach for on the host.
+#include "Arduino.h"
+
+class WiFiClass {
+ public:
+  bool disconnect(bool wifiOff = false, bool eraseAp = false) { return true; }
+};
+static WiFiClass WiFi;
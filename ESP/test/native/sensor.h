@@ -0,0 +1,10 @@
+#pragma once
+// The esp32-camera frame sizes, up to the ones the boards use.
+typedef enum {
+  FRAMESIZE_96X96,
+  FRAMESIZE_QQVGA,
+  FRAMESIZE_QCIF,
+  FRAMESIZE_HQVGA,
+  FRAMESIZE_240X240,
+  FRAMESIZE_QVGA,
+} framesize_t;
@@ -0,0 +1,62 @@
+#include <unity.h>
+#include "data/utilities/binaryLog.cpp"
+
+void setUp() {
+  binaryLog.clear();
+  binaryLog.setLevel(LOG_MODULE_STREAM, LOG_LEVEL_INFO);
+}
+void tearDown() {}
+
+static int evaluations;
+
+static int expensive() {
+  return ++evaluations;
+}
+
+void test_arguments_not_evaluated_below_level() {
+  evaluations = 0;
+  BLOG_D(LOG_MODULE_STREAM, "value %d", expensive());
+  TEST_ASSERT_EQUAL(0, evaluations);
+  BLOG_I(LOG_MODULE_STREAM, "value %d", expensive());
+  TEST_ASSERT_EQUAL(1, evaluations);
+}
+
+void test_levels_by_name() {
+  LogLevel_e level;
+  TEST_ASSERT_TRUE(BinaryLog::levelFromName("debug", &level));
+  TEST_ASSERT_EQUAL(LOG_LEVEL_DEBUG, level);
+  TEST_ASSERT_TRUE(BinaryLog::levelFromName("2", &level));
+  TEST_ASSERT_EQUAL(LOG_LEVEL_WARN, level);
+  LogModule_e module;
+  TEST_ASSERT_TRUE(BinaryLog::moduleFromName("wifi", &module));
+  TEST_ASSERT_EQUAL(LOG_MODULE_WIFI, module);
+  TEST_ASSERT_FALSE(BinaryLog::moduleFromName("nope", &module));
+}
+
+void test_ring_overwrites_the_oldest() {
+  binaryLog.setLevel(LOG_MODULE_STREAM, LOG_LEVEL_DEBUG);
+  // every record is 16 bytes of header plus 3 * 5 bytes of arguments
+  for (int i = 0; i < BINARY_LOG_SIZE / 31 + 10; i++)
+    BLOG_D(LOG_MODULE_STREAM, "Size: %uKB, Time: %ums (%ifps)", i, 16, 60);
+  TEST_ASSERT_GREATER_THAN(0, binaryLog.getDropped());
+}
+
+/**
+ * @brief The same benchmark the benchmark_log command runs on the device,
+ * nanoseconds here instead of cycles, run with
+ * `pio test -e native -f test_binary_log -v`
+ */
+void test_benchmark() {
+  StringPrint out;
+  binaryLog.benchmark(out, 1000000);
+  TEST_MESSAGE(out.text.c_str());
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_arguments_not_evaluated_below_level);
+  RUN_TEST(test_levels_by_name);
+  RUN_TEST(test_ring_overwrites_the_oldest);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,182 @@
+#include <unity.h>
+
+// the firmware gets these from the build flags in ini/dev_config.ini
+#define OTA_LOGIN "openiris"
+#define OTA_PASSWORD "12345678"
+#define CAM_RESOLUTION FRAMESIZE_240X240
+
+#include "data/StateManager/StateManager.cpp"
+#include "data/config/project_config.cpp"
+#include "data/utilities/helpers.cpp"
+#include "data/utilities/jsonWriter.cpp"
+
+/**
+ * @brief InlineString and the config structs persisted as blobs, saved to
+ * and loaded from the in-memory Preferences in test/native
+ */
+
+void setUp() {
+  nvsStore().clear();
+}
+void tearDown() {}
+
+void test_assign_and_truncate() {
+  InlineString<8> value("0123456789");
+  TEST_ASSERT_EQUAL(8, value.size());
+  TEST_ASSERT_EQUAL_STRING("01234567", value.c_str());
+
+  TEST_ASSERT_FALSE(value.assign("abcdefghi"));
+  TEST_ASSERT_EQUAL_STRING("abcdefgh", value.c_str());
+  TEST_ASSERT_TRUE(value.assign(std::string("12345678")));
+  TEST_ASSERT_EQUAL(8, value.size());
+
+  // a shorter value clears what the longer one left behind
+  TEST_ASSERT_TRUE(value.assign("abc"));
+  TEST_ASSERT_EQUAL(3, value.length());
+  const char* bytes = value.c_str();
+  for (size_t i = 3; i <= value.capacity(); i++)
+    TEST_ASSERT_EQUAL(0, bytes[i]);
+
+  value = (const char*)nullptr;
+  TEST_ASSERT_TRUE(value.empty());
+}
+
+void test_comparisons() {
+  InlineString<8> value("abc");
+  TEST_ASSERT_TRUE(value == "abc");
+  TEST_ASSERT_TRUE(value != "abcd");
+  TEST_ASSERT_TRUE(value != "ab");
+  TEST_ASSERT_TRUE(value == std::string("abc"));
+  TEST_ASSERT_TRUE(value != std::string("abc\0", 4));
+  TEST_ASSERT_TRUE(value != std::string("abd"));
+  TEST_ASSERT_TRUE(value == InlineString<32>("abc"));
+  TEST_ASSERT_TRUE(value != InlineString<32>("abcdefghij"));
+
+  InlineString<8> empty;
+  TEST_ASSERT_TRUE(empty == (const char*)nullptr);
+  TEST_ASSERT_TRUE(empty == "");
+  TEST_ASSERT_TRUE(empty == std::string());
+
+  InlineString<8> copy;
+  memcpy(&copy, &value, sizeof(value));
+  TEST_ASSERT_TRUE(copy == value);
+}
+
+static std::string storedJson(ProjectConfig& config) {
+  StringPrint out;
+  config.writeJson(out);
+  return out.text;
+}
+
+void test_blob_round_trip() {
+  std::string saved;
+  {
+    ProjectConfig config("openiris", "openiristracker");
+    config.load();
+    config.setDeviceConfig("admin", "hunter22", 4321, false);
+    config.setOTABandwidthShare(25, false);
+    config.setMDNSConfig("tracker1", "svc", false);
+    config.setAPWifiConfig("apname", "appassword", 3, false, false);
+    config.setWifiConfig("home", "HomeNet", "secret123", 6, 52, false, false);
+    config.setWifiConfig("work", "WorkNet", "", 11, 40, false, false);
+    config.save();
+    saved = storedJson(config);
+  }
+
+  TEST_ASSERT_EQUAL(sizeof(ProjectConfig::DeviceConfig_t),
+                    nvsStore()["device"].value.size());
+  // one version for the lot, not one write for every blob
+  TEST_ASSERT_EQUAL(1, nvsStore()["blobVersion"].writes);
+
+  ProjectConfig config("openiris", "openiristracker");
+  config.load();
+  TEST_ASSERT_EQUAL_STRING(saved.c_str(), storedJson(config).c_str());
+  TEST_ASSERT_EQUAL(2, config.getWifiConfigs().size());
+  TEST_ASSERT_TRUE(config.getWifiConfigs()[1].ssid == "WorkNet");
+  TEST_ASSERT_EQUAL(4321, config.getDeviceConfig().OTAPort);
+  TEST_ASSERT_EQUAL(25, config.getDeviceConfig().OTABandwidthShare);
+
+  // saving again writes the blobs, the version stays as it is
+  config.save();
+  TEST_ASSERT_EQUAL(2, nvsStore()["device"].writes);
+  TEST_ASSERT_EQUAL(1, nvsStore()["blobVersion"].writes);
+}
+
+void test_blob_padding_is_zeroed() {
+  // whatever was on the stack or in the config before, the padding of the
+  // blob written out is zero
+  ProjectConfig::DeviceConfig_t dirty;
+  memset(static_cast<void*>(&dirty), 0xA5, sizeof(dirty));
+  {
+    ProjectConfig config("openiris", "openiristracker");
+    memcpy(static_cast<void*>(&config.getDeviceConfig()), &dirty,
+           sizeof(dirty));
+    config.load();
+    config.save();
+  }
+
+  const std::vector<uint8_t>& blob = nvsStore()["device"].value;
+  typedef ProjectConfig::DeviceConfig_t Device_t;
+  size_t loginEnd = offsetof(Device_t, OTAPassword);
+  size_t passwordEnd = offsetof(Device_t, OTAPassword) +
+                       sizeof(InlineString<CONFIG_PASSWORD_LENGTH>);
+  size_t shareEnd = offsetof(Device_t, OTABandwidthShare) + 1;
+  for (size_t i = passwordEnd; i < offsetof(Device_t, OTAPort); i++)
+    TEST_ASSERT_EQUAL(0, blob[i]);
+  for (size_t i = shareEnd; i < sizeof(Device_t); i++)
+    TEST_ASSERT_EQUAL(0, blob[i]);
+  // and so is the rest of a short string
+  for (size_t i = strlen(OTA_LOGIN); i < loginEnd; i++)
+    TEST_ASSERT_EQUAL(0, blob[i]);
+}
+
+void test_legacy_keys_until_saved() {
+  // a config stored by a build before the blobs, a key per value
+  {
+    Preferences old;
+    old.putInt("networkCount", 1);
+    old.putString("name0", "home");
+    old.putString("ssid0", "HomeNet");
+    old.putString("pass0", "secret123");
+    old.putUInt("channel0", 6);
+    old.putUInt("txpower0", 52);
+    old.putString("hostname", "tracker1");
+    old.putString("OTALogin", "admin");
+    old.putInt("OTAPort", 1234);
+  }
+  {
+    ProjectConfig config("openiris", "openiristracker");
+    config.load();
+    TEST_ASSERT_EQUAL(1, config.getWifiConfigs().size());
+    TEST_ASSERT_TRUE(config.getWifiConfigs()[0].ssid == "HomeNet");
+    TEST_ASSERT_TRUE(config.getMDNSConfig().hostname == "tracker1");
+    TEST_ASSERT_EQUAL(1234, config.getDeviceConfig().OTAPort);
+    config.save();
+  }
+
+  // the blobs win over the old keys once saved
+  Preferences().putString("ssid0", "Stale");
+  {
+    ProjectConfig config("openiris", "openiristracker");
+    config.load();
+    TEST_ASSERT_TRUE(config.getWifiConfigs()[0].ssid == "HomeNet");
+  }
+
+  // blobs of another layout are ignored, back to the keys
+  Preferences().putUChar("blobVersion", CONFIG_BLOB_VERSION + 1);
+  {
+    ProjectConfig config("openiris", "openiristracker");
+    config.load();
+    TEST_ASSERT_TRUE(config.getWifiConfigs()[0].ssid == "Stale");
+  }
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_assign_and_truncate);
+  RUN_TEST(test_comparisons);
+  RUN_TEST(test_blob_round_trip);
+  RUN_TEST(test_blob_padding_is_zeroed);
+  RUN_TEST(test_legacy_keys_until_saved);
+  return UNITY_END();
+}
@@ -0,0 +1,250 @@
+#include <pthread.h>
+#include <unity.h>
+#include <chrono>
+#include <regex>
+#include <unordered_map>
+#include "network/api/controlRouter.hpp"
+
+/**
+ * @brief The control API's path parsing and route lookup, and what a
+ * dispatch costs compared to the std::regex route it replaced, run with
+ * `pio test -e native -f test_control_router -v` for the numbers
+ */
+
+typedef ControlRouter<int> Router;
+
+//! the builtin routes of APIServer::setupServer
+static const char* const COMMANDS[] = {
+    "wifi", "resetConfig", "setDevice", "rebootDevice", "getStoredConfig",
+    "setTxPower", "setRadioProfile", "radioSelfTest", "setCamera",
+    "restartCamera", "setFrameBuffers", "frameLatency", "frameStats",
+    "frameThumbnail", "setPupil", "setFrameSuppression", "frameSuppression",
+    "ping", "save", "wifiStrength", "trace", "memory", "log", "events",
+};
+#define COMMAND_COUNT (sizeof(COMMANDS) / sizeof(COMMANDS[0]))
+#define PREFIX "/control"
+
+static Router router;
+
+static Helpers::string_view view(const char* text) {
+  return Helpers::string_view(text, strlen(text));
+}
+
+static bool parse(const char* path, std::string* map, std::string* command) {
+  Helpers::string_view mapView;
+  Helpers::string_view commandView;
+  if (!Router::parsePath(view(path), view(PREFIX), &mapView, &commandView))
+    return false;
+  map->assign(mapView.data(), mapView.size());
+  command->assign(commandView.data(), commandView.size());
+  return true;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_parse_path() {
+  std::string map, command;
+  TEST_ASSERT_TRUE(parse("/control/builtin/command/ping", &map, &command));
+  TEST_ASSERT_EQUAL_STRING("builtin", map.c_str());
+  TEST_ASSERT_EQUAL_STRING("ping", command.c_str());
+  TEST_ASSERT_TRUE(parse("/control/b1/command/Set2", &map, &command));
+  TEST_ASSERT_EQUAL_STRING("b1", map.c_str());
+  TEST_ASSERT_EQUAL_STRING("Set2", command.c_str());
+}
+
+void test_parse_rejects_other_shapes() {
+  std::string map, command;
+  const char* const rejected[] = {
+      // trailing slash
+      "/control/builtin/command/ping/",
+      // empty segments
+      "/control//command/ping",
+      "/control/builtin/command/",
+      "/control/builtin//command/ping",
+      "/control/",
+      "/control",
+      "",
+      // not just letters and digits
+      "/control/built-in/command/ping",
+      "/control/builtin/command/ping?x=1",
+      "/control/builtin/command/pi%20ng",
+      "/control/builtin/command/../ping",
+      "/control/builtin/command/ping pong",
+      // the prefix has to be a whole segment
+      "/controls/builtin/command/ping",
+      "/other/builtin/command/ping",
+      "/control/builtin/commands/ping",
+      "/control/builtin/ping",
+      "control/builtin/command/ping",
+  };
+  for (const char* path : rejected)
+    TEST_ASSERT_FALSE_MESSAGE(parse(path, &map, &command), path);
+}
+
+void test_find() {
+  bool mapFound = false;
+  const Router::Route_t* route =
+      router.find(view("builtin"), view("setFrameSuppression"), &mapFound);
+  TEST_ASSERT_NOT_NULL(route);
+  TEST_ASSERT_TRUE(mapFound);
+  TEST_ASSERT_EQUAL_STRING("setFrameSuppression", route->command.c_str());
+  TEST_ASSERT_EQUAL(15, route->handler);
+
+  // every route of every map is found, in either map
+  for (size_t i = 0; i < COMMAND_COUNT; i++) {
+    route = router.find(view("builtin"), view(COMMANDS[i]), &mapFound);
+    TEST_ASSERT_NOT_NULL_MESSAGE(route, COMMANDS[i]);
+    TEST_ASSERT_EQUAL(i, route->handler);
+    route = router.find(view("extra"), view(COMMANDS[i]), &mapFound);
+    TEST_ASSERT_NOT_NULL_MESSAGE(route, COMMANDS[i]);
+    TEST_ASSERT_EQUAL(100 + i, route->handler);
+  }
+}
+
+void test_unknown_map_or_command() {
+  bool mapFound = true;
+  // unknown map, sorting before, between and after the known ones
+  for (const char* map : {"aaa", "c", "zzz", "builtinx", "buil"}) {
+    TEST_ASSERT_NULL(router.find(view(map), view("ping"), &mapFound));
+    TEST_ASSERT_FALSE_MESSAGE(mapFound, map);
+  }
+  // known map, unknown command - the other map's command doesn't leak in
+  for (const char* command : {"aaa", "zzz", "pin", "pingx", "extraOnly"}) {
+    TEST_ASSERT_NULL(router.find(view("builtin"), view(command), &mapFound));
+    TEST_ASSERT_TRUE_MESSAGE(mapFound, command);
+  }
+  TEST_ASSERT_NOT_NULL(
+      router.find(view("extra"), view("extraOnly"), &mapFound));
+  // case matters
+  TEST_ASSERT_NULL(router.find(view("builtin"), view("Ping"), &mapFound));
+  TEST_ASSERT_TRUE(mapFound);
+}
+
+//! the dispatch the router replaced, as APIServer had it
+struct RegexDispatch {
+  RegexDispatch()
+      : pattern("^\\" PREFIX "\\/([a-zA-Z0-9]+)\\/command\\/([a-zA-Z0-9]+)$") {
+    for (size_t i = 0; i < COMMAND_COUNT; i++)
+      maps["builtin"].emplace(COMMANDS[i], i);
+  }
+  int dispatch(const std::string& url) {
+    std::smatch match;
+    if (!std::regex_match(url, match, pattern))
+      return -1;
+    auto map = maps.find(match[1]);
+    if (map == maps.end())
+      return -1;
+    auto command = map->second.find(match[2]);
+    return command == map->second.end() ? -1 : command->second;
+  }
+
+  std::regex pattern;
+  std::unordered_map<std::string, std::unordered_map<std::string, int>> maps;
+};
+
+static const char* BENCHMARK_PATH =
+    PREFIX "/builtin/command/setFrameSuppression";
+
+static int routerDispatch() {
+  Helpers::string_view map;
+  Helpers::string_view command;
+  bool mapFound;
+  if (!Router::parsePath(view(BENCHMARK_PATH), view(PREFIX), &map, &command))
+    return -1;
+  const Router::Route_t* route = router.find(map, command, &mapFound);
+  return route ? route->handler : -1;
+}
+
+static RegexDispatch* regexDispatch;
+
+static int regexDispatchOnce() {
+  // the URL comes in as a String and gets matched as one
+  return regexDispatch->dispatch(std::string(BENCHMARK_PATH));
+}
+
+template <typename Dispatch>
+static double nanosPerDispatch(Dispatch dispatch) {
+  const int iterations = 200000;
+  volatile int sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++)
+    sink = sink + dispatch();
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start);
+  return (double)elapsed.count() / iterations;
+}
+
+#define STACK_SIZE (256 * 1024)
+#define STACK_PAINT 0xA5
+
+struct StackRun_t {
+  int (*dispatch)();
+  int result;
+};
+
+static void* runDispatch(void* argument) {
+  StackRun_t* run = static_cast<StackRun_t*>(argument);
+  run->result = run->dispatch();
+  return nullptr;
+}
+
+//! bytes of a painted thread stack the dispatch wrote to, like the high
+//! water mark of a FreeRTOS task
+static size_t stackUsed(int (*dispatch)()) {
+  uint8_t* stack = (uint8_t*)aligned_alloc(4096, STACK_SIZE);
+  memset(stack, STACK_PAINT, STACK_SIZE);
+  pthread_attr_t attributes;
+  pthread_attr_init(&attributes);
+  pthread_attr_setstack(&attributes, stack, STACK_SIZE);
+  StackRun_t run = {dispatch, -1};
+  pthread_t thread;
+  pthread_create(&thread, &attributes, runDispatch, &run);
+  pthread_join(thread, nullptr);
+  pthread_attr_destroy(&attributes);
+
+  // the stack grows down, from the end of the block
+  size_t untouched = 0;
+  while (untouched < STACK_SIZE && stack[untouched] == STACK_PAINT)
+    untouched++;
+  free(stack);
+  TEST_ASSERT_EQUAL(15, run.result);
+  return STACK_SIZE - untouched;
+}
+
+void test_benchmark() {
+  RegexDispatch regex;
+  regexDispatch = &regex;
+  TEST_ASSERT_EQUAL(15, routerDispatch());
+  TEST_ASSERT_EQUAL(15, regexDispatchOnce());
+
+  // a bare thread's own frames, taken off both
+  size_t baseline = stackUsed([] { return 15; });
+  char message[160];
+  snprintf(message, sizeof(message),
+           "%s against %u routes: table %.2f us, %u B of stack - regex %.2f "
+           "us, %u B of stack",
+           BENCHMARK_PATH, (unsigned)router.size(),
+           nanosPerDispatch(routerDispatch) / 1000.0,
+           (unsigned)(stackUsed(routerDispatch) - baseline),
+           nanosPerDispatch(regexDispatchOnce) / 1000.0,
+           (unsigned)(stackUsed(regexDispatchOnce) - baseline));
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv) {
+  for (size_t i = 0; i < COMMAND_COUNT; i++) {
+    router.add("builtin", COMMANDS[i], i);
+    router.add("extra", COMMANDS[i], 100 + i);
+  }
+  router.add("extra", "extraOnly", 200);
+  router.sort();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_parse_path);
+  RUN_TEST(test_parse_rejects_other_shapes);
+  RUN_TEST(test_find);
+  RUN_TEST(test_unknown_map_or_command);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
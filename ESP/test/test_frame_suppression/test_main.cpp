@@ -0,0 +1,143 @@
+#include <unity.h>
+#include "data/utilities/jsonWriter.cpp"
+#include "io/camera/frameSuppression.cpp"
+
+/**
+ * @brief Feeds synthetic frames - a JPEG size and a DC brightness grid, all
+ * the detector looks at - through FrameChangeDetector
+ */
+
+#define FRAME_LEN 20000
+
+static FrameChangeDetector detector;
+static camera_fb_t fb;
+static FrameStats_t stats;
+static uint32_t sequence;
+
+static void configure(uint8_t sizeDelta,
+                      uint8_t dcDelta,
+                      uint16_t maxKeyframeInterval) {
+  frameSuppression.configure({
+      .enabled = true,
+      .sizeDelta = sizeDelta,
+      .dcDelta = dcDelta,
+      .maxKeyframeInterval = maxKeyframeInterval,
+  });
+}
+
+//! a flat grid with one cell off by delta, the frame len bytes long
+static bool feed(size_t len, int cellDelta = 0, int cell = 0) {
+  memset(stats.grid, 100, sizeof(stats.grid));
+  stats.grid[cell] = 100 + cellDelta;
+  stats.valid = true;
+  fb.len = len;
+  return detector.isUnchanged(&fb, ++sequence, &stats);
+}
+
+void setUp() {
+  detector.reset();
+  frameSuppression.resetCounters();
+  configure(3, 4, 0);
+  fb = {};
+  fb.format = PIXFORMAT_JPEG;
+  stats = {};
+  sequence = 0;
+}
+void tearDown() {}
+
+void test_first_frame_is_sent() {
+  TEST_ASSERT_FALSE(feed(FRAME_LEN));
+  TEST_ASSERT_EQUAL(1, detector.getReferenceSequence());
+  TEST_ASSERT_TRUE(feed(FRAME_LEN));
+}
+
+void test_size_threshold() {
+  feed(FRAME_LEN);
+  // 3% of 20000 is 600 bytes, up to it is the same frame
+  TEST_ASSERT_TRUE(feed(FRAME_LEN + 600));
+  TEST_ASSERT_TRUE(feed(FRAME_LEN - 600));
+  TEST_ASSERT_FALSE(feed(FRAME_LEN + 601));
+  // the frame just sent is the reference now
+  TEST_ASSERT_EQUAL(4, detector.getReferenceSequence());
+  TEST_ASSERT_TRUE(feed(FRAME_LEN + 601));
+}
+
+void test_dc_threshold() {
+  feed(FRAME_LEN);
+  TEST_ASSERT_TRUE(feed(FRAME_LEN, 4, 17));
+  TEST_ASSERT_TRUE(feed(FRAME_LEN, -4, FRAME_STATS_GRID_CELLS - 1));
+  TEST_ASSERT_FALSE(feed(FRAME_LEN, 5, FRAME_STATS_GRID_CELLS - 1));
+  TEST_ASSERT_FALSE(feed(FRAME_LEN, -1, 0));
+}
+
+void test_slow_drift_gets_through() {
+  feed(FRAME_LEN);
+  // every frame is within the threshold of the one before, but compared to
+  // the last one sent the drift adds up
+  int sent = 0;
+  for (int delta = 1; delta <= 12; delta++)
+    sent += !feed(FRAME_LEN, delta);
+  TEST_ASSERT_EQUAL(2, sent);
+}
+
+void test_forced_keyframes() {
+  configure(3, 4, 5);
+  TEST_ASSERT_FALSE(feed(FRAME_LEN));
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 4; i++)
+      TEST_ASSERT_TRUE(feed(FRAME_LEN));
+    TEST_ASSERT_FALSE(feed(FRAME_LEN));
+    TEST_ASSERT_EQUAL(sequence, detector.getReferenceSequence());
+  }
+  TEST_ASSERT_EQUAL(3, frameSuppression.getCounters().keyframes_forced);
+
+  // a changed frame restarts the interval
+  for (int i = 0; i < 2; i++)
+    TEST_ASSERT_TRUE(feed(FRAME_LEN));
+  TEST_ASSERT_FALSE(feed(FRAME_LEN, 10));
+  for (int i = 0; i < 4; i++)
+    TEST_ASSERT_TRUE(feed(FRAME_LEN, 10));
+  TEST_ASSERT_FALSE(feed(FRAME_LEN, 10));
+  TEST_ASSERT_EQUAL(4, frameSuppression.getCounters().keyframes_forced);
+}
+
+void test_reference_reset() {
+  feed(FRAME_LEN);
+  TEST_ASSERT_TRUE(feed(FRAME_LEN));
+  // e.g. a client reconnected, it has no frame to keep showing
+  detector.reset();
+  TEST_ASSERT_FALSE(feed(FRAME_LEN));
+  TEST_ASSERT_EQUAL(sequence, detector.getReferenceSequence());
+  TEST_ASSERT_TRUE(feed(FRAME_LEN));
+}
+
+void test_frames_without_stats_are_sent() {
+  feed(FRAME_LEN);
+  TEST_ASSERT_FALSE(detector.isUnchanged(&fb, ++sequence, nullptr));
+  // and leave no grid to compare with, the next one becomes the reference
+  TEST_ASSERT_FALSE(feed(FRAME_LEN));
+  TEST_ASSERT_TRUE(feed(FRAME_LEN));
+}
+
+void test_disabled_sends_everything() {
+  frameSuppression.configure({.enabled = false});
+  for (int i = 0; i < 10; i++)
+    TEST_ASSERT_FALSE(feed(FRAME_LEN));
+  // turning it back on starts over from a fresh reference
+  configure(3, 4, 0);
+  TEST_ASSERT_FALSE(feed(FRAME_LEN));
+  TEST_ASSERT_TRUE(feed(FRAME_LEN));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_first_frame_is_sent);
+  RUN_TEST(test_size_threshold);
+  RUN_TEST(test_dc_threshold);
+  RUN_TEST(test_slow_drift_gets_through);
+  RUN_TEST(test_forced_keyframes);
+  RUN_TEST(test_reference_reset);
+  RUN_TEST(test_frames_without_stats_are_sent);
+  RUN_TEST(test_disabled_sends_everything);
+  return UNITY_END();
+}
@@ -0,0 +1,708 @@
+// generated by make_fixtures.py, do not edit
+#pragma once
+#include <stdint.h>
+
+#define FIXTURE_SIZE 240
+
+static const uint8_t EYE_420[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x0a, 0x07, 0x07, 0x08, 0x07, 0x06, 0x0a,
+    0x08, 0x08, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x0e, 0x18, 0x10, 0x0e, 0x0d, 0x0d, 0x0e, 0x1d, 0x15,
+    0x16, 0x11, 0x18, 0x23, 0x1f, 0x25, 0x24, 0x22, 0x1f, 0x22, 0x21, 0x26, 0x2b, 0x37, 0x2f, 0x26,
+    0x29, 0x34, 0x29, 0x21, 0x22, 0x30, 0x41, 0x31, 0x34, 0x39, 0x3b, 0x3e, 0x3e, 0x3e, 0x25, 0x2e,
+    0x44, 0x49, 0x43, 0x3c, 0x48, 0x37, 0x3d, 0x3e, 0x3b, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x0a, 0x0b,
+    0x0b, 0x0e, 0x0d, 0x0e, 0x1c, 0x10, 0x10, 0x1c, 0x3b, 0x28, 0x22, 0x28, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0xf0, 0x00, 0xf0, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xc1,
+    0x03, 0xde, 0x9f, 0xd7, 0xa5, 0x00, 0x0a, 0x50, 0x3d, 0x28, 0x01, 0x40, 0xe2, 0x9c, 0x3a, 0x62,
+    0x90, 0x0e, 0x29, 0xea, 0x28, 0x01, 0x00, 0xa7, 0x8a, 0x41, 0xcd, 0x3d, 0x79, 0x34, 0x00, 0x01,
+    0xce, 0x69, 0xdd, 0xe8, 0xc0, 0xa7, 0x0f, 0xa5, 0x00, 0x28, 0x18, 0xa7, 0x01, 0x48, 0x33, 0x4e,
+    0x02, 0x80, 0x16, 0x9d, 0xde, 0x90, 0x67, 0x14, 0xe0, 0x0d, 0x00, 0x38, 0x52, 0x81, 0x40, 0x53,
+    0x9a, 0x5c, 0x63, 0x8a, 0x00, 0x55, 0x18, 0x3c, 0x53, 0x80, 0xc9, 0xa4, 0x14, 0xe1, 0x9a, 0x00,
+    0x70, 0xa7, 0x01, 0x8a, 0x40, 0x31, 0x4e, 0x02, 0x80, 0x14, 0x74, 0xa7, 0x01, 0xdc, 0xd2, 0x0a,
+    0x78, 0xe6, 0x80, 0x0e, 0xb4, 0xe0, 0x38, 0xa0, 0x0a, 0x77, 0x53, 0x40, 0x00, 0x14, 0xec, 0x71,
+    0x8a, 0x07, 0x1c, 0x53, 0x85, 0x00, 0x2a, 0x8f, 0xc2, 0x9c, 0x07, 0x6c, 0x53, 0x40, 0xe7, 0x35,
+    0x20, 0xe9, 0x40, 0x00, 0x18, 0xa7, 0x01, 0x48, 0x07, 0xbd, 0x38, 0x0e, 0x68, 0x01, 0xcb, 0xc0,
+    0xa5, 0x03, 0x8a, 0x05, 0x38, 0x71, 0x40, 0x1c, 0x10, 0x19, 0xa7, 0x8e, 0x38, 0xa4, 0x14, 0xfa,
+    0x00, 0x31, 0x8e, 0x94, 0xaa, 0x0f, 0xad, 0x00, 0x53, 0xc0, 0xc5, 0x00, 0x00, 0x0a, 0x70, 0xa0,
+    0x53, 0x85, 0x00, 0x18, 0xa7, 0x2a, 0xe3, 0xbd, 0x00, 0x7a, 0xd3, 0x81, 0x14, 0x00, 0xa0, 0x77,
+    0xa7, 0x01, 0x42, 0x8a, 0x77, 0xb5, 0x00, 0x1d, 0x3a, 0x53, 0x80, 0xe6, 0x90, 0x70, 0x69, 0xc2,
+    0x80, 0x14, 0x53, 0x87, 0x3d, 0x69, 0x05, 0x3d, 0x45, 0x00, 0x28, 0x14, 0xef, 0xc2, 0x92, 0x9d,
+    0xcd, 0x00, 0x28, 0x1e, 0xf4, 0xec, 0x52, 0x01, 0x4f, 0x5e, 0x78, 0xa0, 0x01, 0x57, 0xde, 0x9c,
+    0x06, 0x38, 0xa4, 0xc7, 0xa5, 0x3f, 0x1e, 0xb4, 0x00, 0x28, 0xa7, 0x0a, 0x40, 0x38, 0xa7, 0x81,
+    0xcd, 0x00, 0x28, 0x14, 0xe1, 0x49, 0x8c, 0x53, 0x80, 0xe3, 0x83, 0x40, 0x00, 0x18, 0xa7, 0x8a,
+    0x41, 0x91, 0x4e, 0x00, 0xd0, 0x02, 0xa8, 0xe6, 0x9c, 0x29, 0x00, 0xef, 0x4f, 0x03, 0x9a, 0x00,
+    0x3e, 0xb4, 0xec, 0x52, 0x77, 0xa7, 0x50, 0x07, 0x09, 0x81, 0x4e, 0x5e, 0xb4, 0x98, 0xa7, 0x01,
+    0x40, 0x0b, 0x83, 0x4e, 0x02, 0x90, 0x75, 0xa7, 0xf6, 0xa0, 0x02, 0x9e, 0xb4, 0x83, 0x9a, 0x70,
+    0x1c, 0xd0, 0x00, 0x29, 0xc0, 0x60, 0xd0, 0x29, 0xd8, 0x34, 0x00, 0x01, 0xcd, 0x3c, 0x0c, 0x9a,
+    0x41, 0x4e, 0x03, 0x3c, 0xd0, 0x02, 0x81, 0x4e, 0xa0, 0x53, 0x85, 0x00, 0x03, 0x38, 0xa7, 0x2f,
+    0x4e, 0x68, 0xed, 0x4e, 0x03, 0x34, 0x00, 0x01, 0xc7, 0x14, 0xf0, 0x05, 0x20, 0x03, 0x14, 0xf0,
+    0x31, 0x40, 0x02, 0xf4, 0xa7, 0x01, 0xde, 0x90, 0x7d, 0x29, 0xe0, 0x50, 0x00, 0x29, 0xfb, 0x73,
+    0x48, 0x05, 0x38, 0x75, 0xa0, 0x05, 0x51, 0x8e, 0x29, 0xc0, 0x52, 0x01, 0x4e, 0x03, 0x26, 0x80,
+    0x01, 0x4f, 0x00, 0x52, 0x05, 0xa7, 0x28, 0x34, 0x00, 0xa0, 0x53, 0x80, 0xc1, 0xa4, 0xe6, 0x9e,
+    0x0e, 0x47, 0x34, 0x00, 0xbf, 0x4a, 0x51, 0xd6, 0x91, 0x47, 0x14, 0xec, 0x50, 0x03, 0xb1, 0x4b,
+    0xd3, 0xb5, 0x03, 0xa5, 0x38, 0x50, 0x07, 0x06, 0x3a, 0xd3, 0x86, 0x29, 0x00, 0xed, 0x4e, 0x14,
+    0x00, 0xa0, 0x53, 0x80, 0xe2, 0x81, 0xe9, 0x4e, 0x00, 0x7a, 0x50, 0x02, 0x8a, 0x5c, 0x50, 0x07,
+    0x34, 0xec, 0x64, 0x73, 0x40, 0x0a, 0xa2, 0x9d, 0x8e, 0x29, 0x00, 0xc0, 0xa7, 0x01, 0x40, 0x0b,
+    0x8a, 0x70, 0xc7, 0x6a, 0x40, 0x3f, 0x1a, 0x7f, 0x1d, 0xa8, 0x00, 0xc7, 0xa5, 0x38, 0x0a, 0x05,
+    0x39, 0x7d, 0xa8, 0x00, 0x14, 0xfe, 0xdd, 0x29, 0x29, 0xc0, 0x50, 0x00, 0x05, 0x3c, 0x66, 0x8c,
+    0x73, 0x9a, 0x70, 0xa0, 0x00, 0x0c, 0xd3, 0x80, 0x18, 0xa0, 0x01, 0x9a, 0x70, 0xa0, 0x00, 0x7b,
+    0xd3, 0xc7, 0x34, 0x98, 0xa7, 0x2d, 0x00, 0x0b, 0x4f, 0x14, 0x80, 0x53, 0x87, 0x34, 0x00, 0xb4,
+    0xe0, 0x0d, 0x18, 0xf6, 0xa7, 0x01, 0x40, 0x0a, 0x3d, 0x31, 0x4a, 0x33, 0x8a, 0x05, 0x38, 0x0a,
+    0x00, 0x00, 0x34, 0xe1, 0xef, 0x40, 0xc5, 0x28, 0xe2, 0x80, 0x1c, 0x05, 0x3a, 0x81, 0x4a, 0x39,
+    0xa0, 0x0e, 0x0c, 0x0a, 0x78, 0xe9, 0x4d, 0xef, 0xc5, 0x3d, 0x7d, 0xe8, 0x00, 0x03, 0xde, 0x9c,
+    0x28, 0x03, 0x8a, 0x70, 0x14, 0x00, 0x01, 0x4f, 0x02, 0x90, 0x0c, 0x53, 0x80, 0xa0, 0x05, 0x03,
+    0x9a, 0x78, 0xe6, 0x91, 0x47, 0x34, 0xe0, 0x28, 0x00, 0x00, 0x8a, 0x70, 0x14, 0x01, 0xf9, 0xd4,
+    0xf0, 0xda, 0xc9, 0x2f, 0x41, 0x81, 0xef, 0x40, 0x11, 0x62, 0x9c, 0x05, 0x5f, 0x8f, 0x4f, 0x51,
+    0xcb, 0xb6, 0x6a, 0xc2, 0xdb, 0xc4, 0xa3, 0x85, 0x14, 0x01, 0x98, 0xa8, 0xcd, 0xc0, 0x52, 0x6a,
+    0x55, 0x82, 0x46, 0xe3, 0x69, 0xe2, 0xb4, 0x82, 0x81, 0xd0, 0x0a, 0x28, 0x02, 0x80, 0xb6, 0x94,
+    0x76, 0xa5, 0xfb, 0x3c, 0x9e, 0x95, 0x7e, 0x8a, 0x00, 0xa3, 0xe4, 0xb2, 0xf5, 0x5a, 0x36, 0x11,
+    0xda, 0xaf, 0x52, 0x60, 0x7a, 0x50, 0x05, 0x40, 0x29, 0x40, 0xab, 0x25, 0x14, 0xf6, 0xa4, 0x31,
+    0x8c, 0x71, 0xc5, 0x00, 0x44, 0x07, 0x14, 0xa0, 0x53, 0xb6, 0x15, 0xa0, 0x70, 0x68, 0x01, 0x40,
+    0xa7, 0x01, 0xef, 0x40, 0xe2, 0x9d, 0x40, 0x0b, 0x8f, 0x4a, 0x76, 0x31, 0x48, 0x38, 0x14, 0xe5,
+    0xe4, 0x50, 0x02, 0x8c, 0x53, 0x87, 0x5e, 0x94, 0x80, 0x73, 0x4f, 0x02, 0x80, 0x0e, 0xb4, 0xe5,
+    0x02, 0x92, 0xa4, 0x03, 0xd6, 0x80, 0x38, 0x10, 0x29, 0xd4, 0x63, 0x9e, 0x94, 0xe1, 0x40, 0x06,
+    0x38, 0xa7, 0xa8, 0xe2, 0x90, 0x53, 0x80, 0xf7, 0xa0, 0x05, 0x02, 0x9c, 0x38, 0xa4, 0xa7, 0x81,
+    0x9a, 0x00, 0x05, 0x4f, 0x0d, 0xbc, 0x92, 0x90, 0x14, 0x71, 0xeb, 0x4e, 0xb5, 0xb4, 0x33, 0x36,
+    0x4f, 0xdd, 0x1d, 0xeb, 0x5d, 0x23, 0x58, 0xd4, 0x2a, 0x8c, 0x50, 0x04, 0x30, 0x59, 0x24, 0x5c,
+    0xb7, 0xcc, 0x6a, 0xc0, 0x00, 0x74, 0x14, 0xb4, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x15,
+    0x9b, 0xa9, 0x6b, 0xd6, 0x1a, 0x62, 0x13, 0x34, 0xc3, 0x70, 0xfe, 0x10, 0x79, 0xa0, 0x0d, 0x2a,
+    0x2b, 0x8a, 0xb8, 0xf8, 0x87, 0x0a, 0xbe, 0x20, 0xb6, 0x2c, 0xbe, 0xa4, 0xe2, 0x9b, 0x0f, 0xc4,
+    0x48, 0xcc, 0x80, 0x4b, 0x6a, 0x55, 0x7b, 0x90, 0x68, 0x03, 0xb7, 0xa2, 0xb1, 0xf4, 0xcf, 0x13,
+    0x69, 0xda, 0x98, 0x02, 0x39, 0x42, 0x3f, 0xf7, 0x5b, 0x83, 0x5a, 0xe0, 0x82, 0x32, 0x28, 0x01,
+    0x68, 0xa2, 0x8a, 0x00, 0x29, 0x30, 0x29, 0x68, 0xa0, 0x03, 0x8a, 0x72, 0x8c, 0xd3, 0x69, 0xca,
+    0x68, 0x01, 0x47, 0x5e, 0x29, 0xe2, 0x90, 0x74, 0xa7, 0x62, 0x80, 0x01, 0xd6, 0x9e, 0xbc, 0xd0,
+    0x05, 0x38, 0x0f, 0x4a, 0x00, 0x00, 0xa7, 0xe0, 0x8a, 0x41, 0xf4, 0xa7, 0x0e, 0x68, 0x03, 0x83,
+    0xa7, 0x0a, 0x4a, 0x72, 0x8a, 0x00, 0x31, 0x4e, 0x5e, 0x94, 0xa0, 0x52, 0x81, 0x40, 0x0a, 0x05,
+    0x58, 0xb5, 0x80, 0xcd, 0x2e, 0x3b, 0x77, 0xa8, 0x46, 0x6b, 0x5b, 0x4f, 0x8b, 0x64, 0x3b, 0x8f,
+    0x56, 0xa0, 0x0b, 0x31, 0xc6, 0xb1, 0xa8, 0x55, 0x18, 0x02, 0x9f, 0x45, 0x14, 0x00, 0x51, 0x45,
+    0x14, 0x00, 0x51, 0x45, 0x66, 0x6b, 0xda, 0x92, 0xe9, 0x9a, 0x5c, 0xb3, 0x13, 0x86, 0xc6, 0x17,
+    0xeb, 0x40, 0x18, 0x9e, 0x2b, 0xf1, 0x5b, 0x69, 0xcd, 0xf6, 0x4b, 0x4c, 0x19, 0x08, 0xf9, 0x9b,
+    0xd2, 0xbc, 0xf6, 0x7b, 0x89, 0x6e, 0x24, 0x32, 0x4a, 0xe5, 0x98, 0x9c, 0x92, 0x4d, 0x17, 0x13,
+    0xbd, 0xc4, 0xed, 0x2c, 0x8c, 0x59, 0x98, 0xe7, 0x26, 0xa3, 0xa0, 0x02, 0xac, 0xe9, 0xba, 0x7d,
+    0xc6, 0xa9, 0x7d, 0x1d, 0xa5, 0xb2, 0x17, 0x92, 0x43, 0x80, 0x05, 0x56, 0xad, 0xaf, 0x09, 0x6b,
+    0x11, 0xe8, 0x7e, 0x21, 0xb7, 0xbe, 0x95, 0x77, 0x22, 0x1e, 0x68, 0x03, 0xb3, 0x9b, 0xe1, 0x0d,
+    0xfd, 0xae, 0x99, 0xf6, 0xa8, 0x2f, 0x33, 0x72, 0xab, 0xbb, 0xcb, 0x03, 0xbd, 0x51, 0xf0, 0xef,
+    0x89, 0xae, 0x22, 0xbd, 0xfe, 0xca, 0xd4, 0x86, 0xd7, 0x43, 0xb7, 0x71, 0xeb, 0x9a, 0xf4, 0xeb,
+    0xaf, 0x1e, 0x68, 0x50, 0xe9, 0x2d, 0x76, 0x2f, 0x23, 0x73, 0xb3, 0x22, 0x30, 0x79, 0xfa, 0x57,
+    0x80, 0x6a, 0xba, 0x87, 0xdb, 0xb5, 0x89, 0xef, 0xa3, 0x05, 0x3c, 0xc9, 0x0b, 0x0f, 0x6a, 0x00,
+    0xf6, 0x50, 0x41, 0x19, 0x1d, 0x29, 0x6b, 0x07, 0xc2, 0x5a, 0xb0, 0xd4, 0xb4, 0xa5, 0x0e, 0xd9,
+    0x92, 0x3e, 0x1a, 0xb7, 0xa8, 0x00, 0xa2, 0x8a, 0x28, 0x00, 0xa2, 0x8a, 0x28, 0x02, 0x48, 0xce,
+    0x45, 0x4b, 0x8e, 0x6a, 0xba, 0x1c, 0x30, 0xab, 0x22, 0x80, 0x14, 0x0a, 0x70, 0x14, 0x01, 0xef,
+    0x4e, 0x02, 0x80, 0x00, 0x29, 0xea, 0x29, 0x00, 0xcd, 0x38, 0x74, 0xc0, 0xa0, 0x0e, 0x0c, 0x0c,
+    0x9a, 0x70, 0x00, 0x76, 0xa4, 0x03, 0x1d, 0xe9, 0xc3, 0xa7, 0x14, 0x00, 0xbd, 0x69, 0xc0, 0x50,
+    0x29, 0xc0, 0x50, 0x03, 0x91, 0x41, 0x60, 0x2b, 0x72, 0x25, 0x0b, 0x1a, 0x81, 0xd8, 0x56, 0x24,
+    0x7c, 0x30, 0x35, 0xb9, 0x19, 0x0d, 0x1a, 0x91, 0xe9, 0x40, 0x0e, 0xa2, 0x8a, 0x28, 0x00, 0xa2,
+    0x8a, 0x28, 0x00, 0xae, 0x2b, 0xe2, 0x1d, 0xc3, 0x2d, 0xb4, 0x10, 0x0f, 0xba, 0xc7, 0x26, 0xbb,
+    0x5a, 0xe2, 0x3e, 0x22, 0x42, 0xed, 0x0d, 0xbc, 0xa0, 0x7c, 0xaa, 0x48, 0x26, 0x80, 0x38, 0x2a,
+    0x28, 0xa2, 0x80, 0x0a, 0x28, 0xa2, 0x80, 0x0d, 0xc7, 0x18, 0xc9, 0xc5, 0x14, 0x51, 0x40, 0x1d,
+    0x8f, 0xc3, 0xdb, 0x86, 0x5b, 0xe9, 0xa0, 0x1f, 0x75, 0x97, 0x35, 0xe8, 0x75, 0xe7, 0x5f, 0x0f,
+    0xa1, 0x76, 0xd4, 0x65, 0x94, 0x0f, 0x95, 0x57, 0x04, 0xd7, 0xa2, 0xd0, 0x01, 0x45, 0x14, 0x50,
+    0x01, 0x45, 0x14, 0x50, 0x01, 0x56, 0xd3, 0x95, 0x06, 0xaa, 0x55, 0xc4, 0x18, 0x51, 0xf4, 0xa0,
+    0x07, 0x01, 0x4e, 0x02, 0x85, 0xa5, 0xc5, 0x00, 0x38, 0x0c, 0x77, 0xa7, 0x01, 0x9e, 0x69, 0x05,
+    0x3d, 0x68, 0x03, 0x81, 0x03, 0xd2, 0x9e, 0x06, 0x3a, 0x8a, 0x40, 0x29, 0xf4, 0x00, 0x01, 0x9e,
+    0x94, 0xfa, 0x40, 0x30, 0x29, 0xc3, 0xa5, 0x00, 0x02, 0xb5, 0xac, 0xe4, 0xdf, 0x08, 0x1d, 0xc5,
+    0x65, 0x8c, 0xe6, 0xac, 0x5b, 0x4c, 0x62, 0x90, 0x7a, 0x1e, 0xb4, 0x01, 0xa9, 0x45, 0x20, 0x21,
+    0x86, 0x45, 0x2d, 0x00, 0x14, 0x51, 0x45, 0x00, 0x15, 0x8f, 0xe2, 0x6d, 0x30, 0x6a, 0x7a, 0x4c,
+    0x91, 0x81, 0xf3, 0xa8, 0xdc, 0xb5, 0xb1, 0x48, 0x46, 0x46, 0x0d, 0x00, 0x78, 0x74, 0x91, 0xb4,
+    0x52, 0x32, 0x30, 0xc1, 0x53, 0x83, 0x4d, 0xae, 0xeb, 0xc5, 0xde, 0x15, 0x92, 0x59, 0x8d, 0xed,
+    0x8c, 0x60, 0xe4, 0x65, 0xd4, 0x57, 0x0c, 0xe8, 0xc8, 0xc5, 0x58, 0x10, 0x47, 0x50, 0x68, 0x01,
+    0x28, 0xa2, 0x8a, 0x00, 0x28, 0x00, 0x93, 0x81, 0xd4, 0xd0, 0x01, 0x27, 0x00, 0x64, 0xd7, 0x5d,
+    0xe1, 0x5f, 0x0a, 0xcd, 0x3d, 0xca, 0x5d, 0xdd, 0xc7, 0x88, 0x47, 0x20, 0x1e, 0xf4, 0x01, 0xd1,
+    0x78, 0x2f, 0x49, 0x36, 0x1a, 0x60, 0x99, 0xc6, 0x24, 0x9b, 0x93, 0xf4, 0xae, 0x92, 0x9a, 0xaa,
+    0xa8, 0xa1, 0x54, 0x60, 0x0e, 0x82, 0x9d, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x0e, 0x8d, 0x77, 0x38, 0x15, 0x75, 0x46, 0x38, 0xa8, 0xa0, 0x8f, 0x68, 0xdc, 0x7a, 0x9a, 0x9c,
+    0x7d, 0x68, 0x01, 0x7a, 0x74, 0xa7, 0x0a, 0x40, 0x29, 0xc0, 0x50, 0x02, 0x81, 0x4e, 0x03, 0xb5,
+    0x20, 0xe0, 0x53, 0x85, 0x00, 0x70, 0x63, 0x8a, 0x70, 0x1e, 0xb4, 0x82, 0x9f, 0x8a, 0x00, 0x05,
+    0x3f, 0xb5, 0x20, 0x14, 0xe5, 0x14, 0x00, 0x2d, 0x3a, 0x80, 0x3b, 0x53, 0xb1, 0xe8, 0x28, 0x02,
+    0xc5, 0xb4, 0xe5, 0x38, 0x6e, 0x95, 0x78, 0x10, 0x46, 0x45, 0x66, 0x60, 0xd4, 0xd1, 0x4a, 0xc9,
+    0xdf, 0x22, 0x80, 0x2f, 0x51, 0x4c, 0x49, 0x55, 0xc5, 0x3e, 0x80, 0x0a, 0x28, 0xa2, 0x80, 0x10,
+    0x80, 0x46, 0x0f, 0x4a, 0xc2, 0xd5, 0xbc, 0x25, 0xa7, 0xea, 0x40, 0xb8, 0x4f, 0x2a, 0x53, 0xfc,
+    0x4b, 0x5b, 0xd4, 0x50, 0x07, 0x9e, 0x5c, 0x7c, 0x3d, 0xbb, 0x57, 0xc4, 0x13, 0xab, 0x2f, 0xbd,
+    0x36, 0x1f, 0x87, 0xd7, 0xad, 0x20, 0x12, 0xcc, 0x8a, 0xbd, 0xc8, 0xaf, 0x45, 0xa2, 0x80, 0x39,
+    0xbd, 0x27, 0xc1, 0x76, 0x16, 0x04, 0x3c, 0xc3, 0xce, 0x90, 0x77, 0x3d, 0x2b, 0xa2, 0x55, 0x54,
+    0x50, 0xaa, 0x00, 0x03, 0xa0, 0x14, 0xea, 0x28, 0x00, 0xa2, 0x8a, 0x28, 0x00, 0xa2, 0x8a, 0x55,
+    0x42, 0xe7, 0x81, 0x40, 0x09, 0x56, 0x21, 0x87, 0x18, 0x66, 0xa7, 0x47, 0x08, 0x5e, 0x4f, 0x5a,
+    0x98, 0x0e, 0xd4, 0x00, 0x01, 0xdb, 0xb5, 0x38, 0x50, 0x16, 0x9d, 0x8a, 0x00, 0x05, 0x3c, 0x75,
+    0xa4, 0x03, 0x22, 0x9c, 0x07, 0x14, 0x00, 0xa0, 0x53, 0x80, 0xa0, 0x60, 0x0a, 0x51, 0x40, 0x1c,
+    0x18, 0x14, 0xe1, 0xd2, 0x80, 0x29, 0xc0, 0x7b, 0xd0, 0x00, 0x05, 0x3c, 0x01, 0xda, 0x8c, 0x77,
+    0xa5, 0x14, 0x00, 0xb4, 0xe0, 0x28, 0x02, 0x94, 0x0e, 0x28, 0x01, 0x7a, 0xf7, 0xa7, 0x0c, 0x52,
+    0x01, 0x8a, 0x78, 0xe2, 0x80, 0x15, 0x72, 0x2a, 0x54, 0x95, 0x87, 0x5e, 0x45, 0x47, 0xd4, 0x53,
+    0x80, 0xc0, 0xa0, 0x09, 0xd6, 0x50, 0x7d, 0xa9, 0xe0, 0x83, 0xde, 0xab, 0x80, 0x0d, 0x3c, 0x0c,
+    0x77, 0xa0, 0x09, 0xa8, 0xa8, 0xc1, 0x3d, 0x29, 0xc0, 0xf3, 0x40, 0x0e, 0xa2, 0x8c, 0x52, 0xe0,
+    0x62, 0x80, 0x12, 0x8a, 0x7a, 0xa0, 0xef, 0x4f, 0x08, 0x07, 0x6a, 0x00, 0x87, 0x04, 0xf6, 0xa7,
+    0x08, 0xd8, 0xf6, 0xa9, 0x80, 0xc5, 0x3c, 0x0c, 0xd0, 0x04, 0x69, 0x08, 0x1c, 0x93, 0x9a, 0x99,
+    0x54, 0x0e, 0x94, 0x05, 0xa7, 0x00, 0x28, 0x00, 0x02, 0x9c, 0x28, 0x14, 0xe0, 0x05, 0x00, 0x00,
+    0x1a, 0x78, 0xa4, 0x0b, 0x4e, 0xa0, 0x05, 0x03, 0x9c, 0x53, 0x80, 0xa4, 0x03, 0x8a, 0x70, 0x18,
+    0xa0, 0x05, 0xc7, 0x14, 0xe0, 0xbc, 0x50, 0x06, 0x39, 0x34, 0xe0, 0x33, 0x40, 0x1c, 0x10, 0x1d,
+    0x8d, 0x3c, 0x0a, 0x41, 0xc5, 0x38, 0x0f, 0x7a, 0x00, 0x5f, 0xad, 0x3b, 0x14, 0x62, 0x9c, 0x28,
+    0x00, 0x50, 0x0d, 0x38, 0x0a, 0x05, 0x38, 0x0a, 0x00, 0x00, 0xc9, 0xa7, 0x75, 0xa4, 0xc5, 0x3c,
+    0x0e, 0x28, 0x00, 0x14, 0xf1, 0xd2, 0x90, 0x75, 0xa7, 0x81, 0x9a, 0x00, 0x00, 0xc1, 0xa7, 0x63,
+    0x06, 0x90, 0x0a, 0x70, 0x04, 0xf7, 0xa0, 0x05, 0xc5, 0x38, 0x0a, 0x00, 0xa5, 0x00, 0x75, 0xa0,
+    0x07, 0x63, 0x8a, 0x50, 0x0f, 0x4a, 0x00, 0xef, 0x4e, 0xc5, 0x00, 0x00, 0x73, 0x4f, 0x02, 0x80,
+    0x29, 0xd8, 0xc5, 0x00, 0x25, 0x3c, 0x71, 0x40, 0xe6, 0x9c, 0x07, 0xa5, 0x00, 0x02, 0x9e, 0x06,
+    0x69, 0x07, 0x34, 0xe1, 0x40, 0x0a, 0x07, 0x61, 0x4e, 0x03, 0x14, 0x80, 0x53, 0x80, 0xa0, 0x05,
+    0x14, 0xa0, 0x50, 0x3a, 0xd3, 0x80, 0xe9, 0x40, 0x0a, 0x05, 0x38, 0x2d, 0x03, 0xad, 0x3b, 0x93,
+    0x40, 0x0b, 0xf8, 0xd2, 0x8e, 0x46, 0x28, 0x03, 0xb5, 0x2e, 0x28, 0x03, 0x83, 0xc5, 0x38, 0x71,
+    0x40, 0xc1, 0x1c, 0x53, 0x80, 0xa0, 0x05, 0x1d, 0x3d, 0x69, 0xc0, 0x52, 0x01, 0x4f, 0x51, 0x40,
+    0x05, 0x3c, 0x74, 0xa4, 0x03, 0x14, 0xe5, 0x14, 0x00, 0x01, 0x4e, 0x14, 0x01, 0x4f, 0x03, 0x1d,
+    0x05, 0x00, 0x00, 0x73, 0x4e, 0xfe, 0x74, 0x94, 0xe1, 0x40, 0x0a, 0x3a, 0x53, 0x80, 0xa0, 0x2d,
+    0x28, 0x1c, 0xe6, 0x80, 0x15, 0x73, 0xde, 0x9e, 0x05, 0x34, 0x66, 0x9c, 0x28, 0x01, 0xc3, 0x9a,
+    0x72, 0xfa, 0x52, 0x2d, 0x38, 0x74, 0xa0, 0x05, 0xc5, 0x3b, 0x02, 0x90, 0x0a, 0x78, 0x06, 0x80,
+    0x00, 0x38, 0xa7, 0xaf, 0x5a, 0x4c, 0x53, 0x87, 0x14, 0x00, 0xbd, 0x69, 0x46, 0x28, 0x02, 0x94,
+    0x75, 0xa0, 0x05, 0x5a, 0x70, 0x19, 0xef, 0x40, 0x14, 0xe0, 0x0e, 0x68, 0x01, 0x40, 0xc5, 0x3c,
+    0x0a, 0x40, 0x33, 0x4e, 0x03, 0x1d, 0xe8, 0x00, 0x03, 0x34, 0xe1, 0xc5, 0x03, 0x18, 0xa7, 0x01,
+    0x9e, 0x68, 0x00, 0x03, 0x3d, 0x69, 0xf8, 0xa4, 0x14, 0xfe, 0xd4, 0x01, 0xc0, 0x8a, 0x7e, 0x3d,
+    0x28, 0x1c, 0xf3, 0xda, 0x9d, 0x8a, 0x00, 0x00, 0x1d, 0xe9, 0xcb, 0xd6, 0x90, 0x0a, 0x7e, 0x3b,
+    0xd0, 0x01, 0x8a, 0x70, 0xe9, 0xc5, 0x1c, 0xd3, 0xc0, 0xa0, 0x04, 0xc6, 0x29, 0xd8, 0x3e, 0xb4,
+    0x53, 0xc0, 0xa0, 0x04, 0x02, 0x9e, 0x06, 0x68, 0x1c, 0x76, 0xa5, 0x03, 0x3e, 0xd4, 0x00, 0xa3,
+    0x8a, 0x5c, 0x52, 0x8a, 0x76, 0x38, 0xa0, 0x00, 0x0a, 0x7e, 0x29, 0x07, 0xd6, 0x9c, 0x06, 0x68,
+    0x01, 0x45, 0x38, 0x0a, 0x40, 0x29, 0xf8, 0x39, 0xa0, 0x00, 0x71, 0xc5, 0x3b, 0x9a, 0x00, 0xe7,
+    0xad, 0x38, 0x0e, 0x71, 0x40, 0x00, 0xe9, 0x4e, 0x03, 0x22, 0x80, 0x38, 0xa5, 0x14, 0x00, 0xa0,
+    0x63, 0x8a, 0x70, 0x14, 0xb8, 0xa5, 0x51, 0x40, 0x0b, 0x8a, 0x7a, 0x8e, 0x33, 0x48, 0x05, 0x38,
+    0x2d, 0x00, 0x28, 0xeb, 0x4e, 0xc5, 0x20, 0x18, 0xef, 0x4e, 0x03, 0x9a, 0x00, 0x00, 0xe2, 0x9e,
+    0x29, 0x00, 0xa7, 0x0e, 0xb4, 0x00, 0x01, 0x8e, 0xb4, 0xf1, 0x40, 0x14, 0xb8, 0xcd, 0x00, 0x70,
+    0x98, 0xc0, 0xe2, 0x94, 0x71, 0x40, 0x1d, 0xfb, 0xd3, 0xb8, 0xa0, 0x00, 0x63, 0x14, 0xf1, 0x48,
+    0x05, 0x3f, 0x18, 0xed, 0x40, 0x00, 0xf7, 0xa7, 0x50, 0x06, 0x69, 0x45, 0x00, 0x28, 0x1c, 0x66,
+    0x9d, 0x48, 0x29, 0xe0, 0x71, 0x8a, 0x00, 0x07, 0x4a, 0x78, 0x1c, 0x52, 0x01, 0xc6, 0x29, 0xc0,
+    0x7a, 0x50, 0x00, 0x06, 0x0d, 0x3c, 0x75, 0xa4, 0x03, 0x34, 0xe1, 0xc1, 0xa0, 0x00, 0x01, 0xf8,
+    0xd3, 0x80, 0xc1, 0xf6, 0xa0, 0x73, 0x4e, 0x1c, 0xd0, 0x02, 0x81, 0x4e, 0x14, 0x63, 0x9a, 0x70,
+    0x03, 0x14, 0x00, 0x0e, 0x69, 0xc1, 0x70, 0x68, 0x06, 0x9c, 0x01, 0x34, 0x00, 0xb8, 0xa5, 0x03,
+    0x9a, 0x05, 0x38, 0x50, 0x01, 0x8a, 0x78, 0x1c, 0xd2, 0x0e, 0xbc, 0x53, 0x87, 0x34, 0x00, 0xa0,
+    0x53, 0x87, 0x4a, 0x4c, 0x53, 0xd4, 0x66, 0x80, 0x00, 0x3a, 0x53, 0xbb, 0x8a, 0x3e, 0x94, 0xa0,
+    0x50, 0x03, 0x87, 0x14, 0xa0, 0x0a, 0x06, 0x29, 0xe0, 0x0e, 0xb4, 0x00, 0x53, 0x87, 0x4a, 0x30,
+    0x7d, 0x69, 0xc3, 0x8e, 0x68, 0x03, 0xff, 0xd9,
+};
+
+static const uint8_t EYE_420_MEANS[] = {
+    0x5b, 0x5e, 0x61, 0x63, 0x65, 0x68, 0x6b, 0x6d, 0x71, 0x74, 0x76, 0x79, 0x7c, 0x7e, 0x80, 0x82,
+    0x86, 0x89, 0x8b, 0x8e, 0x90, 0x93, 0x95, 0x98, 0x9c, 0x9e, 0xa1, 0xa3, 0xa7, 0xa8, 0x5e, 0x60,
+    0x62, 0x66, 0x67, 0x6b, 0x6d, 0x70, 0x72, 0x75, 0x77, 0x7a, 0x7e, 0x7f, 0x81, 0x84, 0x88, 0x8a,
+    0x8d, 0x90, 0x93, 0x95, 0x98, 0x9a, 0x9b, 0xa1, 0xa2, 0xa4, 0xa8, 0xab, 0x5e, 0x62, 0x65, 0x66,
+    0x6a, 0x6c, 0x6f, 0x71, 0x75, 0x77, 0x7a, 0x7c, 0x7f, 0x81, 0x85, 0x88, 0x8a, 0x8d, 0x8f, 0x92,
+    0x94, 0x97, 0x9a, 0x9d, 0x9e, 0xa2, 0xa4, 0xa7, 0xa9, 0xac, 0x61, 0x65, 0x66, 0x6a, 0x6c, 0x6f,
+    0x71, 0x74, 0x77, 0x7a, 0x7b, 0x7e, 0x80, 0x84, 0x86, 0x89, 0x8b, 0x8f, 0x90, 0x94, 0x95, 0x99,
+    0x9c, 0x9e, 0xa1, 0xa3, 0xa6, 0xa9, 0xab, 0xad, 0x63, 0x66, 0x68, 0x6b, 0x6d, 0x71, 0x72, 0x75,
+    0x77, 0x7b, 0x7e, 0x80, 0x83, 0x85, 0x87, 0x8b, 0x8e, 0x90, 0x93, 0x97, 0x99, 0x9c, 0x9d, 0xa1,
+    0xa3, 0xa6, 0xa9, 0xab, 0xae, 0xb0, 0x65, 0x67, 0x6a, 0x6d, 0x70, 0x72, 0x75, 0x77, 0x7a, 0x7c,
+    0x80, 0x83, 0x85, 0x88, 0x8a, 0x8e, 0x8f, 0x93, 0x95, 0x98, 0x9a, 0x9d, 0x9f, 0xa2, 0xa5, 0xa8,
+    0xa9, 0xac, 0xb0, 0xb2, 0x67, 0x6a, 0x6c, 0x6e, 0x72, 0x74, 0x77, 0x7a, 0x7c, 0x7f, 0x81, 0x84,
+    0x86, 0x8a, 0x8b, 0x8f, 0x92, 0x94, 0x97, 0x9a, 0x9c, 0x9f, 0xa2, 0xa4, 0xa8, 0xa9, 0xac, 0xae,
+    0xb2, 0xb5, 0x68, 0x6b, 0x6f, 0x71, 0x74, 0x76, 0x79, 0x7b, 0x7e, 0x81, 0x84, 0x86, 0x89, 0x8b,
+    0x8f, 0x92, 0x94, 0x97, 0x99, 0x9c, 0x9e, 0xa1, 0xa5, 0xa7, 0xa9, 0xac, 0xae, 0xb0, 0xb5, 0xb6,
+    0x6b, 0x6f, 0x70, 0x72, 0x75, 0x79, 0x7b, 0x7f, 0x80, 0x83, 0x85, 0x88, 0x8d, 0x93, 0x97, 0x98,
+    0x99, 0x99, 0x9c, 0x9d, 0xa0, 0xa2, 0xa6, 0xa8, 0xac, 0xae, 0xb1, 0xb3, 0xb6, 0xb8, 0x6c, 0x70,
+    0x72, 0x75, 0x77, 0x7a, 0x7e, 0x80, 0x82, 0x8b, 0x9a, 0xa4, 0xa9, 0xa9, 0xab, 0xab, 0xab, 0xa9,
+    0xa8, 0xa7, 0xa4, 0xa4, 0xa8, 0xab, 0xad, 0xaf, 0xb2, 0xb6, 0xb7, 0xbc, 0x6f, 0x71, 0x74, 0x77,
+    0x7a, 0x7c, 0x7f, 0x87, 0x9f, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+    0xab, 0xa9, 0xab, 0xad, 0xae, 0xb2, 0xb3, 0xb7, 0xba, 0xbd, 0x71, 0x74, 0x76, 0x79, 0x7b, 0x7f,
+    0x8a, 0xa7, 0xab, 0xab, 0xab, 0xab, 0xab, 0x94, 0x68, 0x66, 0x8c, 0xa9, 0xab, 0xab, 0xab, 0xab,
+    0xab, 0xad, 0xb1, 0xb3, 0xb7, 0xba, 0xbc, 0xbf, 0x74, 0x76, 0x77, 0x7a, 0x7e, 0x88, 0xa7, 0xab,
+    0xab, 0xab, 0xab, 0xab, 0x71, 0x1f, 0x1a, 0x25, 0x7a, 0x68, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xab,
+    0xaf, 0xb6, 0xb8, 0xbb, 0xbd, 0xc1, 0x75, 0x77, 0x7b, 0x7c, 0x80, 0x9b, 0xab, 0xab, 0xab, 0xab,
+    0xab, 0x93, 0x1f, 0x1a, 0x1a, 0x3a, 0xca, 0x2b, 0x85, 0xab, 0xab, 0xab, 0xab, 0xab, 0xac, 0xb7,
+    0xbb, 0xbd, 0xc0, 0xc2, 0x77, 0x7a, 0x7c, 0x7f, 0x84, 0xa7, 0xab, 0xab, 0xab, 0xab, 0xab, 0x68,
+    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x57, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb8, 0xbc, 0xbf,
+    0xc2, 0xc5, 0x79, 0x7b, 0x7f, 0x81, 0x85, 0xa8, 0xab, 0xab, 0xab, 0xab, 0xab, 0x66, 0x1a, 0x1a,
+    0x1a, 0x1a, 0x1a, 0x1a, 0x54, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb9, 0xbf, 0xc0, 0xc4, 0xc7,
+    0x7a, 0x7e, 0x80, 0x84, 0x85, 0xa0, 0xab, 0xab, 0xab, 0xab, 0xab, 0x8c, 0x1c, 0x1a, 0x1a, 0x1a,
+    0x1a, 0x1a, 0x7e, 0xab, 0xab, 0xab, 0xab, 0xab, 0xad, 0xbd, 0xc1, 0xc4, 0xc6, 0xc9, 0x7c, 0x80,
+    0x83, 0x85, 0x87, 0x92, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xa9, 0x62, 0x1b, 0x1a, 0x1a, 0x1a, 0x53,
+    0xa8, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb7, 0xc0, 0xc2, 0xc5, 0xc7, 0xca, 0x7f, 0x81, 0x84, 0x88,
+    0x89, 0x8b, 0x98, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xa9, 0x85, 0x57, 0x54, 0x7e, 0xa8, 0xab, 0xab,
+    0xab, 0xab, 0xab, 0xb5, 0xbf, 0xc1, 0xc4, 0xc7, 0xca, 0xcc, 0x80, 0x84, 0x86, 0x89, 0x8b, 0x8e,
+    0x92, 0x99, 0xa7, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xac,
+    0xb7, 0xbf, 0xc1, 0xc4, 0xc6, 0xc8, 0xcc, 0xce, 0x83, 0x85, 0x88, 0x8b, 0x8e, 0x90, 0x93, 0x95,
+    0x99, 0x9f, 0xa5, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xaa, 0xad, 0xb3, 0xbb, 0xbd, 0xc0,
+    0xc2, 0xc6, 0xc9, 0xcb, 0xce, 0xd0, 0x85, 0x88, 0x8b, 0x8d, 0x90, 0x91, 0x94, 0x98, 0x9a, 0x9d,
+    0x9f, 0xa3, 0xa5, 0xa8, 0xab, 0xac, 0xae, 0xb2, 0xb5, 0xb8, 0xbb, 0xbd, 0xc0, 0xc2, 0xc5, 0xc7,
+    0xca, 0xcc, 0xd0, 0xd3, 0x86, 0x8a, 0x8d, 0x8f, 0x92, 0x94, 0x96, 0x99, 0x9c, 0x9f, 0xa2, 0xa4,
+    0xa7, 0xa9, 0xad, 0xae, 0xb1, 0xb5, 0xb6, 0xba, 0xbc, 0xc0, 0xc2, 0xc5, 0xc7, 0xc9, 0xcc, 0xcf,
+    0xd3, 0xd4, 0x89, 0x8b, 0x8f, 0x92, 0x94, 0x97, 0x98, 0x9b, 0x9e, 0xa2, 0xa3, 0xa6, 0xa9, 0xab,
+    0xae, 0xb1, 0xb5, 0xb7, 0xba, 0xbc, 0xbf, 0xc1, 0xc4, 0xc6, 0xc9, 0xcb, 0xcf, 0xd1, 0xd4, 0xd5,
+    0x8a, 0x8d, 0x90, 0x93, 0x95, 0x99, 0x9a, 0x9d, 0xa1, 0xa3, 0xa6, 0xa8, 0xaa, 0xae, 0xb1, 0xb3,
+    0xb6, 0xb8, 0xbb, 0xbf, 0xc1, 0xc2, 0xc5, 0xc7, 0xcb, 0xcf, 0xd0, 0xd3, 0xd5, 0xd9, 0x8d, 0x8f,
+    0x92, 0x95, 0x98, 0x9a, 0x9d, 0xa1, 0xa2, 0xa4, 0xa8, 0xa9, 0xac, 0xae, 0xb2, 0xb5, 0xb7, 0xbb,
+    0xbd, 0xc0, 0xc2, 0xc4, 0xc7, 0xca, 0xce, 0xd0, 0xd3, 0xd5, 0xd8, 0xdb, 0x8e, 0x92, 0x94, 0x97,
+    0x99, 0x9c, 0x9e, 0xa1, 0xa3, 0xa7, 0xa9, 0xab, 0xae, 0xb2, 0xb5, 0xb7, 0xba, 0xbc, 0xbf, 0xc1,
+    0xc4, 0xc6, 0xca, 0xce, 0xd0, 0xd3, 0xd4, 0xd8, 0xd9, 0xdd, 0x92, 0x94, 0x95, 0x99, 0x9c, 0x9f,
+    0xa1, 0xa4, 0xa7, 0xa8, 0xac, 0xae, 0xb1, 0xb3, 0xb6, 0xba, 0xbc, 0xbf, 0xc1, 0xc2, 0xc7, 0xc9,
+    0xcc, 0xcf, 0xd1, 0xd4, 0xd6, 0xd9, 0xdd, 0xde, 0x94, 0x95, 0x98, 0x9c, 0x9e, 0xa1, 0xa3, 0xa6,
+    0xa8, 0xac, 0xad, 0xb1, 0xb2, 0xb4, 0xb8, 0xbb, 0xbd, 0xc0, 0xc4, 0xc5, 0xc7, 0xcb, 0xce, 0xd0,
+    0xd3, 0xd5, 0xd9, 0xda, 0xde, 0xe0, 0x95, 0x98, 0x9a, 0x9e, 0xa1, 0xa2, 0xa4, 0xa8, 0xaa, 0xad,
+    0xb0, 0xb2, 0xb5, 0xb7, 0xbb, 0xbd, 0xc0, 0xc2, 0xc5, 0xc7, 0xca, 0xcc, 0xcf, 0xd2, 0xd5, 0xd6,
+    0xda, 0xde, 0xe1, 0xe3,
+};
+
+static const uint8_t EYE_GRAY_RESTART[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e,
+    0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a,
+    0x1b, 0x23, 0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29, 0x19, 0x1f,
+    0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0xf0,
+    0x00, 0xf0, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+    0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+    0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+    0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xdd,
+    0x00, 0x04, 0x00, 0x10, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xe3, 0x55,
+    0x78, 0xeb, 0xd2, 0xa4, 0x1c, 0xf4, 0xa9, 0x00, 0x20, 0x75, 0xfa, 0xd4, 0x83, 0xa6, 0x29, 0x55,
+    0x45, 0x4a, 0xa3, 0x15, 0x20, 0x1c, 0x83, 0xda, 0x9f, 0xdf, 0x15, 0x2a, 0x8c, 0x53, 0xd4, 0x71,
+    0xeb, 0x4f, 0xa9, 0x07, 0x5e, 0x4f, 0x15, 0x2a, 0xf3, 0x4a, 0x07, 0x3e, 0xd5, 0x2a, 0x0c, 0x1e,
+    0x05, 0x3c, 0x0c, 0x9e, 0x6b, 0xff, 0xd0, 0xb0, 0xbe, 0xd4, 0xf5, 0x18, 0x3d, 0x6a, 0x45, 0xfb,
+    0xb5, 0x20, 0x1c, 0x64, 0xf5, 0xa7, 0xe3, 0x22, 0xa4, 0x51, 0xc0, 0xa7, 0xa8, 0xe3, 0xde, 0x9e,
+    0x07, 0x18, 0xa9, 0x10, 0x7e, 0x15, 0x20, 0x53, 0x8c, 0x62, 0x9e, 0xab, 0x8f, 0x4a, 0x90, 0x0f,
+    0xd6, 0xa4, 0x4e, 0x16, 0x9c, 0x07, 0x1c, 0x57, 0x8e, 0x00, 0x38, 0xc5, 0x38, 0x03, 0x9e, 0x2b,
+    0xff, 0xd1, 0xe5, 0xc2, 0x9c, 0x71, 0xcd, 0x48, 0x82, 0x9e, 0x06, 0x73, 0x52, 0x20, 0xcb, 0x54,
+    0x98, 0x03, 0x8a, 0x78, 0xe9, 0xd2, 0x9e, 0xb9, 0xef, 0x52, 0x81, 0xcf, 0x14, 0xf1, 0x9c, 0x53,
+    0x95, 0x49, 0xe2, 0xa5, 0x54, 0x24, 0xf1, 0x4f, 0x03, 0x1c, 0x53, 0xd7, 0x35, 0x22, 0xe4, 0xd4,
+    0x8a, 0x31, 0xc5, 0x48, 0x17, 0x35, 0xff, 0xd2, 0xd1, 0x51, 0x52, 0x02, 0x48, 0xa9, 0x15, 0x7b,
+    0xd3, 0xf0, 0x49, 0xa9, 0x07, 0x03, 0x14, 0xe1, 0x4f, 0x03, 0x9c, 0xd4, 0xcb, 0xd2, 0x9e, 0xa3,
+    0xde, 0x9e, 0xab, 0xcd, 0x48, 0x3d, 0x29, 0xe3, 0x8f, 0xa5, 0x78, 0xda, 0x80, 0x4f, 0xbd, 0x3d,
+    0x78, 0x38, 0xa9, 0x31, 0x8e, 0x94, 0xf4, 0x04, 0xf7, 0xaf, 0xff, 0xd3, 0xc1, 0x50, 0x29, 0xeb,
+    0x4f, 0x03, 0x35, 0x2a, 0x2e, 0x3b, 0xf1, 0x52, 0x05, 0xcf, 0x34, 0xf5, 0x14, 0xf1, 0x80, 0x38,
+    0xa9, 0x14, 0x64, 0xf7, 0xa9, 0x16, 0x9e, 0xbc, 0xf5, 0xa9, 0x00, 0x14, 0xfe, 0x9d, 0xaa, 0x45,
+    0x00, 0x8e, 0x4f, 0x14, 0xfc, 0x0a, 0x91, 0x17, 0xde, 0x9e, 0x06, 0x38, 0x15, 0xff, 0xd4, 0xdb,
+    0x41, 0xef, 0xcd, 0x3c, 0x03, 0x52, 0x28, 0xfc, 0xea, 0x44, 0xa7, 0x00, 0x01, 0xe3, 0x91, 0x52,
+    0xae, 0x3f, 0x0a, 0x7a, 0x0e, 0x7a, 0x54, 0x8b, 0x9f, 0xa5, 0x48, 0x3a, 0x7c, 0xd4, 0xe0, 0x2b,
+    0xc7, 0x14, 0x67, 0xda, 0xa4, 0xc5, 0x3c, 0x2f, 0xe7, 0x52, 0x28, 0xc7, 0x14, 0xf5, 0xa7, 0xaf,
+    0xd2, 0xbf, 0xff, 0xd5, 0xca, 0x03, 0x81, 0x9a, 0x95, 0x48, 0xa9, 0x11, 0x6a, 0x4e, 0x9c, 0x53,
+    0x80, 0x00, 0x8a, 0x78, 0xeb, 0xcf, 0x7a, 0x7a, 0xfd, 0x2a, 0x54, 0x18, 0x27, 0xd2, 0x9e, 0x3a,
+    0xf4, 0xa9, 0x00, 0x34, 0xf0, 0xbe, 0xf5, 0x22, 0x72, 0x70, 0x69, 0xf8, 0xc1, 0xf9, 0x6a, 0x4d,
+    0xbd, 0x33, 0xd6, 0x9e, 0x07, 0x15, 0x22, 0x8e, 0x6b, 0xff, 0xd6, 0xe9, 0x48, 0xc5, 0x3d, 0x47,
+    0xcb, 0xc1, 0xa7, 0xae, 0x40, 0xa9, 0x14, 0x1f, 0xc2, 0x9e, 0x07, 0x43, 0x52, 0x28, 0xc1, 0xe6,
+    0x9f, 0xdf, 0xad, 0x3f, 0x15, 0xe3, 0xb8, 0x19, 0xcd, 0x39, 0x3a, 0xf3, 0xd2, 0xa4, 0xc1, 0x15,
+    0x22, 0x8f, 0x5e, 0xb5, 0x26, 0x7b, 0x53, 0xd2, 0x9e, 0x07, 0xbd, 0x3d, 0x46, 0x0e, 0x7a, 0xd7,
+    0xff, 0xd7, 0xa8, 0xa3, 0xe6, 0x15, 0x20, 0x50, 0x4f, 0x7a, 0x91, 0x56, 0x9f, 0xcd, 0x3d, 0x72,
+    0x17, 0x3d, 0x6a, 0x44, 0xc9, 0x1f, 0x35, 0x48, 0xa3, 0x8e, 0x2a, 0x45, 0x00, 0x75, 0xe6, 0x9e,
+    0x83, 0x8a, 0x91, 0x57, 0xbd, 0x3c, 0x54, 0x9b, 0x73, 0x8c, 0xd4, 0x88, 0x31, 0xc5, 0x48, 0x17,
+    0x02, 0x9c, 0x30, 0x7b, 0x54, 0x88, 0xa2, 0xbf, 0xff, 0xd0, 0xeb, 0xd4, 0x73, 0xcf, 0x5a, 0x7a,
+    0x8c, 0x1a, 0x90, 0x76, 0xc1, 0xa7, 0xa8, 0xc9, 0xa9, 0x36, 0xfe, 0x34, 0xf1, 0xc7, 0x6e, 0x6b,
+    0xc6, 0xc0, 0xa7, 0xa8, 0xe8, 0x0d, 0x3d, 0x78, 0x3c, 0xd4, 0x9d, 0xb2, 0x2a, 0x45, 0x19, 0xeb,
+    0x4f, 0x51, 0xcd, 0x48, 0xbe, 0xd4, 0xfc, 0x1a, 0x91, 0x47, 0x1c, 0xd3, 0xd4, 0x67, 0x9a, 0xff,
+    0xd1, 0x16, 0xa4, 0x51, 0xdc, 0xf4, 0xa7, 0x81, 0xc7, 0x14, 0xf0, 0x33, 0x8f, 0x6a, 0x91, 0x40,
+    0x23, 0x8a, 0x90, 0x0c, 0x53, 0xd3, 0xe9, 0x52, 0x28, 0xa9, 0x14, 0x73, 0x4e, 0x19, 0xcd, 0x48,
+    0x83, 0xbd, 0x3d, 0x57, 0x26, 0xa4, 0x0b, 0x8a, 0x7a, 0x03, 0x52, 0x72, 0x31, 0xef, 0x52, 0x03,
+    0x91, 0xcd, 0x7f, 0xff, 0xd2, 0xed, 0xd0, 0x0c, 0x1a, 0x90, 0x0a, 0x91, 0x7a, 0x71, 0xf9, 0xd4,
+    0x8b, 0x5e, 0x36, 0x07, 0xcd, 0x52, 0x2e, 0x29, 0xe8, 0xb4, 0xf0, 0x38, 0xa9, 0x14, 0x74, 0xef,
+    0x4f, 0x03, 0x1f, 0x8d, 0x4a, 0x8b, 0x4f, 0xc7, 0x14, 0xe0, 0x3a, 0x54, 0x8b, 0x8c, 0xf1, 0x52,
+    0x63, 0xd2, 0xa4, 0x51, 0x91, 0x5f, 0xff, 0xd3, 0xb2, 0xbd, 0x2a, 0x41, 0xd3, 0xa7, 0x34, 0xe5,
+    0x18, 0x3e, 0xf5, 0x2a, 0xe6, 0x9e, 0x06, 0x7d, 0x8d, 0x48, 0x00, 0xdb, 0x4f, 0x5c, 0x77, 0xe2,
+    0xa4, 0x5e, 0x69, 0xe9, 0xd2, 0xa4, 0x1d, 0x46, 0x7a, 0xd3, 0xc7, 0xb5, 0x48, 0xaa, 0x7a, 0x54,
+    0xa3, 0xd0, 0x8e, 0x94, 0xab, 0x92, 0x2a, 0x45, 0x07, 0xd2, 0xa4, 0x5e, 0x7a, 0xd7, 0xff, 0xd4,
+    0xf4, 0x20, 0x3d, 0x29, 0xfe, 0xd5, 0xe3, 0x40, 0x11, 0x81, 0x52, 0x0e, 0x2a, 0x45, 0xcf, 0x03,
+    0xb5, 0x48, 0x00, 0xe8, 0x01, 0xa7, 0xa8, 0xe7, 0x8a, 0x93, 0x69, 0x23, 0x93, 0x4f, 0x0b, 0x81,
+    0x52, 0x01, 0xf9, 0xd3, 0xd4, 0x7e, 0x35, 0x27, 0x1d, 0xaa, 0x45, 0xe2, 0x9e, 0x9e, 0xd5, 0x20,
+    0xc1, 0xe2, 0x9e, 0xa0, 0xd7, 0xff, 0xd5, 0xd4, 0x0a, 0x73, 0x91, 0x4f, 0x5c, 0x77, 0xeb, 0x4f,
+    0x50, 0x33, 0x4f, 0x03, 0x9a, 0x93, 0x00, 0xe2, 0xa4, 0x4e, 0xb8, 0xa9, 0x00, 0x03, 0x27, 0xad,
+    0x3d, 0x79, 0xe6, 0xa4, 0x03, 0xda, 0x9e, 0x07, 0x34, 0xf1, 0x52, 0xa8, 0xc0, 0xcd, 0x38, 0x01,
+    0x4f, 0x5e, 0x38, 0xa9, 0x97, 0xa5, 0x38, 0x72, 0x78, 0xaf, 0xff, 0xd6, 0xc3, 0x03, 0xd3, 0xad,
+    0x48, 0xbd, 0x3a, 0x53, 0xd4, 0x7a, 0x1a, 0x7a, 0xe4, 0xf7, 0xa7, 0xa8, 0xf4, 0xa9, 0x42, 0xd3,
+    0xd4, 0x73, 0x52, 0x81, 0x9e, 0x94, 0xe5, 0x04, 0x54, 0x8a, 0x39, 0xa7, 0x85, 0xcd, 0x3d, 0x41,
+    0xfc, 0x6a, 0x74, 0x89, 0xdf, 0x80, 0xa4, 0x9f, 0xa5, 0x58, 0x8e, 0xd6, 0x57, 0xe3, 0x61, 0xe3,
+    0xd6, 0xa5, 0x5b, 0x39, 0x81, 0xe9, 0x4e, 0x36, 0x92, 0xf6, 0x15, 0xff, 0xd7, 0xe8, 0x4d, 0xb3,
+    0xaf, 0x55, 0xcd, 0x29, 0x89, 0x87, 0x6a, 0x72, 0x8c, 0x76, 0xa7, 0x80, 0x7b, 0x54, 0x80, 0x71,
+    0x4f, 0x03, 0xb5, 0x48, 0xa2, 0xa4, 0x55, 0xed, 0x9a, 0x93, 0x6f, 0x4c, 0x73, 0x4f, 0x03, 0x00,
+    0x54, 0x80, 0x0e, 0x94, 0xf0, 0x06, 0xee, 0x94, 0xfc, 0x64, 0x54, 0x88, 0x07, 0xd2, 0xbc, 0x6b,
+    0xbf, 0x15, 0x22, 0x0e, 0x79, 0xaf, 0xff, 0xd0, 0xcc, 0x51, 0xc5, 0x3c, 0x0e, 0x7a, 0x54, 0x8a,
+    0x31, 0x52, 0x05, 0x26, 0xa4, 0x41, 0xcf, 0x35, 0x20, 0x1c, 0xd3, 0xc2, 0xf3, 0xea, 0x6a, 0xed,
+    0xad, 0x8c, 0xd3, 0xf4, 0x04, 0x0f, 0x53, 0x5a, 0x70, 0x69, 0x2a, 0xbc, 0xc8, 0xd9, 0xf6, 0xab,
+    0xb1, 0xd9, 0xc0, 0x83, 0x01, 0x05, 0x4c, 0x11, 0x47, 0x40, 0x05, 0x3a, 0x8a, 0x28, 0xa4, 0xc0,
+    0xf4, 0xaf, 0xff, 0xd1, 0xed, 0x4c, 0x6a, 0x7b, 0x0a, 0x6b, 0x42, 0x31, 0xf2, 0xf1, 0x4c, 0x31,
+    0x95, 0xe9, 0x4a, 0xa3, 0x07, 0x1c, 0xd4, 0x8a, 0x31, 0xf5, 0xf7, 0xa9, 0x30, 0x38, 0xa7, 0x8e,
+    0x07, 0x06, 0xa4, 0x41, 0x91, 0x4e, 0x03, 0x9e, 0x6a, 0x55, 0x1d, 0x29, 0xf8, 0xcd, 0x4c, 0xa0,
+    0x60, 0x66, 0xbc, 0x61, 0x47, 0x53, 0xd6, 0xa4, 0xec, 0x00, 0xa7, 0x60, 0xe3, 0xa5, 0x4b, 0x18,
+    0xc2, 0xe4, 0xf5, 0xaf, 0xff, 0xd2, 0xac, 0x05, 0x48, 0xbc, 0x75, 0xa7, 0xae, 0x7f, 0x0a, 0xb9,
+    0x69, 0x69, 0x2c, 0xec, 0x02, 0x02, 0x47, 0xad, 0x6f, 0xd9, 0xe9, 0xb1, 0xc1, 0x82, 0xe3, 0x73,
+    0x7b, 0xd5, 0xe0, 0x00, 0x18, 0x03, 0x14, 0xb4, 0x51, 0x45, 0x14, 0x51, 0x45, 0x14, 0x57, 0xff,
+    0xd3, 0xee, 0x29, 0x0a, 0x8c, 0xd2, 0x9c, 0x71, 0x4f, 0x45, 0xcf, 0x7a, 0x78, 0x18, 0x3c, 0x54,
+    0x83, 0xd2, 0x9c, 0x00, 0xcd, 0x4a, 0x99, 0x35, 0x22, 0x8e, 0xd5, 0x26, 0x08, 0xc6, 0x2b, 0xc6,
+    0xb6, 0xf3, 0xd2, 0x9e, 0xb5, 0x20, 0x1c, 0xd4, 0x81, 0x7d, 0x0d, 0x3c, 0x7b, 0xd4, 0x8a, 0x32,
+    0x33, 0xd0, 0x57, 0xff, 0xd4, 0xbd, 0xa6, 0xd8, 0x35, 0xcb, 0x82, 0x7e, 0xe0, 0xef, 0x5d, 0x34,
+    0x31, 0x24, 0x28, 0x15, 0x00, 0x00, 0x54, 0x94, 0x51, 0x45, 0x15, 0x83, 0xaf, 0xf8, 0xab, 0x4b,
+    0xd1, 0x23, 0x26, 0xea, 0xe1, 0x77, 0x8f, 0xe0, 0x53, 0x93, 0x5c, 0x2d, 0xf7, 0xc5, 0xeb, 0x64,
+    0x94, 0x0b, 0x4b, 0x36, 0x74, 0xc7, 0x56, 0x38, 0xa6, 0x5a, 0x7c, 0x5f, 0x85, 0xa6, 0x51, 0x71,
+    0x64, 0xcb, 0x1f, 0x72, 0x0e, 0x6b, 0xb4, 0xf0, 0xf7, 0x8d, 0x74, 0x9d, 0x6c, 0x01, 0x0c, 0xe2,
+    0x39, 0x7f, 0xb8, 0xe7, 0x06, 0xba, 0x60, 0x41, 0x19, 0x07, 0x22, 0x96, 0x8a, 0x28, 0xaf, 0xff,
+    0xd5, 0xee, 0x2a, 0x48, 0xc8, 0x3d, 0x6a, 0x61, 0xd0, 0x7a, 0xd3, 0xc0, 0xe9, 0x52, 0x28, 0xc7,
+    0x6a, 0x7a, 0x8c, 0x1e, 0x2a, 0x41, 0xf4, 0xa7, 0x8e, 0x46, 0x31, 0x5e, 0x37, 0xd2, 0x9e, 0x00,
+    0x34, 0xf0, 0x0f, 0xe1, 0x4f, 0x42, 0x71, 0x52, 0x28, 0x1f, 0x5a, 0xbb, 0xa6, 0xda, 0xb5, 0xc4,
+    0xe1, 0x7f, 0x87, 0xbd, 0x75, 0x70, 0xc4, 0xb0, 0xc6, 0x11, 0x06, 0x00, 0xa9, 0x2b, 0xff, 0xd6,
+    0xee, 0x28, 0xa2, 0x8a, 0xf3, 0x4f, 0x89, 0x7e, 0x3c, 0x6d, 0x1d, 0xcd, 0x8e, 0x9c, 0x55, 0xa7,
+    0x61, 0xf3, 0x36, 0x7e, 0xed, 0x78, 0x85, 0xe5, 0xdc, 0xf7, 0x93, 0x34, 0xb7, 0x12, 0x33, 0xbb,
+    0x1c, 0x92, 0x4d, 0x41, 0x5a, 0x1a, 0x06, 0x91, 0x75, 0xae, 0x6a, 0xb0, 0x58, 0x58, 0x46, 0x64,
+    0x9e, 0x56, 0xc0, 0x02, 0xbd, 0xc6, 0xef, 0xf6, 0x7b, 0xd4, 0xec, 0x74, 0x33, 0x7d, 0x69, 0xa8,
+    0x6e, 0xbf, 0x44, 0xdf, 0xe5, 0x28, 0xc7, 0x3e, 0x99, 0xac, 0x7f, 0x02, 0x78, 0xda, 0xee, 0x0d,
+    0x4c, 0x68, 0x9a, 0xe8, 0xdb, 0x2c, 0x67, 0xcb, 0x0e, 0xdc, 0x10, 0x47, 0xad, 0x7a, 0xb8, 0x21,
+    0x80, 0x20, 0xe4, 0x1a, 0x5a, 0x28, 0xa2, 0x8a, 0xff, 0xd7, 0xf4, 0x08, 0x58, 0x30, 0xf7, 0x15,
+    0x38, 0x1c, 0xf3, 0x52, 0x28, 0xa7, 0xa8, 0x3c, 0x8a, 0x7a, 0x8e, 0x2a, 0x54, 0x15, 0xe3, 0x20,
+    0x75, 0xcd, 0x48, 0x82, 0xa5, 0x51, 0x4e, 0x03, 0xd2, 0xa4, 0x5c, 0xd7, 0x4d, 0xa1, 0xc1, 0xe5,
+    0xdb, 0x6f, 0x23, 0xe6, 0x6a, 0xd3, 0xa2, 0x8a, 0x2b, 0xff, 0xd0, 0xee, 0x2b, 0x07, 0xc6, 0xba,
+    0xca, 0x68, 0x9a, 0x0d, 0xc5, 0xc9, 0x38, 0x7d, 0xbb, 0x53, 0xeb, 0x5f, 0x31, 0xdf, 0x5c, 0xc9,
+    0x79, 0x75, 0x24, 0xf3, 0x31, 0x67, 0x72, 0x49, 0x26, 0xa0, 0xa2, 0xba, 0xcf, 0x85, 0xfe, 0x22,
+    0x87, 0xc2, 0xfe, 0x31, 0xb1, 0xd4, 0xae, 0x50, 0xbc, 0x51, 0xb6, 0x18, 0x0f, 0x43, 0x5f, 0x60,
+    0x6a, 0x5f, 0x15, 0x3c, 0x31, 0x6f, 0xe1, 0xe7, 0xbf, 0x5d, 0x42, 0x19, 0x09, 0x8f, 0x70, 0x89,
+    0x5b, 0xe6, 0x27, 0x1d, 0x31, 0x5f, 0x15, 0xf8, 0x97, 0x56, 0xfe, 0xd3, 0xf1, 0x25, 0xe6, 0xa5,
+    0x00, 0x31, 0xf9, 0xd3, 0x19, 0x14, 0x0e, 0xdc, 0xd7, 0xbb, 0xfc, 0x30, 0xd7, 0xc6, 0xb5, 0xa0,
+    0x46, 0xb2, 0x36, 0x67, 0x84, 0x6d, 0x6c, 0xd7, 0x65, 0x45, 0x14, 0x51, 0x4f, 0x89, 0xb6, 0xb8,
+    0xab, 0xeb, 0xf8, 0x57, 0xff, 0xd1, 0xf4, 0xe0, 0x30, 0x7a, 0xd3, 0xd4, 0x7e, 0x75, 0x22, 0x8c,
+    0x9f, 0x6a, 0x78, 0xe0, 0x60, 0x57, 0x8d, 0x81, 0x93, 0xed, 0x52, 0x2a, 0x81, 0xda, 0x9c, 0x06,
+    0x48, 0xeb, 0x8a, 0x95, 0x40, 0x3e, 0xd5, 0x2c, 0x4a, 0x19, 0xc0, 0xcf, 0x53, 0x5d, 0x85, 0xba,
+    0x04, 0x85, 0x14, 0x74, 0x02, 0xa4, 0xa2, 0x8a, 0x28, 0xaf, 0x28, 0xf8, 0xed, 0x78, 0xe9, 0x65,
+    0x67, 0x6c, 0x00, 0xd8, 0xec, 0x58, 0xd7, 0xff, 0xd2, 0xf9, 0xda, 0x8a, 0x28, 0xa5, 0xdc, 0xc4,
+    0x63, 0x71, 0xc7, 0xa6, 0x69, 0x2b, 0xd4, 0x7e, 0x05, 0xde, 0x3a, 0x6a, 0xb7, 0x36, 0xc0, 0x0d,
+    0x8e, 0x9b, 0x8d, 0x7b, 0x85, 0x14, 0x51, 0x45, 0x03, 0x83, 0x5a, 0x71, 0x7c, 0xc8, 0xa6, 0xa5,
+    0x51, 0xc7, 0x1d, 0x6a, 0x45, 0x5a, 0xff, 0xd3, 0xf5, 0x80, 0xb8, 0xef, 0x4f, 0x51, 0x9e, 0x4d,
+    0x78, 0xd2, 0xae, 0x07, 0x5a, 0x91, 0x47, 0x1c, 0x54, 0x83, 0xa0, 0xa7, 0xa8, 0xa9, 0xa1, 0x20,
+    0x38, 0x3d, 0x30, 0x6b, 0xae, 0x81, 0x83, 0x44, 0x84, 0x74, 0x22, 0x9f, 0x45, 0x14, 0x51, 0x5e,
+    0x49, 0xf1, 0xde, 0xda, 0x46, 0xb6, 0xb2, 0x9c, 0x0f, 0xdd, 0xa9, 0x20, 0x9a, 0xf1, 0x9a, 0x2b,
+    0xff, 0xd4, 0xf9, 0xda, 0x8a, 0x28, 0xaf, 0x4e, 0xf8, 0x1b, 0x6d, 0x23, 0x6b, 0x57, 0x13, 0x81,
+    0xfb, 0xb5, 0x4c, 0x13, 0x5e, 0xe7, 0x45, 0x14, 0x51, 0x40, 0xe4, 0xd6, 0xac, 0x2a, 0x02, 0x2f,
+    0xae, 0x2a, 0x64, 0xe0, 0xd3, 0xb1, 0x52, 0xa8, 0xcf, 0x3e, 0x95, 0x2a, 0x7a, 0x11, 0x5f, 0xff,
+    0xd5, 0xae, 0x17, 0x9e, 0x2a, 0x55, 0x18, 0xea, 0x29, 0xea, 0x33, 0xd2, 0xa4, 0xc6, 0x69, 0xeb,
+    0xd6, 0xba, 0x4d, 0x2a, 0x5f, 0x32, 0xd8, 0x03, 0xd5, 0x78, 0xab, 0xb4, 0x51, 0x45, 0x15, 0xcc,
+    0x7c, 0x42, 0xd1, 0x06, 0xb7, 0xe1, 0xd9, 0xe2, 0x51, 0x99, 0x50, 0x6f, 0x4f, 0xa8, 0xaf, 0x9a,
+    0x27, 0x89, 0xa1, 0x99, 0xe3, 0x90, 0x10, 0xca, 0x70, 0x41, 0xa6, 0x51, 0x45, 0x7f, 0xff, 0xd6,
+    0xf9, 0xda, 0x95, 0x41, 0x66, 0x00, 0x0c, 0x93, 0x5f, 0x42, 0x7c, 0x24, 0xd0, 0x4e, 0x95, 0xa1,
+    0x0b, 0x89, 0x57, 0x13, 0x5c, 0x7c, 0xc7, 0xe9, 0x5d, 0xe5, 0x14, 0x51, 0x45, 0x49, 0x02, 0x6f,
+    0x90, 0x0a, 0xd6, 0x45, 0xc6, 0x05, 0x48, 0x38, 0xe9, 0x4f, 0x5e, 0x79, 0xef, 0x52, 0xaa, 0xd3,
+    0xd4, 0x0c, 0xe0, 0xd7, 0x8d, 0x28, 0xee, 0x39, 0xa9, 0x05, 0x7f, 0xff, 0xd7, 0x78, 0x18, 0x1c,
+    0x54, 0x8b, 0x90, 0x39, 0xa7, 0xa8, 0x24, 0xe6, 0xae, 0xd8, 0x5c, 0x18, 0x26, 0x19, 0xfb, 0xa7,
+    0x83, 0x5d, 0x02, 0xb0, 0x65, 0x05, 0x4e, 0x41, 0xa5, 0xa2, 0x8a, 0x29, 0x08, 0x04, 0x10, 0x7a,
+    0x1a, 0xf2, 0x1f, 0x8a, 0x1e, 0x04, 0x96, 0x7b, 0x86, 0xd4, 0x74, 0x98, 0x41, 0x04, 0x66, 0x44,
+    0x5f, 0xe7, 0x5e, 0x3f, 0x2c, 0x6f, 0x13, 0x94, 0x91, 0x4a, 0xb0, 0x38, 0x20, 0xd3, 0x68, 0xa1,
+    0x41, 0x62, 0x02, 0x82, 0x49, 0xaf, 0x4d, 0xf8, 0x6d, 0xe0, 0x4b, 0x9b, 0xab, 0xd8, 0x6f, 0xf5,
+    0x28, 0x76, 0xda, 0xaf, 0xcc, 0xaa, 0xdf, 0xc5, 0x5f, 0xff, 0xd0, 0xed, 0xa3, 0x45, 0x8d, 0x15,
+    0x10, 0x05, 0x55, 0x18, 0x00, 0x53, 0xa8, 0xa2, 0x8a, 0x2b, 0x46, 0xce, 0x1d, 0x8a, 0x18, 0xf5,
+    0x35, 0x70, 0x7d, 0x69, 0xea, 0x06, 0x38, 0xa9, 0x14, 0x53, 0xc0, 0xc0, 0xa7, 0x8f, 0x6a, 0xf1,
+    0xb5, 0x18, 0xe9, 0x4f, 0x03, 0xd6, 0xa4, 0x51, 0xcd, 0x48, 0x01, 0xdb, 0xeb, 0x5f, 0xff, 0xd1,
+    0xb8, 0x9c, 0xf4, 0xa9, 0x07, 0x5a, 0xd0, 0xb0, 0xb9, 0x68, 0xfe, 0x57, 0xfb, 0xb5, 0xae, 0xac,
+    0x18, 0x64, 0x1c, 0x8a, 0x5a, 0x28, 0xa2, 0x90, 0x80, 0xc0, 0x82, 0x32, 0x0d, 0x71, 0xde, 0x27,
+    0xf0, 0x06, 0x95, 0xad, 0x06, 0x75, 0x8c, 0x41, 0x70, 0x7f, 0x8d, 0x05, 0x70, 0x37, 0xdf, 0x08,
+    0xef, 0x92, 0x50, 0x2d, 0x2e, 0x63, 0x74, 0xc7, 0x56, 0xe2, 0x99, 0x69, 0xf0, 0x8f, 0x51, 0x69,
+    0x94, 0x5c, 0x5c, 0x44, 0xb1, 0xf7, 0x23, 0x9a, 0xed, 0xfc, 0x33, 0xf0, 0xdb, 0x4b, 0xd2, 0x8a,
+    0xc9, 0x72, 0x3e, 0xd3, 0x30, 0xee, 0xc3, 0x8a, 0xee, 0xa3, 0x45, 0x8d, 0x02, 0x46, 0xa1, 0x54,
+    0x70, 0x00, 0xa7, 0x51, 0x5f, 0xff, 0xd2, 0xee, 0x28, 0xa2, 0xaf, 0x5a, 0xdb, 0xe0, 0x86, 0x7f,
+    0xca, 0xae, 0xa8, 0xe3, 0x1d, 0xaa, 0x45, 0xa9, 0x17, 0x35, 0x20, 0xe4, 0xd3, 0xd4, 0x73, 0x52,
+    0x05, 0xf7, 0xaf, 0x1a, 0x5c, 0x54, 0x98, 0xcd, 0x3d, 0x40, 0xfa, 0x1a, 0x7a, 0x0a, 0x91, 0x57,
+    0x1c, 0x66, 0xa4, 0x03, 0x07, 0x81, 0x5f, 0xff, 0xd3, 0xd7, 0x00, 0xd5, 0xab, 0x6b, 0x86, 0x8b,
+    0x1c, 0x92, 0x2b, 0x4a, 0x29, 0xd6, 0x41, 0xc1, 0xc1, 0xa9, 0x68, 0xa2, 0x8a, 0x28, 0xa2, 0x8a,
+    0x28, 0xa2, 0x8a, 0x7c, 0x71, 0xb4, 0x87, 0x0a, 0x2b, 0xff, 0xd4, 0xf4, 0x98, 0x2d, 0x95, 0x79,
+    0x3c, 0x9a, 0xb4, 0x07, 0x6a, 0x91, 0x56, 0x9c, 0x07, 0x35, 0x28, 0x00, 0x8a, 0x7a, 0x8e, 0x2a,
+    0x41, 0x80, 0x3d, 0xe9, 0xc3, 0x38, 0xe2, 0xbc, 0x6c, 0x0a, 0x90, 0x74, 0xe9, 0x52, 0x28, 0xf5,
+    0xa9, 0x14, 0x01, 0xd0, 0xd4, 0x98, 0xe2, 0x9e, 0x07, 0xa5, 0x3c, 0x73, 0xde, 0xa4, 0x50, 0x3b,
+    0xd7, 0xff, 0xd5, 0xe8, 0x53, 0x23, 0xda, 0xac, 0xc5, 0x3b, 0x2f, 0x5e, 0x45, 0x59, 0x49, 0xd5,
+    0xba, 0xf1, 0x52, 0x06, 0x07, 0xa1, 0xa5, 0xa2, 0x8a, 0x28, 0xa2, 0x94, 0x02, 0x7a, 0x0a, 0x7a,
+    0xc4, 0xc7, 0xb6, 0x2a, 0xc4, 0x56, 0xca, 0x39, 0x27, 0x35, 0x69, 0x10, 0x01, 0xc7, 0x1f, 0x4a,
+    0x7a, 0x8e, 0x6a, 0x45, 0xce, 0x6b, 0xff, 0xd6, 0xf5, 0x95, 0x07, 0xd7, 0x8a, 0x91, 0x47, 0x14,
+    0xf5, 0x1c, 0xe0, 0x54, 0x8a, 0x05, 0x48, 0x07, 0x1e, 0xf4, 0xf5, 0x50, 0x45, 0x78, 0xd2, 0x8c,
+    0x9e, 0x6a, 0x55, 0x19, 0xef, 0x4f, 0xc0, 0xea, 0x69, 0xea, 0x3b, 0x74, 0xa9, 0x14, 0x75, 0xe7,
+    0x34, 0xf0, 0x38, 0xa7, 0xa8, 0x02, 0xa5, 0x51, 0x8e, 0x6a, 0x4e, 0x08, 0xa7, 0xaa, 0xe0, 0x57,
+    0xff, 0xd7, 0xea, 0x94, 0x02, 0x6a, 0x40, 0x31, 0x8e, 0x6a, 0x44, 0x66, 0xe9, 0x9a, 0x7a, 0x9c,
+    0xb6, 0x3b, 0x54, 0x98, 0xa7, 0x05, 0x18, 0x1c, 0xd3, 0xd2, 0x31, 0xdf, 0x9a, 0x90, 0x46, 0xa3,
+    0xb5, 0x48, 0xa3, 0x15, 0x22, 0xae, 0x6a, 0x45, 0x5a, 0x7a, 0x01, 0x4f, 0x1d, 0x7a, 0xd4, 0x80,
+    0x0e, 0x2a, 0x40, 0x9d, 0x69, 0xe0, 0x57, 0xff, 0xd0, 0xf6, 0x30, 0x38, 0xc1, 0xe9, 0x4f, 0x51,
+    0x8e, 0x95, 0x22, 0xae, 0x39, 0x35, 0x20, 0x5c, 0xf3, 0xd2, 0xbc, 0x68, 0x0e, 0x80, 0xd4, 0x80,
+    0x76, 0xcd, 0x3f, 0x1c, 0xe0, 0xd4, 0x80, 0x75, 0xa9, 0x11, 0x41, 0x19, 0xa7, 0x81, 0x4f, 0x51,
+    0x93, 0x91, 0x52, 0x75, 0xc5, 0x3d, 0x7f, 0x2a, 0x91, 0x47, 0x15, 0x22, 0x8c, 0x1e, 0x2a, 0x4c,
+    0x60, 0xe4, 0x57, 0xff, 0xd1, 0xed, 0x36, 0xd3, 0xc0, 0xe6, 0xa5, 0x03, 0x03, 0xa7, 0x34, 0xe0,
+    0x09, 0x38, 0xe2, 0x9e, 0xa3, 0x9a, 0x94, 0x0a, 0x70, 0xed, 0x9a, 0x95, 0x78, 0xe2, 0x9e, 0xbd,
+    0xbd, 0x2a, 0x45, 0x19, 0xcf, 0xa5, 0x48, 0x07, 0x61, 0xd6, 0x9e, 0x14, 0x8a, 0x90, 0x7e, 0x54,
+    0xe0, 0x39, 0xa9, 0x40, 0x15, 0x20, 0x5e, 0x05, 0x7f, 0xff, 0xd2, 0xf6, 0xd0, 0x06, 0x39, 0x3c,
+    0x53, 0xd7, 0x04, 0x01, 0x5e, 0x34, 0x38, 0xa9, 0x55, 0x7a, 0x73, 0xd6, 0xa4, 0x0b, 0x9e, 0xf4,
+    0xf5, 0xeb, 0xcd, 0x48, 0x05, 0x3c, 0x0e, 0x38, 0xa7, 0x62, 0xa4, 0x45, 0xc8, 0xe6, 0xa4, 0x1d,
+    0x71, 0x52, 0x2a, 0xe6, 0x9e, 0x06, 0x3a, 0x53, 0xd4, 0x13, 0xde, 0xa5, 0x51, 0xd2, 0x9c, 0x00,
+    0xeb, 0xde, 0xbf, 0xff, 0xd3, 0xef, 0x80, 0xef, 0x9a, 0x7e, 0x39, 0xc8, 0xa9, 0x14, 0x7a, 0xf5,
+    0xa9, 0x30, 0x05, 0x3c, 0x73, 0x4f, 0x51, 0xc7, 0x15, 0x22, 0xf3, 0xda, 0x9e, 0xb4, 0xf0, 0x3d,
+    0x2a, 0x55, 0x14, 0xf0, 0x32, 0x6a, 0x45, 0x1d, 0x33, 0x52, 0x2f, 0x5f, 0x6a, 0x7f, 0x24, 0x53,
+    0xc0, 0xed, 0x4f, 0xc7, 0xbd, 0x7f, 0xff, 0xd4, 0xbc, 0x07, 0xad, 0x3c, 0x70, 0x38, 0xa9, 0x57,
+    0xa0, 0xcf, 0x34, 0xf5, 0x1c, 0xf1, 0x4f, 0xc7, 0xa7, 0x5a, 0x94, 0x63, 0x00, 0xd3, 0x80, 0xe3,
+    0x35, 0x22, 0x54, 0x80, 0x73, 0xc5, 0x3c, 0x74, 0xf7, 0xa9, 0x17, 0x91, 0x52, 0x05, 0xe9, 0x83,
+    0x4f, 0x4c, 0xf7, 0xa9, 0x00, 0xe7, 0xd6, 0xa4, 0x1c, 0x8e, 0x94, 0xf4, 0xf4, 0xaf, 0xff, 0xd5,
+    0xf4, 0x7c, 0x73, 0x52, 0x05, 0x15, 0x20, 0x1c, 0x71, 0x52, 0x27, 0x5e, 0xf4, 0xf1, 0xcd, 0x3c,
+    0x60, 0x53, 0x93, 0x9a, 0x91, 0x46, 0x7b, 0xd4, 0x8a, 0x30, 0x6a, 0x65, 0x1c, 0x52, 0x81, 0x9a,
+    0x95, 0x7e, 0x5e, 0x9c, 0xd3, 0x94, 0x67, 0xa8, 0xa9, 0x76, 0xd7, 0x8d, 0x0c, 0x11, 0x91, 0xd2,
+    0xa4, 0x51, 0xc5, 0x7f, 0xff, 0xd6, 0xd8, 0x45, 0xa9, 0x51, 0x79, 0xa7, 0x85, 0xc7, 0x27, 0xad,
+    0x3d, 0x17, 0xf2, 0xa9, 0x14, 0x0e, 0xf5, 0x22, 0x80, 0x39, 0x02, 0x9c, 0x05, 0x48, 0x2a, 0x40,
+    0xb4, 0xf5, 0x1c, 0xe7, 0xb5, 0x3d, 0x73, 0x9e, 0x3a, 0x53, 0xc7, 0x4e, 0x2a, 0x54, 0xc5, 0x3c,
+    0x0e, 0x39, 0x14, 0xf5, 0x18, 0xfa, 0xd4, 0xa0, 0x1a, 0xff, 0xd7, 0xf5, 0x20, 0xbc, 0x71, 0x4f,
+    0x19, 0x14, 0xf5, 0x1c, 0xe4, 0x9a, 0x78, 0x1c, 0xd3, 0xc0, 0xc1, 0xeb, 0x52, 0x28, 0x20, 0xfb,
+    0x54, 0xa0, 0x66, 0x9e, 0x06, 0x31, 0xcd, 0x48, 0xa0, 0x01, 0xef, 0x52, 0x28, 0xcf, 0x3d, 0xa9,
+    0xeb, 0xc7, 0xd6, 0xa4, 0xed, 0xc7, 0x5a, 0xf1, 0x90, 0x07, 0x4e, 0x6a, 0x50, 0x38, 0x00, 0x53,
+    0xd4, 0x0e, 0xf5, 0x22, 0x0c, 0x1a, 0xff, 0xd0, 0xe8, 0x80, 0xa7, 0xaf, 0x4e, 0x2a, 0x40, 0x31,
+    0xd6, 0x9f, 0x83, 0x8e, 0xb4, 0xf0, 0x3a, 0x03, 0xd6, 0xa4, 0x55, 0xc8, 0xa9, 0x06, 0x41, 0xc7,
+    0x6a, 0x70, 0x15, 0x22, 0xa9, 0xa9, 0x40, 0xc5, 0x3c, 0x0e, 0x2a, 0x45, 0x5c, 0xe3, 0x3c, 0xd3,
+    0xc7, 0x07, 0x14, 0xfc, 0x1a, 0x95, 0x47, 0x14, 0xf5, 0x19, 0x15, 0xff, 0xd1, 0xf5, 0xb5, 0x18,
+    0xe2, 0x9e, 0x07, 0xe5, 0x52, 0x01, 0xf8, 0x54, 0xa8, 0xb9, 0x19, 0x27, 0x9a, 0x7a, 0xf5, 0xa7,
+    0x81, 0x93, 0x4f, 0x51, 0xc7, 0x35, 0x22, 0x81, 0xd2, 0x9e, 0xa3, 0x1d, 0x6a, 0x41, 0xdb, 0x1c,
+    0x57, 0x8d, 0xaf, 0xcc, 0x72, 0x7a, 0x54, 0x80, 0x7a, 0x53, 0x94, 0x54, 0x80, 0x77, 0xa7, 0x8c,
+    0xf1, 0x53, 0x28, 0xcd, 0x7f, 0xff, 0xd2, 0xea, 0xea, 0x55, 0x14, 0xf5, 0xe3, 0xb5, 0x3c, 0x2e,
+    0x7a, 0x71, 0x52, 0x2f, 0x5e, 0x2a, 0x40, 0x0e, 0x29, 0xeb, 0xc1, 0xce, 0x6a, 0x40, 0x33, 0xc8,
+    0xa7, 0xa8, 0xf6, 0xcd, 0x48, 0x01, 0xcf, 0x4a, 0x90, 0x2e, 0x5b, 0x93, 0x4f, 0x03, 0xe6, 0x00,
+    0xd4, 0x80, 0x60, 0x7d, 0x29, 0xca, 0x3a, 0x01, 0x52, 0xe3, 0x8c, 0x8a, 0x7a, 0x0f, 0xc6, 0xbf,
+    0xff, 0xd3, 0xf6, 0x60, 0x3d, 0x69, 0xe1, 0x79, 0xf6, 0xa9, 0x02, 0xe3, 0xa1, 0xa7, 0x80, 0x33,
+    0xcd, 0x3c, 0x2f, 0x4a, 0x78, 0xe0, 0xd4, 0xa0, 0x70, 0x29, 0xc0, 0x6e, 0xeb, 0x5e, 0x38, 0x06,
+    0x07, 0x14, 0xe5, 0xe2, 0xa4, 0x00, 0x62, 0xa4, 0x03, 0x8a, 0x78, 0xe7, 0xad, 0x49, 0x8e, 0x2a,
+    0x40, 0x32, 0x01, 0xa9, 0x05, 0x7f, 0xff, 0xd4, 0xed, 0x87, 0x4c, 0xd4, 0x8a, 0x32, 0x29, 0xca,
+    0x00, 0x35, 0x22, 0xf5, 0xa7, 0x80, 0x3f, 0x1a, 0x78, 0x18, 0x23, 0x3d, 0x2a, 0x45, 0x15, 0x22,
+    0x8c, 0x1e, 0x6a, 0x45, 0x19, 0xa9, 0x15, 0x70, 0x72, 0x6a, 0x40, 0x29, 0xca, 0x39, 0x19, 0xa9,
+    0x31, 0x9a, 0x7a, 0x8c, 0x1c, 0x1a, 0x94, 0x0e, 0x69, 0xeb, 0xd2, 0xbf, 0xff, 0xd5, 0xf6, 0xe0,
+    0x33, 0x8a, 0x90, 0x8e, 0x45, 0x48, 0x38, 0x3e, 0xb4, 0xf0, 0x01, 0xf5, 0xa9, 0x3a, 0xfd, 0x2a,
+    0x45, 0xe8, 0x3b, 0xd7, 0x8d, 0x00, 0x3a, 0xf7, 0xa9, 0x06, 0x3f, 0x1f, 0x4a, 0x7a, 0x8a, 0x97,
+    0x6e, 0x3a, 0x0a, 0x7a, 0x8c, 0xd3, 0x85, 0x48, 0x05, 0x4a, 0xa0, 0x63, 0x14, 0xf0, 0xbc, 0x62,
+    0x9c, 0x17, 0xd2, 0xbf, 0xff, 0xd6, 0xf4, 0x00, 0x32, 0x38, 0xa7, 0x8e, 0x0f, 0x1c, 0xd3, 0xc7,
+    0x27, 0x35, 0x22, 0x8c, 0x9a, 0x93, 0x1c, 0xd3, 0xd4, 0x0d, 0xbc, 0x54, 0x8a, 0x6a, 0x45, 0x04,
+    0xfb, 0x8a, 0x7a, 0x8e, 0x29, 0xea, 0x29, 0xe3, 0x83, 0xc7, 0x35, 0x20, 0xe7, 0xaf, 0x5a, 0x93,
+    0x1d, 0x39, 0xa9, 0x23, 0x19, 0xa7, 0x8e, 0x31, 0x83, 0x4f, 0x02, 0xbf, 0xff, 0xd7, 0xf7, 0x81,
+    0x8f, 0xc6, 0xa4, 0x00, 0x1e, 0x73, 0x52, 0x6d, 0x3c, 0x1c, 0xd3, 0xc7, 0x1c, 0xd7, 0xff, 0xd9,
+};
+
+static const uint8_t EYE_GRAY_RESTART_MEANS[] = {
+    0x5b, 0x5e, 0x60, 0x63, 0x64, 0x68, 0x6b, 0x6d, 0x71, 0x73, 0x76, 0x79, 0x7c, 0x7d, 0x81, 0x83,
+    0x86, 0x88, 0x8b, 0x8e, 0x91, 0x94, 0x96, 0x98, 0x9b, 0x9e, 0xa0, 0xa3, 0xa6, 0xa8, 0x5d, 0x5f,
+    0x62, 0x65, 0x67, 0x6a, 0x6d, 0x70, 0x72, 0x75, 0x78, 0x79, 0x7d, 0x7f, 0x82, 0x85, 0x87, 0x8b,
+    0x8d, 0x90, 0x93, 0x95, 0x98, 0x9a, 0x9c, 0xa0, 0xa3, 0xa5, 0xa8, 0xaa, 0x5f, 0x61, 0x64, 0x66,
+    0x6a, 0x6c, 0x6e, 0x72, 0x75, 0x77, 0x79, 0x7c, 0x7f, 0x82, 0x85, 0x87, 0x8a, 0x8c, 0x8f, 0x91,
+    0x94, 0x96, 0x99, 0x9d, 0x9e, 0xa2, 0xa4, 0xa7, 0xaa, 0xac, 0x61, 0x64, 0x67, 0x69, 0x6c, 0x6e,
+    0x70, 0x74, 0x77, 0x7a, 0x7b, 0x7e, 0x80, 0x84, 0x86, 0x89, 0x8b, 0x8e, 0x91, 0x94, 0x96, 0x99,
+    0x9c, 0x9e, 0xa0, 0xa3, 0xa6, 0xa9, 0xab, 0xad, 0x64, 0x65, 0x68, 0x6b, 0x6e, 0x70, 0x73, 0x75,
+    0x78, 0x7b, 0x7e, 0x80, 0x82, 0x85, 0x88, 0x8b, 0x8d, 0x91, 0x93, 0x96, 0x99, 0x9c, 0x9d, 0xa0,
+    0xa3, 0xa6, 0xa9, 0xab, 0xae, 0xb0, 0x65, 0x67, 0x6a, 0x6d, 0x70, 0x72, 0x75, 0x77, 0x7a, 0x7c,
+    0x80, 0x83, 0x85, 0x88, 0x8b, 0x8e, 0x90, 0x93, 0x96, 0x97, 0x9a, 0x9c, 0x9f, 0xa2, 0xa5, 0xa8,
+    0xa9, 0xac, 0xaf, 0xb2, 0x67, 0x6a, 0x6d, 0x6f, 0x72, 0x74, 0x78, 0x7a, 0x7c, 0x7f, 0x82, 0x84,
+    0x87, 0x8a, 0x8b, 0x8f, 0x91, 0x94, 0x97, 0x9a, 0x9c, 0x9f, 0xa1, 0xa4, 0xa8, 0xa9, 0xab, 0xaf,
+    0xb2, 0xb4, 0x68, 0x6b, 0x6e, 0x71, 0x73, 0x76, 0x78, 0x7b, 0x7e, 0x81, 0x84, 0x86, 0x89, 0x8b,
+    0x8f, 0x91, 0x93, 0x96, 0x99, 0x9c, 0x9f, 0xa1, 0xa4, 0xa6, 0xa9, 0xac, 0xae, 0xb0, 0xb4, 0xb6,
+    0x6b, 0x6e, 0x70, 0x72, 0x75, 0x79, 0x7b, 0x7f, 0x80, 0x83, 0x85, 0x88, 0x8d, 0x93, 0x96, 0x98,
+    0x99, 0x9a, 0x9b, 0x9d, 0xa0, 0xa3, 0xa6, 0xa9, 0xac, 0xae, 0xb1, 0xb3, 0xb5, 0xb8, 0x6d, 0x6f,
+    0x72, 0x74, 0x77, 0x7a, 0x7d, 0x80, 0x82, 0x8c, 0x9a, 0xa4, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9,
+    0xa8, 0xa6, 0xa4, 0xa5, 0xa8, 0xab, 0xad, 0xb0, 0xb1, 0xb5, 0xb8, 0xbc, 0x6f, 0x72, 0x73, 0x77,
+    0x79, 0x7c, 0x7f, 0x87, 0x9f, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xa9, 0xaa, 0xac, 0xaf, 0xb2, 0xb3, 0xb7, 0xba, 0xbd, 0x71, 0x73, 0x76, 0x79, 0x7c, 0x7f,
+    0x8b, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x93, 0x68, 0x66, 0x8d, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xad, 0xb2, 0xb4, 0xb7, 0xb9, 0xbc, 0xbe, 0x73, 0x75, 0x78, 0x7a, 0x7d, 0x87, 0xa7, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x72, 0x1f, 0x19, 0x25, 0x7a, 0x68, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xb0, 0xb5, 0xb8, 0xbb, 0xbd, 0xc1, 0x74, 0x77, 0x7b, 0x7c, 0x7f, 0x9c, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0x93, 0x1f, 0x19, 0x19, 0x3a, 0xca, 0x2b, 0x85, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0xb8,
+    0xba, 0xbd, 0xc0, 0xc2, 0x77, 0x7a, 0x7b, 0x7f, 0x83, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x69,
+    0x19, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x56, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb8, 0xbc, 0xbf,
+    0xc2, 0xc4, 0x79, 0x7b, 0x7f, 0x81, 0x85, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x66, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x54, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xba, 0xbe, 0xc0, 0xc3, 0xc7,
+    0x7a, 0x7e, 0x80, 0x83, 0x85, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8d, 0x1c, 0x19, 0x19, 0x19,
+    0x19, 0x1a, 0x7d, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xad, 0xbd, 0xc1, 0xc3, 0xc7, 0xc9, 0x7d, 0x80,
+    0x82, 0x85, 0x88, 0x91, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x63, 0x1b, 0x19, 0x19, 0x19, 0x53,
+    0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb7, 0xc0, 0xc2, 0xc5, 0xc7, 0xca, 0x7f, 0x81, 0x84, 0x87,
+    0x89, 0x8c, 0x98, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x85, 0x56, 0x54, 0x7d, 0xa9, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xb5, 0xbe, 0xc1, 0xc4, 0xc7, 0xca, 0xcd, 0x81, 0x84, 0x86, 0x88, 0x8b, 0x8e,
+    0x91, 0x99, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xac,
+    0xb7, 0xbe, 0xc1, 0xc3, 0xc6, 0xc9, 0xcc, 0xcd, 0x82, 0x85, 0x88, 0x8b, 0x8e, 0x91, 0x93, 0x96,
+    0x99, 0xa0, 0xa6, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xad, 0xb3, 0xba, 0xbd, 0xc0,
+    0xc3, 0xc6, 0xc8, 0xcb, 0xce, 0xd0, 0x84, 0x88, 0x8a, 0x8d, 0x90, 0x92, 0x94, 0x98, 0x9b, 0x9d,
+    0x9f, 0xa3, 0xa5, 0xa8, 0xab, 0xac, 0xaf, 0xb1, 0xb4, 0xb8, 0xbb, 0xbd, 0xbf, 0xc2, 0xc5, 0xc7,
+    0xca, 0xcd, 0xd0, 0xd3, 0x87, 0x8a, 0x8c, 0x8f, 0x92, 0x94, 0x96, 0x9a, 0x9c, 0x9f, 0xa2, 0xa5,
+    0xa7, 0xa9, 0xad, 0xaf, 0xb1, 0xb5, 0xb6, 0xba, 0xbc, 0xbf, 0xc2, 0xc4, 0xc7, 0xc9, 0xcd, 0xd0,
+    0xd2, 0xd4, 0x88, 0x8c, 0x8f, 0x91, 0x94, 0x97, 0x98, 0x9b, 0x9e, 0xa1, 0xa3, 0xa6, 0xa9, 0xab,
+    0xaf, 0xb1, 0xb4, 0xb7, 0xb9, 0xbb, 0xbe, 0xc1, 0xc3, 0xc7, 0xc9, 0xcc, 0xcf, 0xd1, 0xd3, 0xd6,
+    0x8b, 0x8d, 0x90, 0x93, 0x95, 0x99, 0x9a, 0x9d, 0xa0, 0xa3, 0xa5, 0xa9, 0xab, 0xae, 0xb1, 0xb3,
+    0xb5, 0xb8, 0xbb, 0xbe, 0xc1, 0xc3, 0xc4, 0xc7, 0xca, 0xcf, 0xd0, 0xd3, 0xd5, 0xd9, 0x8d, 0x90,
+    0x92, 0x96, 0x98, 0x9a, 0x9d, 0xa0, 0xa2, 0xa5, 0xa8, 0xaa, 0xac, 0xaf, 0xb2, 0xb5, 0xb7, 0xba,
+    0xbe, 0xc0, 0xc2, 0xc4, 0xc6, 0xca, 0xcd, 0xd0, 0xd3, 0xd6, 0xd8, 0xdb, 0x8e, 0x92, 0x94, 0x97,
+    0x9a, 0x9c, 0x9f, 0xa1, 0xa3, 0xa6, 0xa9, 0xab, 0xae, 0xb2, 0xb4, 0xb7, 0xb9, 0xbb, 0xbf, 0xc1,
+    0xc4, 0xc7, 0xc9, 0xcd, 0xd0, 0xd2, 0xd4, 0xd7, 0xd9, 0xdc, 0x91, 0x94, 0x96, 0x99, 0x9b, 0xa0,
+    0xa0, 0xa4, 0xa6, 0xa9, 0xac, 0xae, 0xb1, 0xb4, 0xb6, 0xb9, 0xbc, 0xbe, 0xc1, 0xc3, 0xc7, 0xc9,
+    0xcd, 0xcf, 0xd2, 0xd4, 0xd6, 0xd9, 0xdc, 0xde, 0x94, 0x95, 0x98, 0x9b, 0x9d, 0xa0, 0xa3, 0xa6,
+    0xa8, 0xab, 0xad, 0xb0, 0xb2, 0xb5, 0xb8, 0xbb, 0xbe, 0xc0, 0xc4, 0xc5, 0xc8, 0xca, 0xce, 0xd0,
+    0xd2, 0xd5, 0xd8, 0xdb, 0xde, 0xe1, 0x95, 0x98, 0x9a, 0x9e, 0xa0, 0xa2, 0xa5, 0xa9, 0xab, 0xac,
+    0xb0, 0xb2, 0xb5, 0xb7, 0xbb, 0xbd, 0xc0, 0xc3, 0xc5, 0xc7, 0xc9, 0xcd, 0xd0, 0xd2, 0xd5, 0xd7,
+    0xda, 0xdd, 0xe0, 0xe2,
+};
+
+static const uint8_t EYE_PROGRESSIVE[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x0a, 0x07, 0x07, 0x08, 0x07, 0x06, 0x0a,
+    0x08, 0x08, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x0e, 0x18, 0x10, 0x0e, 0x0d, 0x0d, 0x0e, 0x1d, 0x15,
+    0x16, 0x11, 0x18, 0x23, 0x1f, 0x25, 0x24, 0x22, 0x1f, 0x22, 0x21, 0x26, 0x2b, 0x37, 0x2f, 0x26,
+    0x29, 0x34, 0x29, 0x21, 0x22, 0x30, 0x41, 0x31, 0x34, 0x39, 0x3b, 0x3e, 0x3e, 0x3e, 0x25, 0x2e,
+    0x44, 0x49, 0x43, 0x3c, 0x48, 0x37, 0x3d, 0x3e, 0x3b, 0xff, 0xc2, 0x00, 0x0b, 0x08, 0x00, 0xf0,
+    0x00, 0xf0, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1a, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x05, 0x03,
+    0x04, 0x06, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x15, 0x55, 0xd2,
+    0xaa, 0xaa, 0xaa, 0xba, 0x55, 0x78, 0x2a, 0xaa, 0xaa, 0xea, 0x5d, 0x2a, 0xaa, 0xea, 0x74, 0xf0,
+    0x34, 0xda, 0x55, 0x55, 0x74, 0xaa, 0xaa, 0xaa, 0xaf, 0x07, 0x56, 0x95, 0x55, 0x55, 0x5d, 0x5a,
+    0xb4, 0xaa, 0xab, 0xc1, 0x55, 0xd4, 0xba, 0x55, 0x55, 0x74, 0xb6, 0x95, 0x57, 0x82, 0xaa, 0xaa,
+    0xe9, 0x55, 0x55, 0x55, 0x75, 0x3a, 0x78, 0x2a, 0xaa, 0xaa, 0xba, 0xb4, 0xaa, 0xab, 0xa9, 0x74,
+    0xf0, 0x1d, 0x2a, 0xaa, 0xab, 0xa5, 0x55, 0x55, 0x57, 0x57, 0x07, 0x52, 0xe9, 0x55, 0x75, 0xad,
+    0x4c, 0xda, 0xb4, 0xaa, 0xaf, 0x05, 0x55, 0xd2, 0xef, 0xdb, 0xd3, 0x53, 0x44, 0x16, 0x95, 0x57,
+    0x5c, 0x05, 0x55, 0xf4, 0xfa, 0x7d, 0x1a, 0xaa, 0xaa, 0x16, 0xd5, 0xa5, 0xe0, 0xaa, 0xbe, 0xbf,
+    0x5e, 0xaa, 0xbe, 0x6e, 0x69, 0xd0, 0xfa, 0xda, 0xa5, 0x74, 0xaf, 0x05, 0x9d, 0x7a, 0x7d, 0x9a,
+    0xaa, 0xe4, 0x7e, 0x7b, 0x3e, 0x9f, 0xa2, 0xf0, 0xed, 0x35, 0x5a, 0xd2, 0xba, 0xe0, 0x3a, 0xb5,
+    0xf5, 0xfb, 0x55, 0x7c, 0xbf, 0x91, 0xcd, 0xf6, 0xfe, 0xe7, 0xf0, 0x1f, 0xa4, 0xfb, 0xea, 0xaf,
+    0x55, 0x5e, 0x0a, 0xba, 0xfb, 0xb5, 0x55, 0xc4, 0xe0, 0x55, 0x5d, 0x8f, 0xd1, 0x55, 0x5e, 0xba,
+    0x57, 0x82, 0xae, 0xbe, 0xe6, 0xab, 0x87, 0xc1, 0xaa, 0xba, 0xff, 0x00, 0xa3, 0xaa, 0xbd, 0xb5,
+    0x69, 0xe0, 0x69, 0x5f, 0xaf, 0xd2, 0xab, 0xe3, 0xfc, 0x91, 0x55, 0xfa, 0x8e, 0x95, 0x53, 0xed,
+    0xa5, 0x78, 0x1a, 0x57, 0xd3, 0xe9, 0x6a, 0x38, 0x7c, 0x2a, 0xba, 0xff, 0x00, 0xa2, 0x6a, 0xbd,
+    0x76, 0xab, 0xc1, 0x5d, 0x4f, 0xaf, 0xbb, 0x51, 0xf0, 0xf3, 0x0e, 0x8f, 0x45, 0xaa, 0xf4, 0xf4,
+    0x55, 0x78, 0x2a, 0xae, 0xb7, 0xeb, 0xaa, 0xaa, 0xaa, 0xaf, 0x5d, 0xaa, 0xaf, 0x05, 0x55, 0x5d,
+    0x6b, 0x6b, 0x55, 0x4e, 0xb6, 0xae, 0x95, 0x78, 0x2a, 0xaa, 0xab, 0xa5, 0x67, 0x4a, 0xaa, 0xab,
+    0xa7, 0x81, 0xa5, 0x55, 0x55, 0x5d, 0x4e, 0xad, 0x2a, 0xaa, 0xea, 0xe0, 0xba, 0x56, 0xd2, 0xaa,
+    0xae, 0x95, 0x55, 0x55, 0x5e, 0x0a, 0xae, 0xa7, 0x4a, 0xaa, 0xab, 0xa6, 0x5d, 0x2a, 0xbc, 0x15,
+    0x55, 0xd4, 0xea, 0x5d, 0x2a, 0xaa, 0xba, 0x55, 0x78, 0x1a, 0x55, 0x55, 0x57, 0x4a, 0xaa, 0xae,
+    0x96, 0xd5, 0xae, 0x0b, 0x69, 0x55, 0x55, 0x5d, 0x2b, 0x69, 0x55, 0x5d, 0x5c, 0x29, 0xd2, 0xaa,
+    0xaa, 0xaa, 0xea, 0x74, 0xaa, 0xab, 0xc1, 0x5d, 0x33, 0xa5, 0x55, 0x55, 0x55, 0x74, 0xda, 0x57,
+    0xff, 0xc4, 0x00, 0x26, 0x10, 0x00, 0x01, 0x03, 0x03, 0x04, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x11, 0x00, 0x04, 0x20, 0x05, 0x12, 0x30, 0x40,
+    0x13, 0x10, 0x21, 0x22, 0x31, 0x23, 0x70, 0x80, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01,
+    0x05, 0x02, 0xfd, 0xfb, 0x06, 0xb6, 0x9a, 0xda, 0x6a, 0x3a, 0xe1, 0x24, 0xd0, 0x6e, 0xb6, 0x8e,
+    0x08, 0xe9, 0x04, 0x93, 0x41, 0x11, 0xdc, 0x4a, 0x66, 0xa2, 0x32, 0x71, 0xf4, 0x37, 0x4a, 0xd4,
+    0x05, 0x0d, 0x44, 0x4b, 0x77, 0x2d, 0xb9, 0xd3, 0x48, 0x92, 0x04, 0x65, 0x75, 0x75, 0xe3, 0xa2,
+    0xa2, 0xa3, 0x4d, 0xb6, 0xa7, 0x56, 0x74, 0x85, 0xa5, 0xbb, 0x7b, 0x95, 0x05, 0xe4, 0x38, 0xdb,
+    0x1e, 0xd8, 0xbe, 0xe7, 0x8d, 0xa5, 0x1d, 0xc7, 0xd2, 0xd1, 0xe0, 0xc5, 0xc2, 0xaf, 0xd8, 0x0d,
+    0x3a, 0xe6, 0xf7, 0xad, 0x1d, 0xf2, 0x35, 0xd0, 0x1f, 0x58, 0xea, 0x0a, 0xf8, 0xe5, 0xa7, 0xab,
+    0xe7, 0xce, 0x28, 0x7d, 0x63, 0xa8, 0x8f, 0x6c, 0xb4, 0xf1, 0xf9, 0x3a, 0x08, 0x3e, 0xd8, 0xdc,
+    0xb7, 0xe4, 0x68, 0x88, 0x38, 0xd9, 0x35, 0xb1, 0xbc, 0x47, 0x1a, 0x4c, 0x1c, 0xae, 0xed, 0x49,
+    0x38, 0x5a, 0xda, 0x92, 0xac, 0x80, 0xe4, 0x49, 0xcd, 0xdb, 0x46, 0xdc, 0xa5, 0x69, 0xea, 0xa1,
+    0xa7, 0xae, 0x5a, 0xb2, 0x42, 0x33, 0x03, 0x98, 0x1a, 0x9e, 0x60, 0x3a, 0x33, 0x53, 0xc3, 0x15,
+    0x1f, 0xc3, 0x1f, 0xff, 0xc4, 0x00, 0x25, 0x10, 0x00, 0x01, 0x03, 0x03, 0x02, 0x06, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x21, 0x12, 0x20, 0x40, 0x10,
+    0x11, 0x03, 0x13, 0x31, 0x41, 0x51, 0x80, 0x22, 0x61, 0x71, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01,
+    0x00, 0x06, 0x3f, 0x02, 0xf5, 0x5e, 0x4a, 0x86, 0xa9, 0x6a, 0x83, 0x95, 0x4b, 0x7a, 0xad, 0xce,
+    0x81, 0xad, 0xea, 0x55, 0x41, 0xff, 0x00, 0x2f, 0x0b, 0x95, 0xc4, 0xc8, 0x25, 0x6e, 0x75, 0x6b,
+    0xca, 0xaa, 0xb1, 0xf8, 0x8b, 0xc7, 0x72, 0xbe, 0xc6, 0x38, 0x17, 0x91, 0x8e, 0xd3, 0x79, 0x38,
+    0xe4, 0x5f, 0xbf, 0x73, 0x91, 0x5b, 0x05, 0xb5, 0x38, 0x46, 0x57, 0x82, 0xa0, 0xa9, 0x2a, 0x64,
+    0xfa, 0xb1, 0xff, 0xc4, 0x00, 0x21, 0x10, 0x01, 0x00, 0x01, 0x04, 0x02, 0x03, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x10, 0x20, 0x30, 0x21, 0x41, 0x31,
+    0x40, 0x51, 0x50, 0x61, 0x81, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x3f, 0x21, 0xdc,
+    0x6a, 0x30, 0x31, 0x2c, 0x67, 0x1e, 0xa9, 0x80, 0x6b, 0x0b, 0x19, 0x1b, 0x0c, 0x4c, 0x0d, 0xc6,
+    0x06, 0x82, 0xe5, 0xe2, 0x8f, 0xc0, 0x8a, 0x2e, 0x6a, 0x37, 0x1e, 0xa9, 0xa0, 0xf5, 0xc1, 0x7a,
+    0xa1, 0xba, 0xb8, 0x4c, 0xea, 0xa3, 0x61, 0x63, 0x13, 0x0c, 0x0e, 0xda, 0x03, 0xaa, 0x8c, 0xa0,
+    0xb2, 0x23, 0x13, 0x41, 0x87, 0x88, 0xa2, 0xf2, 0xe7, 0x79, 0x81, 0xa6, 0x7f, 0xf2, 0x80, 0x20,
+    0xc8, 0xfe, 0xff, 0x00, 0x94, 0x37, 0xcc, 0x57, 0x50, 0x95, 0xd6, 0x8f, 0xc7, 0x33, 0x51, 0x7e,
+    0x01, 0x06, 0x4e, 0xbf, 0xdc, 0xd4, 0xc0, 0x96, 0xc4, 0x54, 0xd1, 0xe3, 0xf8, 0x4d, 0x3c, 0x61,
+    0x4e, 0x27, 0x60, 0xb1, 0x84, 0x13, 0xfb, 0x91, 0xf7, 0x3d, 0x52, 0xaa, 0x4a, 0xdc, 0x02, 0x90,
+    0xa6, 0x73, 0x38, 0xa7, 0x82, 0xdc, 0x95, 0x0d, 0x2f, 0xd3, 0x23, 0xce, 0xa0, 0xe6, 0x84, 0x0c,
+    0x98, 0xe9, 0xb8, 0xcd, 0x98, 0xeb, 0xa6, 0x67, 0x8d, 0x3e, 0x55, 0xc8, 0x64, 0xaf, 0x50, 0xcd,
+    0x5e, 0x80, 0x66, 0x78, 0xa2, 0xe6, 0x52, 0x65, 0xfb, 0xe1, 0xc9, 0x48, 0x83, 0xd6, 0x5c, 0xbf,
+    0x24, 0x4b, 0x46, 0xb4, 0xf3, 0x97, 0xfb, 0x94, 0x52, 0x23, 0x0e, 0x07, 0xab, 0x40, 0x08, 0x32,
+    0x8b, 0x9d, 0x45, 0xa1, 0xf3, 0x9f, 0x33, 0x1f, 0xd0, 0xa1, 0xbc, 0x69, 0x4c, 0xe0, 0x85, 0x73,
+    0x75, 0x80, 0x08, 0x32, 0xef, 0x75, 0x18, 0x21, 0x40, 0x76, 0x84, 0xd4, 0x36, 0x8d, 0xc5, 0x0a,
+    0x8d, 0x29, 0x51, 0x50, 0xd1, 0x1e, 0x88, 0x54, 0x5e, 0x30, 0x8d, 0x47, 0xaf, 0x1f, 0x9a, 0x5c,
+    0xc0, 0xb9, 0xac, 0xb1, 0x8c, 0x60, 0x7a, 0x67, 0xa8, 0x7b, 0x85, 0xa3, 0xd8, 0x8f, 0xc4, 0x33,
+    0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x00, 0x10, 0x77, 0x08, 0xff, 0x00, 0x0a, 0x5f,
+    0xdc, 0x7c, 0xc9, 0x0f, 0xc0, 0x37, 0xe8, 0x31, 0xea, 0x04, 0xfb, 0x81, 0xe2, 0x28, 0x7f, 0x05,
+    0xfe, 0xc0, 0xbf, 0xa1, 0x77, 0x30, 0x1f, 0x00, 0xf9, 0xb9, 0x05, 0x14, 0xfd, 0xf1, 0xf1, 0x70,
+    0x41, 0xec, 0x00, 0x4a, 0x41, 0x40, 0xd0, 0x30, 0x32, 0x01, 0xe0, 0x7b, 0x40, 0x42, 0x02, 0xff,
+    0x00, 0xc1, 0x02, 0x04, 0xcc, 0x04, 0x08, 0x05, 0x90, 0x00, 0x00, 0x42, 0x08, 0x50, 0x01, 0xfe,
+    0xf0, 0xb0, 0x01, 0xdf, 0x20, 0x01, 0x02, 0x1f, 0x50, 0x0f, 0x80, 0xa7, 0x86, 0x7f, 0xc8, 0x07,
+    0xda, 0x7b, 0x70, 0x92, 0xc0, 0x0e, 0x3b, 0x07, 0xe7, 0x44, 0x7b, 0x71, 0xec, 0x18, 0x06, 0x80,
+    0x22, 0x89, 0x6f, 0x86, 0xfd, 0x60, 0x53, 0xd8, 0x2f, 0x98, 0x0f, 0xf9, 0x7f, 0xff, 0xc4, 0x00,
+    0x22, 0x10, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x11, 0x21, 0x31, 0x41, 0x10, 0x51, 0x20, 0x61, 0x71, 0x81, 0x30, 0x91,
+    0xb1, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x3f, 0x10, 0x0f, 0xbb, 0x9e, 0x20, 0xd4,
+    0x71, 0x88, 0x22, 0x0d, 0xe6, 0xee, 0x0c, 0x41, 0xe3, 0xb8, 0x82, 0x18, 0x75, 0x06, 0x58, 0x83,
+    0x11, 0xc4, 0x1d, 0xb7, 0x30, 0x6a, 0x0b, 0x1a, 0xc4, 0x3f, 0x90, 0x75, 0x88, 0x31, 0x05, 0xa1,
+    0x06, 0xa0, 0x20, 0xf5, 0x06, 0xa1, 0x1b, 0xb6, 0x6c, 0x11, 0xf9, 0x19, 0x82, 0x33, 0x88, 0x18,
+    0x59, 0xb1, 0x8d, 0x44, 0x66, 0x0c, 0x41, 0x11, 0xb8, 0x2e, 0x58, 0xd6, 0xa2, 0x0d, 0xe6, 0x38,
+    0x83, 0xee, 0x0d, 0xc4, 0x6a, 0x0c, 0xc6, 0xb5, 0x63, 0x1c, 0x41, 0xf7, 0x01, 0x16, 0x2c, 0x1d,
+    0xc1, 0xdc, 0x17, 0x1c, 0x41, 0xb8, 0x8d, 0xf3, 0x05, 0xfc, 0x83, 0xee, 0xc5, 0xf6, 0x41, 0x8d,
+    0x42, 0x20, 0x88, 0x31, 0x10, 0xdc, 0x5f, 0xb6, 0x23, 0xc0, 0x41, 0x88, 0x88, 0x3d, 0xc2, 0x42,
+    0xfa, 0x8d, 0x31, 0x10, 0xf1, 0xb8, 0x2d, 0xb5, 0x63, 0xd5, 0x8f, 0x70, 0x6a, 0x0d, 0xd8, 0xc4,
+    0x1a, 0xd3, 0x19, 0x20, 0x60, 0xee, 0x0d, 0xdd, 0xf8, 0xc1, 0x72, 0xb0, 0xc1, 0xe4, 0x41, 0x86,
+    0x0d, 0xc1, 0x96, 0x0f, 0x06, 0x71, 0x70, 0xdc, 0x1a, 0xd4, 0x05, 0xc2, 0x0e, 0xe2, 0xda, 0x18,
+    0xd4, 0x11, 0x01, 0x04, 0x18, 0x6f, 0xc8, 0xe6, 0xc5, 0xc7, 0x56, 0x20, 0x8e, 0x6e, 0xa3, 0x70,
+    0x6e, 0x2c, 0x31, 0x06, 0x77, 0x11, 0x75, 0x06, 0x60, 0x31, 0x06, 0x23, 0xf2, 0x08, 0x23, 0x98,
+    0x20, 0xcb, 0x10, 0x36, 0xe1, 0xc9, 0xb8, 0x6a, 0xc4, 0x71, 0x11, 0xcc, 0x62, 0x08, 0x35, 0x16,
+    0x21, 0x63, 0x56, 0x23, 0x1d, 0x58, 0xf5, 0x04, 0x5d, 0x71, 0x04, 0x66, 0x0c, 0xc0, 0x62, 0x3e,
+    0xe3, 0x7e, 0x07, 0x80, 0x63, 0xd6, 0x23, 0x38, 0x81, 0x8f, 0xb8, 0x3c, 0x07, 0x51, 0x1e, 0xa0,
+    0x3d, 0x41, 0xbb, 0x19, 0x37, 0x06, 0x08, 0x20, 0xfe, 0xda, 0xea, 0x2f, 0xa7, 0x80, 0xb1, 0xbc,
+    0xc4, 0x06, 0x62, 0xc7, 0x80, 0x46, 0xec, 0x7d, 0x41, 0x10, 0x46, 0x23, 0x51, 0x1b, 0x82, 0x38,
+    0x83, 0xee, 0x20, 0x82, 0x0d, 0xc6, 0xe0, 0x48, 0x2c, 0x41, 0x69, 0x04, 0xda, 0x4c, 0xb5, 0x07,
+    0xd5, 0xf4, 0x5d, 0x89, 0x99, 0xd4, 0x10, 0x41, 0xa8, 0x20, 0x83, 0xee, 0xc7, 0xab, 0x18, 0x8c,
+    0x47, 0x3c, 0x5c, 0xc0, 0xbb, 0xd5, 0xf6, 0x83, 0x50, 0x41, 0x88, 0x21, 0xb8, 0x20, 0xff, 0x00,
+    0xb7, 0x02, 0x60, 0xfb, 0x81, 0xbc, 0xd0, 0x5a, 0x10, 0x0e, 0x03, 0xe3, 0x83, 0xd4, 0xb7, 0x52,
+    0x31, 0xad, 0x59, 0xc3, 0x4c, 0x6b, 0xc1, 0xa2, 0xd8, 0x83, 0x70, 0x78, 0x0f, 0x70, 0x78, 0xc6,
+    0xa1, 0xa8, 0x23, 0x51, 0x22, 0x03, 0x5e, 0xed, 0xfe, 0xc8, 0x03, 0x83, 0xfd, 0x30, 0x5a, 0x86,
+    0x63, 0x9d, 0x44, 0x73, 0x6d, 0x05, 0x84, 0xb1, 0xbe, 0x22, 0x20, 0xfb, 0xf0, 0x19, 0x97, 0x23,
+    0xc3, 0xb8, 0x80, 0x63, 0xe4, 0x9d, 0x0c, 0x3a, 0x3b, 0xb0, 0x97, 0xf6, 0x2e, 0x24, 0x01, 0xbb,
+    0x11, 0x8b, 0x01, 0xfc, 0xc6, 0x11, 0x32, 0x7c, 0x94, 0x71, 0x62, 0x08, 0x3d, 0x47, 0xe4, 0x6f,
+    0xc1, 0x62, 0xe1, 0x04, 0xb8, 0x7a, 0xee, 0x00, 0x18, 0x0f, 0x96, 0xb5, 0xa8, 0xfc, 0x26, 0x8b,
+    0x47, 0x2a, 0xbe, 0x10, 0x3b, 0x30, 0x05, 0xb2, 0xad, 0x40, 0xee, 0xc0, 0xec, 0xbd, 0x9c, 0xe6,
+    0x11, 0x32, 0x71, 0xf2, 0x59, 0x2c, 0x6e, 0x08, 0x20, 0x87, 0x81, 0x04, 0x11, 0x9b, 0x6c, 0xe7,
+    0xe4, 0x45, 0x38, 0xc3, 0x1f, 0xa9, 0x6a, 0x23, 0x39, 0x7c, 0xe6, 0x24, 0xf7, 0x04, 0x53, 0xb8,
+    0x1d, 0xfe, 0x58, 0x88, 0xe6, 0x0f, 0xa8, 0x85, 0x9b, 0x47, 0xc8, 0xf0, 0x22, 0x0f, 0xb8, 0x20,
+    0xcc, 0x71, 0x82, 0x0c, 0xb0, 0x07, 0x57, 0x30, 0x44, 0x82, 0x20, 0x1d, 0x1f, 0x22, 0x3f, 0x26,
+    0x5f, 0x8e, 0x58, 0xc6, 0x5c, 0x78, 0x00, 0xf6, 0x3e, 0x7b, 0x86, 0x08, 0x20, 0xc7, 0x70, 0x67,
+    0x70, 0x63, 0xb8, 0xe3, 0x51, 0x05, 0xa0, 0x64, 0x20, 0xf5, 0xf2, 0x08, 0x9b, 0x11, 0x7e, 0x65,
+    0x73, 0x80, 0xbf, 0x33, 0x81, 0xf9, 0xe1, 0x88, 0xf0, 0x0f, 0x50, 0x63, 0x92, 0x0c, 0xf1, 0xe0,
+    0xb0, 0x47, 0x67, 0xc8, 0x48, 0x35, 0x40, 0x25, 0x85, 0x61, 0xf8, 0x82, 0xb8, 0x39, 0x64, 0x31,
+    0xc6, 0xc7, 0xf3, 0xe5, 0x81, 0x21, 0x8d, 0x5c, 0x71, 0x10, 0x41, 0xd4, 0x1e, 0x03, 0x04, 0x71,
+    0x19, 0xcc, 0xc5, 0xe9, 0xe6, 0x10, 0x64, 0xf8, 0xa6, 0x4c, 0x32, 0x22, 0x39, 0x32, 0x53, 0xa0,
+    0x44, 0xe4, 0x7c, 0x82, 0xb8, 0x0c, 0xb6, 0x07, 0xc3, 0x60, 0xf7, 0x02, 0x0c, 0x07, 0x07, 0xcb,
+    0x13, 0x2e, 0x58, 0xfd, 0x82, 0x08, 0xd1, 0x11, 0xa8, 0x3d, 0xc5, 0xd7, 0x93, 0xeb, 0xc2, 0x11,
+    0x32, 0x7c, 0x50, 0x4c, 0x3c, 0x42, 0x27, 0x3e, 0x30, 0x5f, 0xbc, 0x43, 0x0e, 0xe8, 0x92, 0x61,
+    0x60, 0xed, 0xe2, 0x04, 0x00, 0x1c, 0x07, 0xcb, 0x06, 0x20, 0x3a, 0xea, 0x22, 0x39, 0x82, 0x08,
+    0xb1, 0x04, 0x20, 0xea, 0xc7, 0xa2, 0xc3, 0x77, 0xb9, 0x23, 0x7f, 0xd5, 0x5e, 0x88, 0x36, 0x79,
+    0x83, 0xa8, 0x98, 0x83, 0x24, 0x1a, 0x8c, 0x04, 0x41, 0x1c, 0x41, 0x01, 0xd7, 0x80, 0xb9, 0xee,
+    0x31, 0x64, 0x46, 0xe7, 0x64, 0x2f, 0xd4, 0x23, 0xdf, 0xcf, 0x0b, 0xd4, 0x27, 0x51, 0x1b, 0x5c,
+    0xc0, 0x71, 0x04, 0x40, 0xc4, 0x1b, 0xc4, 0x16, 0x35, 0x1a, 0x41, 0x07, 0xdd, 0x8e, 0xe2, 0x08,
+    0x35, 0x06, 0x23, 0x57, 0x24, 0x18, 0x20, 0x18, 0x31, 0xdc, 0x2f, 0x10, 0xee, 0xc5, 0x83, 0x10,
+    0xf7, 0x04, 0xea, 0x0c, 0x41, 0x98, 0x80, 0x44, 0x04, 0x78, 0x06, 0xa0, 0xc4, 0x18, 0xdb, 0x06,
+    0x60, 0xe9, 0x82, 0xfd, 0xb1, 0x01, 0x82, 0x0c, 0xb7, 0x31, 0x1c, 0x41, 0x86, 0xc6, 0x1b, 0x10,
+    0x58, 0xd4, 0x0f, 0x10, 0x6e, 0x0f, 0x06, 0xa2, 0x0c, 0xc1, 0xd1, 0x06, 0x22, 0x08, 0x22, 0x7f,
+    0x63, 0x66, 0x23, 0x50, 0x7d, 0xd8, 0x88, 0x82, 0xc4, 0x1a, 0x8e, 0x60, 0xcc, 0x10, 0x2f, 0x70,
+    0x40, 0x73, 0x07, 0x76, 0x20, 0xb1, 0x88, 0xdc, 0x1e, 0xa3, 0x71, 0x04, 0x11, 0xcc, 0x1c, 0x47,
+    0x36, 0xd8, 0x3a, 0xb1, 0x62, 0x35, 0x1c, 0x7b, 0x83, 0xc1, 0xc4, 0x11, 0x06, 0xef, 0xfd, 0x8e,
+    0x20, 0xb2, 0xee, 0x08, 0xdd, 0xe9, 0x62, 0xc1, 0x06, 0xae, 0x57, 0x31, 0x8f, 0x00, 0xcf, 0x70,
+    0x62, 0x08, 0x33, 0x1a, 0x83, 0x3c, 0xd8, 0x8c, 0x26, 0xa0, 0x82, 0x10, 0x62, 0x10, 0x41, 0x8e,
+    0x0f, 0x04, 0x40, 0xde, 0x63, 0x31, 0xe0, 0x71, 0x04, 0x0d, 0x88, 0xd4, 0x11, 0xcc, 0x10, 0x39,
+    0x83, 0x30, 0x63, 0xb8, 0xc6, 0x20, 0xce, 0xe2, 0xea, 0x2c, 0x7a, 0x80, 0xee, 0xe5, 0x62, 0x38,
+    0xd5, 0x8c, 0x58, 0x7d, 0xc1, 0x06, 0x63, 0x56, 0x20, 0xb1, 0x10, 0x46, 0xb5, 0x6e, 0x38, 0x83,
+    0x24, 0x18, 0xd4, 0x16, 0x21, 0xac, 0xc7, 0x36, 0x20, 0xd4, 0x41, 0x8e, 0x62, 0x37, 0xbe, 0xac,
+    0x41, 0x63, 0xbb, 0x70, 0x78, 0x08, 0xd7, 0x50, 0x67, 0xea, 0x2c, 0x6a, 0x3f, 0x60, 0xcc, 0x16,
+    0x1c, 0xc1, 0xbe, 0x60, 0xde, 0x20, 0xd4, 0x58, 0x84, 0x11, 0x03, 0x1d, 0xc1, 0xb8, 0x23, 0x98,
+    0x2c, 0x66, 0xc6, 0x0d, 0x46, 0xa3, 0x18, 0x88, 0xfb, 0xf0, 0x1a, 0xcf, 0x83, 0x88, 0x35, 0x06,
+    0x18, 0xe6, 0x03, 0xfb, 0x06, 0x1f, 0xa8, 0x22, 0x37, 0x18, 0x36, 0x20, 0xdd, 0x88, 0x37, 0x04,
+    0x71, 0x07, 0x17, 0x64, 0x6a, 0x03, 0xc1, 0xc4, 0x1d, 0xf7, 0x6a, 0x0b, 0x18, 0xea, 0x0c, 0xc4,
+    0x41, 0xac, 0x41, 0xac, 0x41, 0xea, 0x0c, 0xc6, 0x98, 0xdc, 0x6e, 0xc6, 0xe0, 0x31, 0x0c, 0x0b,
+    0x11, 0x1c, 0xea, 0x37, 0x62, 0x19, 0xbf, 0x20, 0x8c, 0x40, 0x73, 0x61, 0xf7, 0x1a, 0xdd, 0xff,
+    0xd9,
+};
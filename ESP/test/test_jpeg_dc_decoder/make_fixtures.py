@@ -0,0 +1,82 @@
+"""
+Regenerates fixtures.h, the JPEGs the JpegDCDecoder tests decode.
+
+A synthetic 240x240 eye - a bright gradient with a dark pupil and a glint -
+encoded the way the camera does (4:2:0, quality ~70), as grayscale with
+restart markers, and progressive. The expected thumbnails are the 8x8 block
+means of the luma plane of a full decode.
+
+    python make_fixtures.py > fixtures.h
+"""
+import io
+import random
+
+from PIL import Image, ImageDraw, ImageFilter
+
+SIZE = 240
+
+
+def eye():
+    random.seed(1)
+    image = Image.new("L", (SIZE, SIZE))
+    image.putdata([
+        min(255, 90 + x // 3 + y // 4 + random.randint(-6, 6))
+        for y in range(SIZE) for x in range(SIZE)
+    ])
+    draw = ImageDraw.Draw(image)
+    draw.ellipse((40, 70, 200, 170), fill=170)
+    draw.ellipse((92, 92, 148, 148), fill=25)
+    draw.ellipse((126, 100, 136, 110), fill=250)
+    return image.filter(ImageFilter.GaussianBlur(1))
+
+
+def encode(image, **options):
+    buffer = io.BytesIO()
+    image.save(buffer, "JPEG", **options)
+    return buffer.getvalue()
+
+
+def block_means(jpeg):
+    image = Image.open(io.BytesIO(jpeg))
+    if image.mode != "L":
+        # the luma plane as decoded, before the color conversion
+        image.draft("YCbCr", image.size)
+        image = image.convert("YCbCr").getchannel(0)
+    pixels = image.load()
+    width, height = image.size
+    means = []
+    for by in range(height // 8):
+        for bx in range(width // 8):
+            total = sum(pixels[bx * 8 + x, by * 8 + y]
+                        for y in range(8) for x in range(8))
+            means.append((total + 32) // 64)
+    return means
+
+
+def array(name, data):
+    lines = [f"static const uint8_t {name}[] = {{"]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    image = eye()
+    color = encode(image.convert("RGB"), quality=70, subsampling=2)
+    gray = encode(image, quality=80, restart_marker_blocks=16)
+    progressive = encode(image, quality=70, progressive=True)
+
+    print("// generated by make_fixtures.py, do not edit")
+    print("#pragma once")
+    print("#include <stdint.h>\n")
+    print(f"#define FIXTURE_SIZE {SIZE}\n")
+    print(array("EYE_420", color) + "\n")
+    print(array("EYE_420_MEANS", block_means(color)) + "\n")
+    print(array("EYE_GRAY_RESTART", gray) + "\n")
+    print(array("EYE_GRAY_RESTART_MEANS", block_means(gray)) + "\n")
+    print(array("EYE_PROGRESSIVE", progressive))
+
+
+if __name__ == "__main__":
+    main()
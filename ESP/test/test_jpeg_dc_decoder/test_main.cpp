@@ -0,0 +1,79 @@
+#include <unity.h>
+#include <chrono>
+#include "fixtures.h"
+#include "io/camera/jpegDCDecoder.cpp"
+
+//! the decoder is ~16KB, too much for the stack
+static JpegDCDecoder decoder;
+
+void setUp() {}
+void tearDown() {}
+
+static void assertThumbnail(const uint8_t* jpeg,
+                            size_t len,
+                            const uint8_t* means) {
+  TEST_ASSERT_EQUAL(JpegDCDecoder::DECODE_OK, decoder.decode(jpeg, len));
+  TEST_ASSERT_EQUAL(FIXTURE_SIZE, decoder.getImageWidth());
+  TEST_ASSERT_EQUAL(FIXTURE_SIZE, decoder.getImageHeight());
+  TEST_ASSERT_EQUAL(FIXTURE_SIZE / 8, decoder.getThumbnailWidth());
+  TEST_ASSERT_EQUAL(FIXTURE_SIZE / 8, decoder.getThumbnailHeight());
+
+  // the DC coefficient is quantized, the IDCT of a full decode rounds and
+  // clamps every pixel on its own
+  const uint8_t* thumbnail = decoder.getThumbnail();
+  for (size_t i = 0; i < (FIXTURE_SIZE / 8) * (FIXTURE_SIZE / 8); i++)
+    TEST_ASSERT_UINT8_WITHIN(2, means[i], thumbnail[i]);
+}
+
+void test_decode_420() {
+  assertThumbnail(EYE_420, sizeof(EYE_420), EYE_420_MEANS);
+}
+
+void test_decode_grayscale_restart_markers() {
+  assertThumbnail(EYE_GRAY_RESTART, sizeof(EYE_GRAY_RESTART),
+                  EYE_GRAY_RESTART_MEANS);
+}
+
+void test_rejects_progressive() {
+  TEST_ASSERT_EQUAL(JpegDCDecoder::DECODE_UNSUPPORTED,
+                    decoder.decode(EYE_PROGRESSIVE, sizeof(EYE_PROGRESSIVE)));
+}
+
+void test_rejects_garbage() {
+  const uint8_t notJpeg[] = {0x89, 'P', 'N', 'G', 0, 0, 0, 0};
+  TEST_ASSERT_EQUAL(JpegDCDecoder::DECODE_NOT_JPEG,
+                    decoder.decode(notJpeg, sizeof(notJpeg)));
+  // cut off in the tables, a cut off scan decodes with the rest zeroed
+  TEST_ASSERT_EQUAL(JpegDCDecoder::DECODE_CORRUPT,
+                    decoder.decode(EYE_420, 100));
+}
+
+/**
+ * @brief Not a pass/fail test, prints what a frame costs on the host, run
+ * with `pio test -e native -f test_jpeg_dc_decoder -v`
+ */
+void test_benchmark() {
+  const int iterations = 2000;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++)
+    TEST_ASSERT_EQUAL(JpegDCDecoder::DECODE_OK,
+                      decoder.decode(EYE_420, sizeof(EYE_420)));
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  char message[96];
+  snprintf(message, sizeof(message), "%u byte 240x240 frame: %lld us",
+           (unsigned)sizeof(EYE_420),
+           (long long)elapsed.count() / iterations / 1000);
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_decode_420);
+  RUN_TEST(test_decode_grayscale_restart_markers);
+  RUN_TEST(test_rejects_progressive);
+  RUN_TEST(test_rejects_garbage);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,108 @@
+#include <ArduinoJson.h>
+#include <unity.h>
+#include "data/utilities/jsonArena.cpp"
+
+#define MESSAGE_COUNT 500
+
+//! the heap the arena falls back to, counting what reaches it
+class CountingAllocator : public ArduinoJson::Allocator {
+ public:
+  void* allocate(size_t size) override {
+    allocations++;
+    outstanding++;
+    return malloc(size);
+  }
+  void deallocate(void* pointer) override {
+    if (pointer)
+      outstanding--;
+    free(pointer);
+  }
+  void* reallocate(void* pointer, size_t new_size) override {
+    allocations++;
+    if (!pointer)
+      outstanding++;
+    return realloc(pointer, new_size);
+  }
+
+  size_t allocations = 0;
+  size_t outstanding = 0;
+};
+
+static CountingAllocator heap;
+
+void setUp() {
+  heap.allocations = 0;
+  heap.outstanding = 0;
+}
+void tearDown() {}
+
+//! a command batch like the ones coming in over serial, different every time
+static void buildCommand(char* out, size_t size, int i) {
+  snprintf(out, size,
+           "{\"commands\": [{\"command\": \"set_wifi\", \"data\": "
+           "{\"name\": \"network%d\", \"ssid\": \"ssid-%08d\", \"password\": "
+           "\"password-%d-of-the-network\", \"channel\": %d, \"power\": 52}}, "
+           "{\"command\": \"set_mdns\", \"data\": {\"hostname\": "
+           "\"openiristracker%d\"}}, {\"command\": \"ping\"}]}",
+           i, i * 7919, i, i % 13 + 1, i);
+}
+
+void test_messages_stay_in_the_arena() {
+  JsonArena arena(JSON_ARENA_SIZE, &heap);
+  char input[512];
+  char output[256];
+
+  for (int i = 0; i < MESSAGE_COUNT; i++) {
+    buildCommand(input, sizeof(input), i);
+    {
+      JsonDocument command(&arena);
+      TEST_ASSERT_FALSE(deserializeJson(command, (const char*)input));
+      JsonArray commands = command["commands"].as<JsonArray>();
+      TEST_ASSERT_EQUAL(3, commands.size());
+      TEST_ASSERT_EQUAL(i % 13 + 1, commands[0]["data"]["channel"].as<int>());
+
+      JsonDocument response(&arena);
+      response["action"] = "parse_commands";
+      response["status"] = 1;
+      response["info"] = commands[0]["data"]["ssid"].as<std::string>();
+      TEST_ASSERT_GREATER_THAN(0,
+                               serializeJson(response, output, sizeof(output)));
+      TEST_ASSERT_GREATER_THAN(0, arena.getLive());
+    }
+    TEST_ASSERT_EQUAL(0, arena.getLive());
+    TEST_ASSERT_EQUAL(0, heap.allocations);
+  }
+}
+
+void test_oversized_message_falls_back() {
+  // room for a short message, not for a thousand values
+  JsonArena arena(4096, &heap);
+  std::string input = "{\"values\": [0";
+  for (int i = 1; i < 1000; i++)
+    input += "," + std::to_string(i);
+  input += "]}";
+  {
+    JsonDocument values(&arena);
+    TEST_ASSERT_FALSE(deserializeJson(values, input));
+    TEST_ASSERT_EQUAL(999, values["values"][999].as<int>());
+  }
+  TEST_ASSERT_GREATER_THAN(0, heap.allocations);
+  TEST_ASSERT_EQUAL(0, heap.outstanding);
+  TEST_ASSERT_EQUAL(0, arena.getLive());
+
+  // the next message that fits is back in the arena
+  heap.allocations = 0;
+  {
+    JsonDocument small(&arena);
+    TEST_ASSERT_FALSE(deserializeJson(small, "{\"command\": \"ping\"}"));
+  }
+  TEST_ASSERT_EQUAL(0, heap.allocations);
+  TEST_ASSERT_EQUAL(0, arena.getLive());
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_messages_stay_in_the_arena);
+  RUN_TEST(test_oversized_message_falls_back);
+  return UNITY_END();
+}
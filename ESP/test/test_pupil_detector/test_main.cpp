@@ -0,0 +1,202 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "processing/PupilTracker/PupilDetector.cpp"
+
+#define FRAME_SIZE 240
+#define SEQUENCE_LENGTH 120
+
+/**
+ * @brief Replays frames through the detector and checks the centers it finds
+ * @details The built-in sequence is synthetic: a pupil moving over an iris,
+ * with a gradient, sensor noise, a glint and an eyelid, all deterministic.
+ * Recorded frames can be replayed the same way, point OPENIRIS_PUPIL_REPLAY
+ * at a directory holding 8 bit binary PGMs and a centers.csv of
+ * "<file>,<x>,<y>" lines with the hand-labeled centers.
+ */
+
+static PupilDetector detector;
+static uint8_t frame[FRAME_SIZE * FRAME_SIZE];
+
+struct Eye_t {
+  float x;
+  float y;
+  //! semi-axes of the pupil
+  float a;
+  float b;
+  //! how far the upper lid comes down, 0 - open
+  float lid;
+};
+
+static uint32_t noiseState;
+
+//! tiny LCG, the frames must not depend on the platform's rand()
+static int noise() {
+  noiseState = noiseState * 1664525u + 1013904223u;
+  return (int)(noiseState >> 24) % 17 - 8;
+}
+
+static void render(const Eye_t& eye) {
+  for (int y = 0; y < FRAME_SIZE; y++) {
+    for (int x = 0; x < FRAME_SIZE; x++) {
+      int value = 130 + x / 4 + y / 6;
+      float dx = x - eye.x;
+      float dy = y - eye.y;
+      if (dx * dx + dy * dy < 48 * 48)
+        value = 105;
+      if ((dx * dx) / (eye.a * eye.a) + (dy * dy) / (eye.b * eye.b) < 1)
+        value = 25;
+      // the illuminator's reflection, up and right of the center
+      float gx = dx - eye.a / 2;
+      float gy = dy + eye.b / 2;
+      if (gx * gx + gy * gy < 9)
+        value = 245;
+      if (y < eye.lid)
+        value = 150;
+      value += noise();
+      frame[y * FRAME_SIZE + x] = value < 0 ? 0 : value > 255 ? 255 : value;
+    }
+  }
+}
+
+void setUp() {
+  noiseState = 1;
+  detector.setSettings({
+      .threshold = 0,
+      .fitEllipse = true,
+      .minArea = 0.002f,
+      .maxArea = 0.25f,
+  });
+}
+
+void tearDown() {}
+
+void test_synthetic_sequence() {
+  float totalError = 0;
+  float worstError = 0;
+  for (int i = 0; i < SEQUENCE_LENGTH; i++) {
+    float t = i * 2 * (float)M_PI / SEQUENCE_LENGTH;
+    Eye_t eye = {
+        .x = 120 + 45 * cosf(t),
+        .y = 120 + 30 * sinf(2 * t),
+        .a = 20 + 4 * sinf(3 * t),
+        .b = 18 + 4 * sinf(3 * t),
+        .lid = 0,
+    };
+    render(eye);
+
+    PupilResult_t result;
+    TEST_ASSERT_TRUE(detector.detect(frame, FRAME_SIZE, FRAME_SIZE, result));
+    float error = hypotf(result.x - eye.x, result.y - eye.y);
+    totalError += error;
+    if (error > worstError)
+      worstError = error;
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, (eye.a + eye.b) / 2, result.radius);
+  }
+
+  char message[96];
+  snprintf(message, sizeof(message), "mean error %.2f px, worst %.2f px",
+           totalError / SEQUENCE_LENGTH, worstError);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(totalError / SEQUENCE_LENGTH < 0.5f);
+  TEST_ASSERT_TRUE(worstError < 1.0f);
+}
+
+void test_ellipse_axes() {
+  render({.x = 110, .y = 130, .a = 26, .b = 14, .lid = 0});
+  PupilResult_t result;
+  TEST_ASSERT_TRUE(detector.detect(frame, FRAME_SIZE, FRAME_SIZE, result));
+  TEST_ASSERT_FLOAT_WITHIN(1.5f, 26, result.axisMajor);
+  TEST_ASSERT_FLOAT_WITHIN(1.5f, 14, result.axisMinor);
+  // the major axis lies along x
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 0, sinf(result.angle));
+}
+
+void test_half_closed_eye() {
+  // the lid cuts the top of the pupil, the center is still close to it
+  Eye_t eye = {.x = 120, .y = 130, .a = 20, .b = 20, .lid = 118};
+  render(eye);
+  PupilResult_t result;
+  TEST_ASSERT_TRUE(detector.detect(frame, FRAME_SIZE, FRAME_SIZE, result));
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, eye.x, result.x);
+  TEST_ASSERT_TRUE(result.y > eye.y);
+}
+
+void test_closed_eye() {
+  render({.x = 120, .y = 120, .a = 20, .b = 18, .lid = FRAME_SIZE});
+  PupilResult_t result;
+  TEST_ASSERT_FALSE(detector.detect(frame, FRAME_SIZE, FRAME_SIZE, result));
+  TEST_ASSERT_EQUAL(0, result.confidence);
+}
+
+static bool readPGM(const std::string& path,
+                    std::vector<uint8_t>& pixels,
+                    int& width,
+                    int& height) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file)
+    return false;
+  int maxValue = 0;
+  bool ok = fscanf(file, "P5 %d %d %d", &width, &height, &maxValue) == 3 &&
+            maxValue == 255 && fgetc(file) != EOF;
+  if (ok) {
+    pixels.resize((size_t)width * height);
+    ok = fread(pixels.data(), 1, pixels.size(), file) == pixels.size();
+  }
+  fclose(file);
+  return ok;
+}
+
+void test_recorded_sequence() {
+  const char* directory = getenv("OPENIRIS_PUPIL_REPLAY");
+  if (!directory)
+    TEST_IGNORE_MESSAGE("set OPENIRIS_PUPIL_REPLAY to replay recorded frames");
+
+  std::string base = std::string(directory) + "/";
+  FILE* centers = fopen((base + "centers.csv").c_str(), "r");
+  TEST_ASSERT_NOT_NULL(centers);
+
+  char name[256];
+  float x, y;
+  int frames = 0;
+  int misses = 0;
+  float totalError = 0;
+  std::vector<uint8_t> pixels;
+  while (fscanf(centers, " %255[^,],%f,%f", name, &x, &y) == 3) {
+    int width, height;
+    TEST_ASSERT_TRUE_MESSAGE(readPGM(base + name, pixels, width, height),
+                             name);
+    PupilResult_t result;
+    frames++;
+    if (!detector.detect(pixels.data(), width, height, result)) {
+      misses++;
+      continue;
+    }
+    totalError += hypotf(result.x - x, result.y - y);
+  }
+  fclose(centers);
+
+  TEST_ASSERT_GREATER_THAN(0, frames);
+  char message[128];
+  snprintf(message, sizeof(message),
+           "%d frames, %d without a pupil, mean error %.2f px", frames,
+           misses, frames > misses ? totalError / (frames - misses) : 0.0f);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(misses * 10 <= frames);
+  TEST_ASSERT_TRUE(totalError <= 2.0f * (frames - misses));
+}
+
+int main(int argc, char** argv) {
+  TEST_ASSERT_TRUE(detector.begin());
+  UNITY_BEGIN();
+  RUN_TEST(test_synthetic_sequence);
+  RUN_TEST(test_ellipse_axes);
+  RUN_TEST(test_half_closed_eye);
+  RUN_TEST(test_closed_eye);
+  RUN_TEST(test_recorded_sequence);
+  return UNITY_END();
+}
@@ -0,0 +1,140 @@
+# Description: Formats a raw binary log dump from the tracker on the host
+#
+# Usage:
+#   python binlog_decode.py dump.bin
+#   python binlog_decode.py http://openiristracker.local:81/control/builtin/command/log?raw=1
+#
+# The dump is self-describing, it carries the module names and every format
+# string its records reference - no firmware ELF needed.
+
+import re
+import struct
+import sys
+import urllib.request
+
+LEVELS = "NEWIDV"
+HEADER = struct.Struct("<BBBBQI")
+SPEC = re.compile(r"%([-+ #0-9.]*)[hlLqjzt]*([diouxXcsfFeEgGaAp%])")
+
+
+def read_args(record):
+    args = []
+    offset = HEADER.size
+    while offset < len(record):
+        tag = chr(record[offset])
+        offset += 1
+        if tag == "I":
+            args.append(("I", struct.unpack_from("<I", record, offset)[0]))
+            offset += 4
+        elif tag == "Q":
+            args.append(("Q", struct.unpack_from("<Q", record, offset)[0]))
+            offset += 8
+        elif tag == "D":
+            args.append(("D", struct.unpack_from("<d", record, offset)[0]))
+            offset += 8
+        elif tag == "S":
+            size = record[offset]
+            value = record[offset + 1 : offset + 1 + size]
+            args.append(("S", value.decode("utf-8", "replace")))
+            offset += 1 + size
+        else:
+            break
+    return args
+
+
+def format_message(fmt, args):
+    args = list(args)
+
+    def replace(match):
+        flags, conversion = match.group(1), match.group(2)
+        if conversion == "%":
+            return "%"
+        if not args:
+            return match.group(0)
+        tag, value = args.pop(0)
+        if tag == "S":
+            return ("%" + flags + "s") % value
+        if tag == "D":
+            if conversion not in "fFeEgGaA":
+                conversion = "g"
+            return ("%" + flags + conversion) % value
+        if tag == "I" and conversion in "di" and value & 0x80000000:
+            value -= 1 << 32
+        elif tag == "Q" and conversion in "di" and value & (1 << 63):
+            value -= 1 << 64
+        if conversion in "fFeEgGaA":
+            return ("%" + flags + conversion) % float(value)
+        if conversion == "c":
+            return chr(value & 0xFF)
+        if conversion in "sp":
+            return "0x%08x" % value
+        return ("%" + flags + {"u": "d"}.get(conversion, conversion)) % value
+
+    return SPEC.sub(replace, fmt)
+
+
+def decode(data):
+    if data[:4] != b"OIBL" or data[4] != 1:
+        raise ValueError("not a version 1 binary log dump")
+    (dropped,) = struct.unpack_from("<I", data, 5)
+    offset = 9
+    modules = {}
+    formats = {}
+    lines = []
+    while offset < len(data):
+        kind = chr(data[offset])
+        offset += 1
+        if kind == "M":
+            index, size = data[offset], data[offset + 1]
+            modules[index] = data[offset + 2 : offset + 2 + size].decode()
+            offset += 2 + size
+        elif kind == "F":
+            address, size = struct.unpack_from("<IH", data, offset)
+            formats[address] = data[offset + 6 : offset + 6 + size].decode(
+                "utf-8", "replace"
+            )
+            offset += 6 + size
+        elif kind == "R":
+            record = data[offset : offset + data[offset]]
+            offset += len(record)
+            _, module, level, _, timestamp, address = HEADER.unpack_from(record)
+            message = format_message(
+                formats.get(address, "<unknown format 0x%08x>" % address),
+                read_args(record),
+            )
+            lines.append(
+                "[%6u.%03u][%s][%s]: %s"
+                % (
+                    timestamp // 1000,
+                    timestamp % 1000,
+                    LEVELS[min(level, len(LEVELS) - 1)],
+                    modules.get(module, "?"),
+                    message,
+                )
+            )
+        else:
+            raise ValueError("corrupt dump at byte %d" % (offset - 1))
+    if dropped:
+        lines.append("[binlog] %u records overwritten before this dump" % dropped)
+    return lines
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("usage: binlog_decode.py <dump file | url | ->")
+        sys.exit(1)
+    source = sys.argv[1]
+    if source.startswith("http://") or source.startswith("https://"):
+        with urllib.request.urlopen(source) as response:
+            data = response.read()
+    elif source == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(source, "rb") as dump:
+            data = dump.read()
+    for line in decode(data):
+        print(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,105 @@
+# Description: Flashes a tracker over Wi-Fi, gzip compressed and resumable
+#
+# Usage:
+#   python ota_upload.py firmware.bin openiristracker.local
+#   python ota_upload.py firmware.bin 192.168.1.42:81 --chunk 16384
+#
+# The image goes up gzip compressed in pieces to /update/chunk. A piece that
+# doesn't make it gets retried from wherever the tracker says it got to, the
+# upload never starts over as long as the tracker stays up. The tracker
+# checks the SHA-256 of the inflated image before it finishes the update.
+
+import argparse
+import gzip
+import hashlib
+import json
+import sys
+import time
+import urllib.error
+import urllib.request
+
+
+def post_chunk(base, offset, data, params, timeout):
+    query = "&".join(["offset=%d" % offset] + ["%s=%s" % kv for kv in params])
+    request = urllib.request.Request(
+        "%s/update/chunk?%s" % (base, query),
+        data=data,
+        headers={"Content-Type": "application/octet-stream"},
+        method="POST",
+    )
+    try:
+        with urllib.request.urlopen(request, timeout=timeout) as response:
+            return json.load(response)
+    except urllib.error.HTTPError as error:
+        # 409 carries the status, its "received" is where to go on from
+        if error.code == 409:
+            return json.load(error)
+        raise
+
+
+def get_status(base, timeout):
+    with urllib.request.urlopen(base + "/update/status", timeout=timeout) as response:
+        return json.load(response)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Flashes a tracker over Wi-Fi, gzip compressed and resumable"
+    )
+    parser.add_argument("firmware")
+    parser.add_argument("host", help="host[:port], the API server on port 81 by default")
+    parser.add_argument("--chunk", type=int, default=8192)
+    parser.add_argument("--retries", type=int, default=20)
+    parser.add_argument("--timeout", type=float, default=10)
+    args = parser.parse_args()
+
+    with open(args.firmware, "rb") as f:
+        image = f.read()
+    upload = gzip.compress(image, 9)
+    sha256 = hashlib.sha256(image).hexdigest()
+    base = "http://" + (args.host if ":" in args.host else args.host + ":81")
+    print(
+        "%d byte image, %d bytes to send (%.0f%%)"
+        % (len(image), len(upload), 100.0 * len(upload) / len(image))
+    )
+
+    started = time.monotonic()
+    offset = 0
+    retries = 0
+    while True:
+        data = upload[offset : offset + args.chunk]
+        final = offset + len(data) == len(upload)
+        params = [("final", "1")] if final else []
+        if offset == 0:
+            params += [("encoding", "gzip"), ("sha256", sha256)]
+        try:
+            status = post_chunk(base, offset, data, params, args.timeout)
+        except (OSError, urllib.error.URLError) as error:
+            retries += 1
+            if retries > args.retries:
+                sys.exit("giving up: %s" % error)
+            time.sleep(1)
+            # the piece may have arrived before the connection dropped
+            try:
+                offset = get_status(base, args.timeout)["received"]
+            except (OSError, urllib.error.URLError, ValueError):
+                pass
+            print("retrying from %d: %s" % (offset, error))
+            continue
+
+        if status["state"] == "failed":
+            sys.exit("update failed: %s" % status["error"])
+        if status["state"] == "done":
+            break
+        offset = status["received"]
+        print("\r%d / %d" % (offset, len(upload)), end="", flush=True)
+
+    print(
+        "\ndone in %.1f s, the tracker took %d ms, %d bytes saved, sha256 %s"
+        % (time.monotonic() - started, status["elapsed_ms"], status["bytes_saved"], status["sha256"])
+    )
+    print("the tracker restarts into the new image")
+
+
+if __name__ == "__main__":
+    main()